@@ -0,0 +1,244 @@
+// utte-allocs - counts the heap allocations of rendering templates
+// Usage: utte-allocs [-n renders] [-v] [template...]
+// Without templates, renders a fixed set of scenarios that cover the hot paths of the engine, and fails if any of them
+// allocates more often, or more bytes, per render than its budget, so that it can be run on every change. Templates
+// given on the command line are only measured. Every template is rendered once to warm up, then "-n" more times
+// (10 by default), and the allocations of those renders are averaged. "-v" prints the scenarios that pass as well
+#include "C/CGenerator.h"
+#include "Generator.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <sstream>
+
+static std::atomic<size_t> allocations = 0;
+static std::atomic<size_t> bytes = 0;
+
+void* operator new(size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    bytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* result = std::malloc(size == 0 ? 1 : size))
+        return result;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    bytes.fetch_add(size, std::memory_order_relaxed);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t& tag) noexcept
+{
+    return operator new(size, tag);
+}
+
+// Only the plain form frees, the others forward to it like the forms of "new" do, so every block is released by the
+// same replacement that matches the malloc in "new". It isn't inlined, since GCC would then see "free" called on the
+// result of "new" and warn about mismatched allocation functions
+#ifdef __GNUC__
+    [[gnu::noinline]]
+#endif
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    ::operator delete(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    ::operator delete(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+    ::operator delete(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    ::operator delete(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    ::operator delete(ptr);
+}
+
+struct Usage
+{
+    double allocations = 0;
+    double bytes = 0;
+};
+
+struct Scenario
+{
+    const char* name;
+    const char* source;
+
+    // The most allocations and bytes a render may take on average
+    size_t maxAllocations;
+    size_t maxBytes;
+
+    // Renders through the C API instead
+    bool bC = false;
+};
+
+static std::vector<utte_string> descriptors{ "quick", "brown", "lazy", "red" };
+static utte_map<utte_string, utte_string> actions{ { "a1", "jumps" }, { "a2", "runs" }, { "a3", "sleeps" } };
+
+static const char* cDescriptors[] = { "quick", "brown", "lazy", "red" };
+
+static UTTE_CVariable cShout(UTTE_CVariable* args, size_t size, UTTE_CGenerator*)
+{
+    return { .value = size > 1 ? args[1].value : "", .type = UTTE_VARIABLE_TYPE_HINT_NORMAL, .bDeallocate = false, .status = UTTE_PARSE_STATUS_SUCCESS };
+}
+
+static void bind(UTTE::Generator& generator) noexcept
+{
+    generator.pushVariable(UTTE::Generator::makeArray(descriptors), "descriptors");
+    generator.pushVariable(UTTE::Generator::makeMap(actions), "actions");
+    generator.pushVariable({ .value = "brown" }, "colour");
+    generator.pushVariable({ .value = "test" }, "value");
+    generator.pushVariable({ .value = "Example Domain" }, "title");
+}
+
+static UTTE_CGenerator* bindC() noexcept
+{
+    auto* generator = UTTE_CGenerator_Allocate();
+    UTTE_CGenerator_pushVariable(generator, UTTE_CGenerator_makeArray(generator, const_cast<char**>(cDescriptors), 4), "descriptors");
+    UTTE_CGenerator_pushVariable(generator, { .value = "brown", .type = UTTE_VARIABLE_TYPE_HINT_NORMAL, .bDeallocate = false, .status = UTTE_PARSE_STATUS_SUCCESS }, "colour");
+    UTTE_CGenerator_pushFunction(generator, { .name = "shout", .function = cShout, .bDeallocate = false, .bPure = false, .bStatic = false });
+    return generator;
+}
+
+static bool measure(const char* source, bool bC, size_t renders, Usage& usage) noexcept
+{
+    bool bSuccess = true;
+    auto run = [&](auto&& render) -> void
+    {
+        bSuccess = render();
+        size_t beginAllocations = allocations.load();
+        size_t beginBytes = bytes.load();
+        for (size_t i = 0; i < renders && bSuccess; i++)
+            bSuccess = render();
+
+        usage.allocations = static_cast<double>(allocations.load() - beginAllocations) / static_cast<double>(renders);
+        usage.bytes = static_cast<double>(bytes.load() - beginBytes) / static_cast<double>(renders);
+    };
+
+    if (bC)
+    {
+        auto* generator = bindC();
+        UTTE_CGenerator_loadFromString(generator, source);
+        run([&]() -> bool { return UTTE_CGenerator_render(generator).status == UTTE_PARSE_STATUS_SUCCESS; });
+        UTTE_CGenerator_Free(generator);
+    }
+    else
+    {
+        UTTE::Generator generator;
+        bind(generator);
+        generator.loadFromString(source);
+        run([&]() -> bool { return generator.render().status == UTTE_PARSE_STATUS_SUCCESS; });
+    }
+    return bSuccess;
+}
+
+static void print(const char* state, const utte_string& name, const Usage& usage) noexcept
+{
+    std::cout << std::left << std::setw(6) << state << std::setw(24) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << usage.allocations << " allocations" << std::setw(12) << usage.bytes << " bytes" << '\n';
+}
+
+int main(int argc, char** argv)
+{
+    // The number of allocations is exact, so any new allocation fails. The bytes leave some room for the growth
+    // policies of the standard library. Lower the budgets when a change removes allocations
+    static const Scenario scenarios[] = {
+        { "literal", "<html><body><p>Nothing to replace here</p></body></html>", 0, 0 },
+        { "variables", "<h1>{{ title }}</h1><p>The {{ colour }} fox, {{ value }}</p>", 2, 128 },
+        { "array loop", "{{ for it {{ descriptors }} {{ func <li>{{ it }}</li> }} }}", 14, 2576 },
+        { "map loop", "{{ for key val {{ actions }} {{ func <dt>{{ key }}</dt><dd>{{ val }}</dd> }} }}", 15, 2816 },
+        { "at", "{{ at {{ descriptors }} 1 }} {{ at {{ actions }} a2 }}", 8, 1024 },
+        { "range loop", "{{ for i {{ range 50 }} {{ func {{ i }}, }} }}", 14, 2576 },
+        { "if", "{{ if {{ == {{ value }} test }} {{ func yes }} {{ func no }} }}", 11, 1792 },
+        { "cond", "{{ cond {{ == {{ value }} x }}{{ func x }} {{ == {{ value }} test }}{{ func {{ title }} }} {{ func none }} }}", 12, 2048 },
+        { "switch", "{{ switch {{ value }} x {{ func x }} test {{ func {{ title }} }} {{ func none }} }}", 11, 2048 },
+        { "C callback", "{{ shout {{ colour }} }} {{ for it {{ descriptors }} {{ func {{ shout {{ it }} }} }} }}", 24, 3328, true },
+    };
+
+    size_t renders = 10;
+    bool bVerbose = false;
+    std::vector<utte_string> files;
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            renders = std::max<size_t>(std::strtoul(argv[++i], nullptr, 10), 1);
+        else if (std::strcmp(argv[i], "-v") == 0)
+            bVerbose = true;
+        else
+            files.emplace_back(argv[i]);
+    }
+
+    Usage usage;
+    if (!files.empty())
+    {
+        int result = 0;
+        for (auto& a : files)
+        {
+            std::ifstream in(a);
+            if (!in)
+            {
+                std::cerr << "Couldn't open the template: " << a << std::endl;
+                result = 1;
+                continue;
+            }
+            std::stringstream ss;
+            ss << in.rdbuf();
+
+            if (measure(ss.str().c_str(), false, renders, usage))
+                print("", a, usage);
+            else
+            {
+                std::cerr << "Couldn't render the template: " << a << std::endl;
+                result = 1;
+            }
+        }
+        return result;
+    }
+
+    size_t failed = 0;
+    for (auto& a : scenarios)
+    {
+        bool bPassed = measure(a.source, a.bC, renders, usage);
+        bPassed = bPassed && usage.allocations <= static_cast<double>(a.maxAllocations) && usage.bytes <= static_cast<double>(a.maxBytes);
+        if (!bPassed)
+        {
+            ++failed;
+            print("FAIL", a.name, usage);
+            std::cout << "      budget: " << a.maxAllocations << " allocations, " << a.maxBytes << " bytes" << '\n';
+        }
+        else if (bVerbose)
+            print("OK", a.name, usage);
+    }
+
+    std::cout << std::size(scenarios) - failed << " of " << std::size(scenarios) << " scenarios within budget" << std::endl;
+    return failed == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+// utte-build - renders a tree of templates to a static site
+// Usage: utte-build <input directory> <output directory> [-m manifest] [-j threads] [-q] [-w]
+// Every ".tmpl" file in the input directory, except the ones whose name starts with "_", is rendered to a ".html" file
+// at the same path in the output directory, with the variables of the manifest bound to it. See UTTE::BuildManifest
+// for the format of the manifest. Prints the time every page took, unless "-q" is given, and a summary. "-w" keeps
+// running after the build and renders the pages that depend on every file that changes again, see UTTE::Watch
+#include "Build.hpp"
+#include "Watch.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+static const char* stateName(UTTE::BuildFileResult::State state) noexcept
+{
+    switch (state)
+    {
+    case UTTE::BuildFileResult::UTTE_BUILD_FILE_WRITTEN:
+        return "written";
+    case UTTE::BuildFileResult::UTTE_BUILD_FILE_UNCHANGED:
+        return "unchanged";
+    case UTTE::BuildFileResult::UTTE_BUILD_FILE_READ_ERROR:
+        return "read error";
+    case UTTE::BuildFileResult::UTTE_BUILD_FILE_RENDER_ERROR:
+        return "render error";
+    default:
+        return "write error";
+    }
+}
+
+// Prints the results of a build and returns the number of pages that failed
+static size_t report(const std::vector<UTTE::BuildFileResult>& results, double elapsed, bool bQuiet) noexcept
+{
+    size_t written = 0;
+    size_t unchanged = 0;
+    size_t failed = 0;
+    for (auto& a : results)
+    {
+        if (a.state == UTTE::BuildFileResult::UTTE_BUILD_FILE_WRITTEN)
+            ++written;
+        else if (a.state == UTTE::BuildFileResult::UTTE_BUILD_FILE_UNCHANGED)
+            ++unchanged;
+        else
+            ++failed;
+
+        if (!bQuiet || (a.state != UTTE::BuildFileResult::UTTE_BUILD_FILE_WRITTEN && a.state != UTTE::BuildFileResult::UTTE_BUILD_FILE_UNCHANGED))
+        {
+            std::cout << std::fixed << std::setprecision(3) << std::setw(10) << static_cast<double>(a.microseconds) / 1000.0
+                      << " ms  " << std::left << std::setw(13) << stateName(a.state) << std::right << a.input;
+            if (a.state == UTTE::BuildFileResult::UTTE_BUILD_FILE_RENDER_ERROR)
+                std::cout << " (status " << a.status << ")";
+            std::cout << '\n';
+        }
+    }
+
+    std::cout << results.size() << " pages in " << std::fixed << std::setprecision(1) << elapsed << " ms: " << written
+              << " written, " << unchanged << " unchanged, " << failed << " failed" << std::endl;
+    return failed;
+}
+
+int main(int argc, char** argv)
+{
+    UTTE::BuildOptions options;
+    UTTE::BuildManifest manifest;
+    utte_string manifestLocation;
+    bool bQuiet = false;
+    bool bWatch = false;
+
+    std::vector<utte_string> positional;
+    for (int i = 1; i < argc; i++)
+    {
+        utte_string arg = argv[i];
+        if (arg == "-q")
+            bQuiet = true;
+        else if (arg == "-w")
+            bWatch = true;
+        else if (arg == "-j" && i + 1 < argc)
+            options.threads = std::strtoul(argv[++i], nullptr, 10);
+        else if (arg == "-m" && i + 1 < argc)
+        {
+            manifestLocation = argv[++i];
+            if (!manifest.load(manifestLocation))
+            {
+                std::cerr << "Couldn't load the manifest: " << argv[i] << std::endl;
+                return 1;
+            }
+        }
+        else
+            positional.push_back(arg);
+    }
+
+    if (positional.size() != 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <input directory> <output directory> [-m manifest] [-j threads] [-q] [-w]" << std::endl;
+        return 1;
+    }
+    options.input = positional[0];
+    options.output = positional[1];
+
+    if (bWatch)
+    {
+        UTTE::Watch watch(options, manifestLocation);
+        bool bWatching = watch.run([&](const std::vector<UTTE::BuildFileResult>& results, uint64_t microseconds) -> bool
+        {
+            report(results, static_cast<double>(microseconds) / 1000.0, bQuiet);
+            return true;
+        });
+        if (!bWatching)
+        {
+            std::cerr << "Couldn't watch the input directory: " << options.input << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    auto results = UTTE::Build::run(options, manifest);
+    auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    return report(results, elapsed, bQuiet) == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,309 @@
+// Generated by utte-compile, do not edit
+#include "Context.hpp"
+#include <mutex>
+
+namespace collections
+{
+    UTTE::ParseResultStatus render(UTTE::Context& context, utte_string& sink) noexcept;
+}
+
+namespace
+{
+    const char literals[] =
+    {
+        108, 101, 110, 103, 116, 104, 100, 101, 115, 99, 114, 105, 112, 116, 111, 114,
+        115, 32, 108, 101, 110, 103, 116, 104, 97, 99, 116, 105, 111, 110, 115, 32,
+        108, 101, 110, 103, 116, 104, 114, 97, 110, 103, 101, 53, 32, 108, 101, 110,
+        103, 116, 104, 116, 101, 120, 116, 10, 106, 111, 105, 110, 115, 111, 114, 116,
+        119, 111, 114, 100, 115, 44, 32, 106, 111, 105, 110, 114, 101, 118, 101, 114,
+        115, 101, 119, 111, 114, 100, 115, 10, 106, 111, 105, 110, 107, 101, 121, 115,
+        97, 99, 116, 105, 111, 110, 115, 47, 32, 106, 111, 105, 110, 118, 97, 108,
+        117, 101, 115, 97, 99, 116, 105, 111, 110, 115, 47, 10, 99, 111, 110, 116,
+        97, 105, 110, 115, 119, 111, 114, 100, 115, 102, 105, 103, 32, 99, 111, 110,
+        116, 97, 105, 110, 115, 97, 99, 116, 105, 111, 110, 115, 97, 51, 32, 99,
+        111, 110, 116, 97, 105, 110, 115, 114, 97, 110, 103, 101, 48, 49, 48, 50,
+        52, 32, 99, 111, 110, 116, 97, 105, 110, 115, 116, 101, 120, 116, 119, -61,
+        -74, 10, 106, 111, 105, 110, 102, 105, 108, 116, 101, 114, 119, 111, 114, 100,
+        115, 115, 104, 111, 114, 116, 44, 10, 106, 111, 105, 110, 115, 108, 105, 99,
+        101, 119, 111, 114, 100, 115, 49, 44, 32, 115, 108, 105, 99, 101, 116, 101,
+        120, 116, 49, 52, 32, 97, 116, 116, 101, 120, 116, 49, 10, 97, 116, 100,
+        101, 115, 99, 114, 105, 112, 116, 111, 114, 115, 49, 32, 97, 116, 97, 99,
+        116, 105, 111, 110, 115, 97, 50, 32, 97, 116, 112, 114, 111, 100, 117, 99,
+        116, 110, 97, 109, 101, 32, 97, 116, 114, 97, 110, 103, 101, 53, 50, 10,
+        106, 111, 105, 110, 114, 101, 118, 101, 114, 115, 101, 114, 97, 110, 103, 101,
+        49, 52, 45, 10, 0,
+    };
+
+    // Symbols of the called functions, interned on the first render
+    UTTE::Symbol symbols[16];
+    std::once_flag symbolsFlag;
+
+    void resolveSymbols() noexcept
+    {
+        symbols[0] = UTTE::SymbolTable::intern(utte_string_view(literals + 6, 11));
+        symbols[1] = UTTE::SymbolTable::intern(utte_string_view(literals + 0, 6));
+        symbols[2] = UTTE::SymbolTable::intern(utte_string_view(literals + 24, 7));
+        symbols[3] = UTTE::SymbolTable::intern(utte_string_view(literals + 38, 5));
+        symbols[4] = UTTE::SymbolTable::intern(utte_string_view(literals + 51, 4));
+        symbols[5] = UTTE::SymbolTable::intern(utte_string_view(literals + 64, 5));
+        symbols[6] = UTTE::SymbolTable::intern(utte_string_view(literals + 60, 4));
+        symbols[7] = UTTE::SymbolTable::intern(utte_string_view(literals + 56, 4));
+        symbols[8] = UTTE::SymbolTable::intern(utte_string_view(literals + 75, 7));
+        symbols[9] = UTTE::SymbolTable::intern(utte_string_view(literals + 92, 4));
+        symbols[10] = UTTE::SymbolTable::intern(utte_string_view(literals + 109, 6));
+        symbols[11] = UTTE::SymbolTable::intern(utte_string_view(literals + 124, 8));
+        symbols[12] = UTTE::SymbolTable::intern(utte_string_view(literals + 198, 6));
+        symbols[13] = UTTE::SymbolTable::intern(utte_string_view(literals + 220, 5));
+        symbols[14] = UTTE::SymbolTable::intern(utte_string_view(literals + 245, 2));
+        symbols[15] = UTTE::SymbolTable::intern(utte_string_view(literals + 282, 7));
+    }
+}
+
+UTTE::ParseResultStatus collections::render(UTTE::Context& context, utte_string& sink) noexcept
+{
+    std::call_once(symbolsFlag, resolveSymbols);
+    context.frame();
+    context.push(utte_string_view(literals + 0, 6));
+    context.frame();
+    context.push(utte_string_view(literals + 6, 11));
+    if (auto status = context.call(symbols[0], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[1], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 17, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 18, 6));
+    context.frame();
+    context.push(utte_string_view(literals + 24, 7));
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[1], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 31, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 32, 6));
+    context.frame();
+    context.push(utte_string_view(literals + 38, 5));
+    context.push(utte_string_view(literals + 43, 1));
+    if (auto status = context.call(symbols[3], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[1], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 44, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 45, 6));
+    context.frame();
+    context.push(utte_string_view(literals + 51, 4));
+    if (auto status = context.call(symbols[4], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[1], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 55, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 56, 4));
+    context.frame();
+    context.push(utte_string_view(literals + 60, 4));
+    context.frame();
+    context.push(utte_string_view(literals + 64, 5));
+    if (auto status = context.call(symbols[5], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[6], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 69, 1));
+    if (auto status = context.call(symbols[7], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 70, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 71, 4));
+    context.frame();
+    context.push(utte_string_view(literals + 75, 7));
+    context.frame();
+    context.push(utte_string_view(literals + 82, 5));
+    if (auto status = context.call(symbols[5], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[8], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[7], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 87, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 88, 4));
+    context.frame();
+    context.push(utte_string_view(literals + 92, 4));
+    context.frame();
+    context.push(utte_string_view(literals + 96, 7));
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[9], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 103, 1));
+    if (auto status = context.call(symbols[7], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 104, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 105, 4));
+    context.frame();
+    context.push(utte_string_view(literals + 109, 6));
+    context.frame();
+    context.push(utte_string_view(literals + 115, 7));
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[10], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 122, 1));
+    if (auto status = context.call(symbols[7], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 123, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 124, 8));
+    context.frame();
+    context.push(utte_string_view(literals + 132, 5));
+    if (auto status = context.call(symbols[5], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 137, 3));
+    if (auto status = context.call(symbols[11], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 140, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 141, 8));
+    context.frame();
+    context.push(utte_string_view(literals + 149, 7));
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 156, 2));
+    if (auto status = context.call(symbols[11], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 158, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 159, 8));
+    context.frame();
+    context.push(utte_string_view(literals + 167, 5));
+    context.push(utte_string_view(literals + 172, 1));
+    context.push(utte_string_view(literals + 173, 2));
+    context.push(utte_string_view(literals + 175, 1));
+    if (auto status = context.call(symbols[3], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 176, 1));
+    if (auto status = context.call(symbols[11], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 177, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 178, 8));
+    context.frame();
+    context.push(utte_string_view(literals + 186, 4));
+    if (auto status = context.call(symbols[4], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 190, 3));
+    if (auto status = context.call(symbols[11], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 193, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 194, 4));
+    context.frame();
+    context.push(utte_string_view(literals + 198, 6));
+    context.frame();
+    context.push(utte_string_view(literals + 204, 5));
+    if (auto status = context.call(symbols[5], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 209, 5));
+    if (auto status = context.call(symbols[12], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 214, 1));
+    if (auto status = context.call(symbols[7], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 215, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 216, 4));
+    context.frame();
+    context.push(utte_string_view(literals + 220, 5));
+    context.frame();
+    context.push(utte_string_view(literals + 225, 5));
+    if (auto status = context.call(symbols[5], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 230, 1));
+    if (auto status = context.call(symbols[13], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 231, 1));
+    if (auto status = context.call(symbols[7], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 232, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 233, 5));
+    context.frame();
+    context.push(utte_string_view(literals + 238, 4));
+    if (auto status = context.call(symbols[4], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 242, 1));
+    context.push(utte_string_view(literals + 243, 1));
+    if (auto status = context.call(symbols[13], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 244, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 245, 2));
+    context.frame();
+    context.push(utte_string_view(literals + 247, 4));
+    if (auto status = context.call(symbols[4], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 251, 1));
+    if (auto status = context.call(symbols[14], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 252, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 253, 2));
+    context.frame();
+    context.push(utte_string_view(literals + 255, 11));
+    if (auto status = context.call(symbols[0], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 266, 1));
+    if (auto status = context.call(symbols[14], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 267, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 268, 2));
+    context.frame();
+    context.push(utte_string_view(literals + 270, 7));
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 277, 2));
+    if (auto status = context.call(symbols[14], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 279, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 280, 2));
+    context.frame();
+    context.push(utte_string_view(literals + 282, 7));
+    if (auto status = context.call(symbols[15], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 289, 4));
+    if (auto status = context.call(symbols[14], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 293, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 294, 2));
+    context.frame();
+    context.push(utte_string_view(literals + 296, 5));
+    context.push(utte_string_view(literals + 301, 1));
+    if (auto status = context.call(symbols[3], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 302, 1));
+    if (auto status = context.call(symbols[14], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 303, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 304, 4));
+    context.frame();
+    context.push(utte_string_view(literals + 308, 7));
+    context.frame();
+    context.push(utte_string_view(literals + 315, 5));
+    context.push(utte_string_view(literals + 320, 1));
+    context.push(utte_string_view(literals + 321, 1));
+    if (auto status = context.call(symbols[3], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[8], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 322, 1));
+    if (auto status = context.call(symbols[7], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 323, 1));
+    return context.end(sink);
+}
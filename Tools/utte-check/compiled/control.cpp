@@ -0,0 +1,502 @@
+// Generated by utte-compile, do not edit
+#include "Context.hpp"
+#include <mutex>
+
+namespace control
+{
+    UTTE::ParseResultStatus render(UTTE::Context& context, utte_string& sink) noexcept;
+}
+
+namespace
+{
+    const char literals[] =
+    {
+        105, 102, 61, 61, 118, 97, 108, 117, 101, 116, 101, 115, 116, 102, 117, 110,
+        99, 121, 101, 115, 32, 123, 123, 32, 99, 111, 108, 111, 117, 114, 32, 125,
+        125, 32, 102, 117, 110, 99, 110, 111, 32, 10, 105, 102, 33, 61, 118, 97,
+        108, 117, 101, 116, 101, 115, 116, 102, 117, 110, 99, 121, 101, 115, 32, 102,
+        117, 110, 99, 110, 111, 32, 123, 123, 32, 117, 112, 112, 101, 114, 32, 123,
+        123, 32, 99, 111, 108, 111, 117, 114, 32, 125, 125, 32, 125, 125, 32, 10,
+        105, 102, 49, 102, 117, 110, 99, 123, 123, 32, 105, 102, 32, 48, 32, 123,
+        123, 32, 102, 117, 110, 99, 32, 105, 110, 110, 101, 114, 32, 121, 101, 115,
+        32, 125, 125, 32, 123, 123, 32, 102, 117, 110, 99, 32, 105, 110, 110, 101,
+        114, 32, 110, 111, 32, 125, 125, 32, 125, 125, 32, 102, 117, 110, 99, 111,
+        117, 116, 101, 114, 32, 110, 111, 32, 10, 115, 119, 105, 116, 99, 104, 118,
+        97, 108, 117, 101, 101, 120, 97, 109, 112, 108, 101, 102, 117, 110, 99, 69,
+        32, 116, 101, 115, 116, 102, 117, 110, 99, 84, 32, 102, 117, 110, 99, 68,
+        32, 10, 115, 119, 105, 116, 99, 104, 109, 105, 115, 115, 105, 110, 103, 101,
+        120, 97, 109, 112, 108, 101, 102, 117, 110, 99, 69, 32, 102, 117, 110, 99,
+        68, 32, 10, 115, 119, 105, 116, 99, 104, 99, 111, 108, 111, 117, 114, 114,
+        101, 100, 102, 117, 110, 99, 82, 32, 98, 108, 117, 101, 102, 117, 110, 99,
+        66, 32, 102, 117, 110, 99, 110, 111, 110, 101, 32, 10, 99, 111, 110, 100,
+        33, 116, 114, 117, 101, 102, 117, 110, 99, 111, 110, 101, 32, 38, 38, 116,
+        114, 117, 101, 61, 61, 97, 97, 102, 117, 110, 99, 116, 119, 111, 32, 102,
+        117, 110, 99, 116, 104, 114, 101, 101, 32, 10, 99, 111, 110, 100, 102, 97,
+        108, 115, 101, 102, 117, 110, 99, 111, 110, 101, 32, 124, 124, 102, 97, 108,
+        115, 101, 48, 102, 117, 110, 99, 116, 119, 111, 32, 102, 117, 110, 99, 110,
+        111, 110, 101, 32, 10, 117, 112, 112, 101, 114, 105, 102, 116, 114, 117, 101,
+        102, 117, 110, 99, 99, 97, 112, 116, 117, 114, 101, 100, 32, 102, 117, 110,
+        99, 110, 111, 32, 10, 114, 97, 119, 99, 111, 108, 111, 117, 114, 32, 10,
+        100, 121, 110, 98, 111, 100, 121, 10, 114, 97, 119, 123, 123, 32, 110, 111,
+        116, 32, 123, 123, 32, 112, 97, 114, 115, 101, 100, 32, 125, 125, 32, 125,
+        125, 32, 99, 111, 109, 109, 101, 110, 116, 123, 123, 32, 104, 105, 100, 100,
+        101, 110, 32, 125, 125, 32, 10, 121, 101, 115, 32, 99, 111, 108, 111, 117,
+        114, 32, 110, 111, 32, 121, 101, 115, 32, 110, 111, 32, 117, 112, 112, 101,
+        114, 99, 111, 108, 111, 117, 114, 32, 105, 102, 48, 102, 117, 110, 99, 105,
+        110, 110, 101, 114, 32, 121, 101, 115, 32, 102, 117, 110, 99, 105, 110, 110,
+        101, 114, 32, 110, 111, 32, 32, 111, 117, 116, 101, 114, 32, 110, 111, 32,
+        69, 32, 84, 32, 68, 32, 69, 32, 68, 32, 82, 32, 66, 32, 110, 111,
+        110, 101, 32, 111, 110, 101, 32, 116, 119, 111, 32, 116, 104, 114, 101, 101,
+        32, 111, 110, 101, 32, 116, 119, 111, 32, 110, 111, 110, 101, 32, 99, 97,
+        112, 116, 117, 114, 101, 100, 32, 110, 111, 32, 105, 110, 110, 101, 114, 32,
+        121, 101, 115, 32, 105, 110, 110, 101, 114, 32, 110, 111, 32, 0,
+    };
+
+    // Symbols of the called functions, interned on the first render
+    UTTE::Symbol symbols[15];
+    std::once_flag symbolsFlag;
+
+    void resolveSymbols() noexcept
+    {
+        symbols[0] = UTTE::SymbolTable::intern(utte_string_view(literals + 4, 5));
+        symbols[1] = UTTE::SymbolTable::intern(utte_string_view(literals + 2, 2));
+        symbols[2] = UTTE::SymbolTable::intern(utte_string_view(literals + 13, 4));
+        symbols[3] = UTTE::SymbolTable::intern(utte_string_view(literals + 0, 2));
+        symbols[4] = UTTE::SymbolTable::intern(utte_string_view(literals + 44, 2));
+        symbols[5] = UTTE::SymbolTable::intern(utte_string_view(literals + 169, 6));
+        symbols[6] = UTTE::SymbolTable::intern(utte_string_view(literals + 249, 6));
+        symbols[7] = UTTE::SymbolTable::intern(utte_string_view(literals + 288, 1));
+        symbols[8] = UTTE::SymbolTable::intern(utte_string_view(literals + 301, 2));
+        symbols[9] = UTTE::SymbolTable::intern(utte_string_view(literals + 284, 4));
+        symbols[10] = UTTE::SymbolTable::intern(utte_string_view(literals + 347, 2));
+        symbols[11] = UTTE::SymbolTable::intern(utte_string_view(literals + 373, 5));
+        symbols[12] = UTTE::SymbolTable::intern(utte_string_view(literals + 405, 3));
+        symbols[13] = UTTE::SymbolTable::intern(utte_string_view(literals + 416, 7));
+        symbols[14] = UTTE::SymbolTable::intern(utte_string_view(literals + 450, 7));
+    }
+
+    UTTE::ParseResultStatus body1(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body2(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body3(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body4(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body5(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body6(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body7(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body8(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body9(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body10(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body11(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body12(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body13(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body14(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body15(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body16(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body17(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body18(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body19(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body20(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body21(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body22(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body23(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body24(UTTE::Context& context, utte_string& sink) noexcept;
+}
+
+UTTE::ParseResultStatus control::render(UTTE::Context& context, utte_string& sink) noexcept
+{
+    std::call_once(symbolsFlag, resolveSymbols);
+    context.frame();
+    context.push(utte_string_view(literals + 0, 2));
+    context.frame();
+    context.push(utte_string_view(literals + 2, 2));
+    context.frame();
+    context.push(utte_string_view(literals + 4, 5));
+    if (auto status = context.call(symbols[0], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 9, 4));
+    if (auto status = context.call(symbols[1], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 13, 4));
+    context.push(utte_string_view(literals + 17, 17), body1);
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 34, 4));
+    context.push(utte_string_view(literals + 38, 3), body2);
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[3], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 41, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 42, 2));
+    context.frame();
+    context.push(utte_string_view(literals + 44, 2));
+    context.frame();
+    context.push(utte_string_view(literals + 46, 5));
+    if (auto status = context.call(symbols[0], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 51, 4));
+    if (auto status = context.call(symbols[4], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 55, 4));
+    context.push(utte_string_view(literals + 59, 4), body3);
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 63, 4));
+    context.push(utte_string_view(literals + 67, 28), body4);
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[3], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 95, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 96, 2));
+    context.push(utte_string_view(literals + 98, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 99, 4));
+    context.push(utte_string_view(literals + 103, 52), body5);
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 155, 4));
+    context.push(utte_string_view(literals + 159, 9), body6);
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[3], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 168, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 169, 6));
+    context.frame();
+    context.push(utte_string_view(literals + 175, 5));
+    if (auto status = context.call(symbols[0], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 180, 7));
+    context.frame();
+    context.push(utte_string_view(literals + 187, 4));
+    context.push(utte_string_view(literals + 191, 2), body7);
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 193, 4));
+    context.frame();
+    context.push(utte_string_view(literals + 197, 4));
+    context.push(utte_string_view(literals + 201, 2), body8);
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 203, 4));
+    context.push(utte_string_view(literals + 207, 2), body9);
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[5], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 209, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 210, 6));
+    context.push(utte_string_view(literals + 216, 7));
+    context.push(utte_string_view(literals + 223, 7));
+    context.frame();
+    context.push(utte_string_view(literals + 230, 4));
+    context.push(utte_string_view(literals + 234, 2), body10);
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 236, 4));
+    context.push(utte_string_view(literals + 240, 2), body11);
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[5], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 242, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 243, 6));
+    context.frame();
+    context.push(utte_string_view(literals + 249, 6));
+    if (auto status = context.call(symbols[6], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 255, 3));
+    context.frame();
+    context.push(utte_string_view(literals + 258, 4));
+    context.push(utte_string_view(literals + 262, 2), body12);
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 264, 4));
+    context.frame();
+    context.push(utte_string_view(literals + 268, 4));
+    context.push(utte_string_view(literals + 272, 2), body13);
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 274, 4));
+    context.push(utte_string_view(literals + 278, 5), body14);
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[5], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 283, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 284, 4));
+    context.frame();
+    context.push(utte_string_view(literals + 288, 1));
+    context.push(utte_string_view(literals + 289, 4));
+    if (auto status = context.call(symbols[7], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 293, 4));
+    context.push(utte_string_view(literals + 297, 4), body15);
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 301, 2));
+    context.push(utte_string_view(literals + 303, 4));
+    context.frame();
+    context.push(utte_string_view(literals + 307, 2));
+    context.push(utte_string_view(literals + 309, 1));
+    context.push(utte_string_view(literals + 310, 1));
+    if (auto status = context.call(symbols[1], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[8], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 311, 4));
+    context.push(utte_string_view(literals + 315, 4), body16);
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 319, 4));
+    context.push(utte_string_view(literals + 323, 6), body17);
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[9], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 329, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 330, 4));
+    context.push(utte_string_view(literals + 334, 5));
+    context.frame();
+    context.push(utte_string_view(literals + 339, 4));
+    context.push(utte_string_view(literals + 343, 4), body18);
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 347, 2));
+    context.push(utte_string_view(literals + 349, 5));
+    context.push(utte_string_view(literals + 354, 1));
+    if (auto status = context.call(symbols[10], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 355, 4));
+    context.push(utte_string_view(literals + 359, 4), body19);
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 363, 4));
+    context.push(utte_string_view(literals + 367, 5), body20);
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[9], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 372, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 373, 5));
+    context.frame();
+    context.push(utte_string_view(literals + 378, 2));
+    context.push(utte_string_view(literals + 380, 4));
+    context.frame();
+    context.push(utte_string_view(literals + 384, 4));
+    context.push(utte_string_view(literals + 388, 9), body21);
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 397, 4));
+    context.push(utte_string_view(literals + 401, 3), body22);
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[3], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[11], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 404, 1));
+    context.frame();
+    context.frame();
+    context.push(utte_string_view(literals + 405, 3));
+    context.push(utte_string_view(literals + 408, 7));
+    if (auto status = context.call(symbols[12], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(UTTE::UTTE_SYMBOL_INVALID, true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 415, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 416, 7));
+    if (auto status = context.call(symbols[13], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 423, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 424, 3));
+    context.push(utte_string_view(literals + 427, 23));
+    if (auto status = context.call(symbols[12], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 450, 7));
+    context.push(utte_string_view(literals + 457, 13));
+    if (auto status = context.call(symbols[14], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 470, 1));
+    return context.end(sink);
+}
+
+namespace
+{
+    UTTE::ParseResultStatus body1(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 471, 4));
+        context.frame();
+        context.push(utte_string_view(literals + 475, 6));
+        if (auto status = context.call(symbols[6], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 481, 1));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body2(UTTE::Context&, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 482, 3));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body3(UTTE::Context&, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 485, 4));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body4(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 489, 3));
+        context.frame();
+        context.push(utte_string_view(literals + 492, 5));
+        context.frame();
+        context.push(utte_string_view(literals + 497, 6));
+        if (auto status = context.call(symbols[6], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        if (auto status = context.call(symbols[11], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 503, 1));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body5(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        context.frame();
+        context.push(utte_string_view(literals + 504, 2));
+        context.push(utte_string_view(literals + 506, 1));
+        context.frame();
+        context.push(utte_string_view(literals + 507, 4));
+        context.push(utte_string_view(literals + 511, 10), body23);
+        if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        context.frame();
+        context.push(utte_string_view(literals + 521, 4));
+        context.push(utte_string_view(literals + 525, 9), body24);
+        if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        if (auto status = context.call(symbols[3], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 534, 1));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body6(UTTE::Context&, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 535, 9));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body7(UTTE::Context&, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 544, 2));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body8(UTTE::Context&, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 546, 2));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body9(UTTE::Context&, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 548, 2));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body10(UTTE::Context&, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 550, 2));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body11(UTTE::Context&, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 552, 2));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body12(UTTE::Context&, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 554, 2));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body13(UTTE::Context&, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 556, 2));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body14(UTTE::Context&, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 558, 5));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body15(UTTE::Context&, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 563, 4));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body16(UTTE::Context&, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 567, 4));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body17(UTTE::Context&, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 571, 6));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body18(UTTE::Context&, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 577, 4));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body19(UTTE::Context&, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 581, 4));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body20(UTTE::Context&, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 585, 5));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body21(UTTE::Context&, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 590, 9));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body22(UTTE::Context&, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 599, 3));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body23(UTTE::Context&, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 602, 10));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body24(UTTE::Context&, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 612, 9));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+}
@@ -0,0 +1,90 @@
+// Generated by utte-compile, do not edit
+#include "Context.hpp"
+#include <mutex>
+
+namespace include
+{
+    UTTE::ParseResultStatus render(UTTE::Context& context, utte_string& sink) noexcept;
+}
+
+namespace
+{
+    const char literals[] =
+    {
+        105, 110, 99, 108, 117, 100, 101, 112, 97, 114, 116, 105, 97, 108, 115, 47,
+        104, 101, 97, 100, 101, 114, 46, 116, 109, 112, 108, 10, 102, 111, 114, 105,
+        116, 100, 101, 115, 99, 114, 105, 112, 116, 111, 114, 115, 102, 117, 110, 99,
+        123, 123, 32, 105, 110, 99, 108, 117, 100, 101, 32, 112, 97, 114, 116, 105,
+        97, 108, 115, 47, 105, 116, 101, 109, 46, 116, 109, 112, 108, 32, 125, 125,
+        32, 10, 117, 112, 112, 101, 114, 105, 110, 99, 108, 117, 100, 101, 112, 97,
+        114, 116, 105, 97, 108, 115, 47, 104, 101, 97, 100, 101, 114, 46, 116, 109,
+        112, 108, 10, 105, 110, 99, 108, 117, 100, 101, 112, 97, 114, 116, 105, 97,
+        108, 115, 47, 105, 116, 101, 109, 46, 116, 109, 112, 108, 32, 0,
+    };
+
+    // Symbols of the called functions, interned on the first render
+    UTTE::Symbol symbols[5];
+    std::once_flag symbolsFlag;
+
+    void resolveSymbols() noexcept
+    {
+        symbols[0] = UTTE::SymbolTable::intern(utte_string_view(literals + 0, 7));
+        symbols[1] = UTTE::SymbolTable::intern(utte_string_view(literals + 33, 11));
+        symbols[2] = UTTE::SymbolTable::intern(utte_string_view(literals + 44, 4));
+        symbols[3] = UTTE::SymbolTable::intern(utte_string_view(literals + 28, 3));
+        symbols[4] = UTTE::SymbolTable::intern(utte_string_view(literals + 82, 5));
+    }
+
+    UTTE::ParseResultStatus body1(UTTE::Context& context, utte_string& sink) noexcept;
+}
+
+UTTE::ParseResultStatus include::render(UTTE::Context& context, utte_string& sink) noexcept
+{
+    std::call_once(symbolsFlag, resolveSymbols);
+    context.frame();
+    context.push(utte_string_view(literals + 0, 7));
+    context.push(utte_string_view(literals + 7, 20));
+    if (auto status = context.call(symbols[0], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 27, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 28, 3));
+    context.push(utte_string_view(literals + 31, 2));
+    context.frame();
+    context.push(utte_string_view(literals + 33, 11));
+    if (auto status = context.call(symbols[1], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 44, 4));
+    context.push(utte_string_view(literals + 48, 33), body1);
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[3], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 81, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 82, 5));
+    context.frame();
+    context.push(utte_string_view(literals + 87, 7));
+    context.push(utte_string_view(literals + 94, 20));
+    if (auto status = context.call(symbols[0], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[4], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 114, 1));
+    return context.end(sink);
+}
+
+namespace
+{
+    UTTE::ParseResultStatus body1(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        context.frame();
+        context.push(utte_string_view(literals + 115, 7));
+        context.push(utte_string_view(literals + 122, 18));
+        if (auto status = context.call(symbols[0], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 140, 1));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+}
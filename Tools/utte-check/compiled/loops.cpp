@@ -0,0 +1,452 @@
+// Generated by utte-compile, do not edit
+#include "Context.hpp"
+#include <mutex>
+
+namespace loops
+{
+    UTTE::ParseResultStatus render(UTTE::Context& context, utte_string& sink) noexcept;
+}
+
+namespace
+{
+    const char literals[] =
+    {
+        102, 111, 114, 105, 116, 100, 101, 115, 99, 114, 105, 112, 116, 111, 114, 115,
+        102, 117, 110, 99, 91, 123, 123, 32, 105, 116, 32, 125, 125, 93, 32, 10,
+        102, 111, 114, 107, 101, 121, 118, 97, 108, 97, 99, 116, 105, 111, 110, 115,
+        102, 117, 110, 99, 123, 123, 32, 107, 101, 121, 32, 125, 125, 61, 123, 123,
+        32, 118, 97, 108, 32, 125, 125, 32, 123, 123, 32, 105, 102, 32, 123, 123,
+        32, 61, 61, 32, 123, 123, 32, 118, 97, 108, 32, 125, 125, 32, 106, 117,
+        109, 112, 115, 32, 125, 125, 32, 123, 123, 32, 102, 117, 110, 99, 32, 74,
+        32, 125, 125, 32, 123, 123, 32, 102, 117, 110, 99, 32, 78, 32, 125, 125,
+        32, 125, 125, 59, 32, 10, 102, 111, 114, 100, 100, 101, 115, 99, 114, 105,
+        112, 116, 111, 114, 115, 102, 117, 110, 99, 123, 123, 32, 102, 111, 114, 32,
+        101, 32, 123, 123, 32, 108, 105, 115, 116, 32, 49, 32, 50, 32, 125, 125,
+        32, 123, 123, 32, 102, 117, 110, 99, 32, 123, 123, 32, 100, 32, 125, 125,
+        123, 123, 32, 101, 32, 125, 125, 32, 125, 125, 32, 125, 125, 32, 10, 102,
+        111, 114, 107, 101, 121, 118, 97, 108, 100, 105, 99, 116, 97, 49, 98, 50,
+        102, 117, 110, 99, 123, 123, 32, 107, 101, 121, 32, 125, 125, 58, 123, 123,
+        32, 118, 97, 108, 32, 125, 125, 32, 10, 102, 111, 114, 105, 114, 97, 110,
+        103, 101, 51, 102, 117, 110, 99, 123, 123, 32, 105, 32, 125, 125, 44, 32,
+        10, 102, 111, 114, 105, 114, 97, 110, 103, 101, 49, 48, 48, 45, 51, 102,
+        117, 110, 99, 123, 123, 32, 105, 32, 125, 125, 32, 10, 102, 111, 114, 114,
+        111, 119, 114, 111, 119, 115, 102, 117, 110, 99, 60, 123, 123, 32, 114, 111,
+        119, 32, 125, 125, 62, 32, 10, 102, 111, 114, 107, 101, 121, 118, 97, 108,
+        112, 114, 111, 100, 117, 99, 116, 102, 117, 110, 99, 123, 123, 32, 107, 101,
+        121, 32, 125, 125, 61, 123, 123, 32, 118, 97, 108, 32, 125, 125, 32, 10,
+        102, 111, 114, 112, 112, 114, 111, 100, 117, 99, 116, 115, 102, 117, 110, 99,
+        123, 123, 32, 97, 116, 32, 123, 123, 32, 112, 32, 125, 125, 32, 110, 97,
+        109, 101, 32, 125, 125, 58, 123, 123, 32, 97, 116, 32, 123, 123, 32, 112,
+        32, 125, 125, 32, 112, 114, 105, 99, 101, 32, 125, 125, 32, 10, 117, 112,
+        112, 101, 114, 102, 111, 114, 105, 116, 100, 101, 115, 99, 114, 105, 112, 116,
+        111, 114, 115, 102, 117, 110, 99, 123, 123, 32, 105, 116, 32, 125, 125, 32,
+        10, 91, 105, 116, 93, 32, 107, 101, 121, 61, 118, 97, 108, 32, 105, 102,
+        61, 61, 118, 97, 108, 106, 117, 109, 112, 115, 102, 117, 110, 99, 74, 32,
+        102, 117, 110, 99, 78, 32, 59, 32, 102, 111, 114, 101, 108, 105, 115, 116,
+        49, 50, 102, 117, 110, 99, 123, 123, 32, 100, 32, 125, 125, 123, 123, 32,
+        101, 32, 125, 125, 32, 32, 107, 101, 121, 58, 118, 97, 108, 32, 105, 44,
+        32, 105, 32, 60, 114, 111, 119, 62, 32, 107, 101, 121, 61, 118, 97, 108,
+        32, 97, 116, 112, 110, 97, 109, 101, 58, 97, 116, 112, 112, 114, 105, 99,
+        101, 32, 105, 116, 32, 74, 32, 78, 32, 100, 101, 32, 0,
+    };
+
+    // Symbols of the called functions, interned on the first render
+    UTTE::Symbol symbols[22];
+    std::once_flag symbolsFlag;
+
+    void resolveSymbols() noexcept
+    {
+        symbols[0] = UTTE::SymbolTable::intern(utte_string_view(literals + 5, 11));
+        symbols[1] = UTTE::SymbolTable::intern(utte_string_view(literals + 16, 4));
+        symbols[2] = UTTE::SymbolTable::intern(utte_string_view(literals + 0, 3));
+        symbols[3] = UTTE::SymbolTable::intern(utte_string_view(literals + 41, 7));
+        symbols[4] = UTTE::SymbolTable::intern(utte_string_view(literals + 216, 4));
+        symbols[5] = UTTE::SymbolTable::intern(utte_string_view(literals + 253, 5));
+        symbols[6] = UTTE::SymbolTable::intern(utte_string_view(literals + 306, 4));
+        symbols[7] = UTTE::SymbolTable::intern(utte_string_view(literals + 336, 7));
+        symbols[8] = UTTE::SymbolTable::intern(utte_string_view(literals + 372, 8));
+        symbols[9] = UTTE::SymbolTable::intern(utte_string_view(literals + 430, 5));
+        symbols[10] = UTTE::SymbolTable::intern(utte_string_view(literals + 466, 2));
+        symbols[11] = UTTE::SymbolTable::intern(utte_string_view(literals + 470, 3));
+        symbols[12] = UTTE::SymbolTable::intern(utte_string_view(literals + 474, 3));
+        symbols[13] = UTTE::SymbolTable::intern(utte_string_view(literals + 480, 2));
+        symbols[14] = UTTE::SymbolTable::intern(utte_string_view(literals + 478, 2));
+        symbols[15] = UTTE::SymbolTable::intern(utte_string_view(literals + 508, 4));
+        symbols[16] = UTTE::SymbolTable::intern(utte_string_view(literals + 542, 1));
+        symbols[17] = UTTE::SymbolTable::intern(utte_string_view(literals + 548, 3));
+        symbols[18] = UTTE::SymbolTable::intern(utte_string_view(literals + 563, 1));
+        symbols[19] = UTTE::SymbolTable::intern(utte_string_view(literals + 561, 2));
+        symbols[20] = UTTE::SymbolTable::intern(utte_string_view(literals + 585, 1));
+        symbols[21] = UTTE::SymbolTable::intern(utte_string_view(literals + 586, 1));
+    }
+
+    UTTE::ParseResultStatus body1(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body2(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body3(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body4(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body5(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body6(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body7(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body8(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body9(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body10(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body11(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body12(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body13(UTTE::Context& context, utte_string& sink) noexcept;
+}
+
+UTTE::ParseResultStatus loops::render(UTTE::Context& context, utte_string& sink) noexcept
+{
+    std::call_once(symbolsFlag, resolveSymbols);
+    context.frame();
+    context.push(utte_string_view(literals + 0, 3));
+    context.push(utte_string_view(literals + 3, 2));
+    context.frame();
+    context.push(utte_string_view(literals + 5, 11));
+    if (auto status = context.call(symbols[0], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 16, 4));
+    context.push(utte_string_view(literals + 20, 11), body1);
+    if (auto status = context.call(symbols[1], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[2], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 31, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 32, 3));
+    context.push(utte_string_view(literals + 35, 3));
+    context.push(utte_string_view(literals + 38, 3));
+    context.frame();
+    context.push(utte_string_view(literals + 41, 7));
+    if (auto status = context.call(symbols[3], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 48, 4));
+    context.push(utte_string_view(literals + 52, 81), body2);
+    if (auto status = context.call(symbols[1], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[2], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 133, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 134, 3));
+    context.push(utte_string_view(literals + 137, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 138, 11));
+    if (auto status = context.call(symbols[0], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 149, 4));
+    context.push(utte_string_view(literals + 153, 53), body3);
+    if (auto status = context.call(symbols[1], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[2], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 206, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 207, 3));
+    context.push(utte_string_view(literals + 210, 3));
+    context.push(utte_string_view(literals + 213, 3));
+    context.frame();
+    context.push(utte_string_view(literals + 216, 4));
+    context.push(utte_string_view(literals + 220, 1));
+    context.push(utte_string_view(literals + 221, 1));
+    context.push(utte_string_view(literals + 222, 1));
+    context.push(utte_string_view(literals + 223, 1));
+    if (auto status = context.call(symbols[4], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 224, 4));
+    context.push(utte_string_view(literals + 228, 20), body4);
+    if (auto status = context.call(symbols[1], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[2], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 248, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 249, 3));
+    context.push(utte_string_view(literals + 252, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 253, 5));
+    context.push(utte_string_view(literals + 258, 1));
+    if (auto status = context.call(symbols[5], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 259, 4));
+    context.push(utte_string_view(literals + 263, 9), body5);
+    if (auto status = context.call(symbols[1], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[2], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 272, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 273, 3));
+    context.push(utte_string_view(literals + 276, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 277, 5));
+    context.push(utte_string_view(literals + 282, 2));
+    context.push(utte_string_view(literals + 284, 1));
+    context.push(utte_string_view(literals + 285, 2));
+    if (auto status = context.call(symbols[5], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 287, 4));
+    context.push(utte_string_view(literals + 291, 8), body6);
+    if (auto status = context.call(symbols[1], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[2], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 299, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 300, 3));
+    context.push(utte_string_view(literals + 303, 3));
+    context.frame();
+    context.push(utte_string_view(literals + 306, 4));
+    if (auto status = context.call(symbols[6], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 310, 4));
+    context.push(utte_string_view(literals + 314, 12), body7);
+    if (auto status = context.call(symbols[1], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[2], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 326, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 327, 3));
+    context.push(utte_string_view(literals + 330, 3));
+    context.push(utte_string_view(literals + 333, 3));
+    context.frame();
+    context.push(utte_string_view(literals + 336, 7));
+    if (auto status = context.call(symbols[7], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 343, 4));
+    context.push(utte_string_view(literals + 347, 20), body8);
+    if (auto status = context.call(symbols[1], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[2], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 367, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 368, 3));
+    context.push(utte_string_view(literals + 371, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 372, 8));
+    if (auto status = context.call(symbols[8], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 380, 4));
+    context.push(utte_string_view(literals + 384, 45), body9);
+    if (auto status = context.call(symbols[1], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[2], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 429, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 430, 5));
+    context.frame();
+    context.push(utte_string_view(literals + 435, 3));
+    context.push(utte_string_view(literals + 438, 2));
+    context.frame();
+    context.push(utte_string_view(literals + 440, 11));
+    if (auto status = context.call(symbols[0], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 451, 4));
+    context.push(utte_string_view(literals + 455, 9), body10);
+    if (auto status = context.call(symbols[1], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[2], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[9], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 464, 1));
+    return context.end(sink);
+}
+
+namespace
+{
+    UTTE::ParseResultStatus body1(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 465, 1));
+        context.frame();
+        context.push(utte_string_view(literals + 466, 2));
+        if (auto status = context.call(symbols[10], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 468, 2));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body2(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        context.frame();
+        context.push(utte_string_view(literals + 470, 3));
+        if (auto status = context.call(symbols[11], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 473, 1));
+        context.frame();
+        context.push(utte_string_view(literals + 474, 3));
+        if (auto status = context.call(symbols[12], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 477, 1));
+        context.frame();
+        context.push(utte_string_view(literals + 478, 2));
+        context.frame();
+        context.push(utte_string_view(literals + 480, 2));
+        context.frame();
+        context.push(utte_string_view(literals + 482, 3));
+        if (auto status = context.call(symbols[12], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        context.push(utte_string_view(literals + 485, 5));
+        if (auto status = context.call(symbols[13], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        context.frame();
+        context.push(utte_string_view(literals + 490, 4));
+        context.push(utte_string_view(literals + 494, 2), body11);
+        if (auto status = context.call(symbols[1], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        context.frame();
+        context.push(utte_string_view(literals + 496, 4));
+        context.push(utte_string_view(literals + 500, 2), body12);
+        if (auto status = context.call(symbols[1], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        if (auto status = context.call(symbols[14], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 502, 2));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body3(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        context.frame();
+        context.push(utte_string_view(literals + 504, 3));
+        context.push(utte_string_view(literals + 507, 1));
+        context.frame();
+        context.push(utte_string_view(literals + 508, 4));
+        context.push(utte_string_view(literals + 512, 1));
+        context.push(utte_string_view(literals + 513, 1));
+        if (auto status = context.call(symbols[15], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        context.frame();
+        context.push(utte_string_view(literals + 514, 4));
+        context.push(utte_string_view(literals + 518, 15), body13);
+        if (auto status = context.call(symbols[1], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        if (auto status = context.call(symbols[2], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 533, 1));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body4(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        context.frame();
+        context.push(utte_string_view(literals + 534, 3));
+        if (auto status = context.call(symbols[11], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 537, 1));
+        context.frame();
+        context.push(utte_string_view(literals + 538, 3));
+        if (auto status = context.call(symbols[12], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 541, 1));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body5(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        context.frame();
+        context.push(utte_string_view(literals + 542, 1));
+        if (auto status = context.call(symbols[16], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 543, 2));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body6(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        context.frame();
+        context.push(utte_string_view(literals + 545, 1));
+        if (auto status = context.call(symbols[16], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 546, 1));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body7(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 547, 1));
+        context.frame();
+        context.push(utte_string_view(literals + 548, 3));
+        if (auto status = context.call(symbols[17], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 551, 2));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body8(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        context.frame();
+        context.push(utte_string_view(literals + 553, 3));
+        if (auto status = context.call(symbols[11], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 556, 1));
+        context.frame();
+        context.push(utte_string_view(literals + 557, 3));
+        if (auto status = context.call(symbols[12], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 560, 1));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body9(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        context.frame();
+        context.push(utte_string_view(literals + 561, 2));
+        context.frame();
+        context.push(utte_string_view(literals + 563, 1));
+        if (auto status = context.call(symbols[18], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        context.push(utte_string_view(literals + 564, 4));
+        if (auto status = context.call(symbols[19], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 568, 1));
+        context.frame();
+        context.push(utte_string_view(literals + 569, 2));
+        context.frame();
+        context.push(utte_string_view(literals + 571, 1));
+        if (auto status = context.call(symbols[18], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        context.push(utte_string_view(literals + 572, 5));
+        if (auto status = context.call(symbols[19], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 577, 1));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body10(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        context.frame();
+        context.push(utte_string_view(literals + 578, 2));
+        if (auto status = context.call(symbols[10], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 580, 1));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body11(UTTE::Context&, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 581, 2));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body12(UTTE::Context&, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 583, 2));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body13(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        context.frame();
+        context.push(utte_string_view(literals + 585, 1));
+        if (auto status = context.call(symbols[20], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        context.frame();
+        context.push(utte_string_view(literals + 586, 1));
+        if (auto status = context.call(symbols[21], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 587, 1));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+}
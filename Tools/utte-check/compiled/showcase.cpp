@@ -0,0 +1,472 @@
+// Generated by utte-compile, do not edit
+#include "Context.hpp"
+#include <mutex>
+
+namespace showcase
+{
+    UTTE::ParseResultStatus render(UTTE::Context& context, utte_string& sink) noexcept;
+}
+
+namespace
+{
+    const char literals[] =
+    {
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 32, 83, 84, 82, 73, 78, 71, 32, 82, 69, 80, 76, 65, 67,
+        69, 77, 69, 78, 84, 32, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 10, 10, 84, 104, 101, 32, 97, 116,
+        100, 101, 115, 99, 114, 105, 112, 116, 111, 114, 115, 48, 32, 99, 111, 108,
+        111, 117, 114, 32, 102, 111, 120, 32, 97, 116, 97, 99, 116, 105, 111, 110,
+        115, 97, 49, 32, 111, 118, 101, 114, 32, 116, 104, 101, 32, 97, 116, 100,
+        101, 115, 99, 114, 105, 112, 116, 111, 114, 115, 49, 32, 100, 111, 103, 10,
+        10, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 32, 70, 79, 82, 32, 76, 79, 79, 80,
+        83, 32, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 10, 10, 65, 114, 114, 97, 121,
+        115, 58, 32, 102, 111, 114, 105, 116, 100, 101, 115, 99, 114, 105, 112, 116,
+        111, 114, 115, 102, 117, 110, 99, 84, 104, 105, 115, 32, 105, 115, 32, 123,
+        123, 32, 105, 116, 32, 125, 125, 10, 10, 10, 77, 97, 112, 115, 58, 32,
+        102, 111, 114, 107, 101, 121, 118, 97, 108, 97, 99, 116, 105, 111, 110, 115,
+        102, 117, 110, 99, 75, 101, 121, 58, 32, 123, 123, 32, 107, 101, 121, 32,
+        125, 125, 10, 86, 97, 108, 117, 101, 58, 32, 123, 123, 32, 118, 97, 108,
+        32, 125, 125, 10, 10, 10, 65, 114, 114, 97, 121, 115, 32, 117, 115, 105,
+        110, 103, 32, 116, 104, 101, 32, 108, 105, 115, 116, 32, 102, 117, 110, 99,
+        116, 105, 111, 110, 58, 32, 102, 111, 114, 105, 116, 108, 105, 115, 116, 97,
+        98, 99, 102, 117, 110, 99, 123, 123, 32, 105, 116, 32, 125, 125, 32, 10,
+        77, 97, 112, 115, 32, 117, 115, 105, 110, 103, 32, 116, 104, 101, 32, 100,
+        105, 99, 116, 32, 102, 117, 110, 99, 116, 105, 111, 110, 58, 32, 102, 111,
+        114, 107, 101, 121, 118, 97, 108, 100, 105, 99, 116, 97, 98, 99, 100, 101,
+        102, 117, 110, 99, 123, 123, 32, 107, 101, 121, 32, 125, 125, 58, 123, 123,
+        32, 118, 97, 108, 32, 125, 125, 32, 10, 10, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 32,
+        73, 70, 32, 83, 84, 65, 84, 69, 77, 69, 78, 84, 83, 32, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 10, 10, 105, 102, 61, 61, 118, 97, 108, 117, 101, 116, 101, 115,
+        116, 102, 117, 110, 99, 123, 123, 32, 116, 101, 115, 116, 95, 118, 97, 108,
+        32, 125, 125, 32, 102, 117, 110, 99, 123, 123, 32, 110, 111, 116, 95, 116,
+        101, 115, 116, 95, 118, 97, 108, 32, 125, 125, 32, 10, 10, 115, 119, 105,
+        116, 99, 104, 118, 97, 108, 117, 101, 116, 101, 115, 116, 102, 117, 110, 99,
+        123, 123, 32, 116, 101, 115, 116, 95, 118, 97, 108, 32, 125, 125, 32, 101,
+        120, 97, 109, 112, 108, 101, 102, 117, 110, 99, 123, 123, 32, 101, 120, 97,
+        109, 112, 108, 101, 95, 118, 97, 108, 32, 125, 125, 32, 102, 117, 110, 99,
+        123, 123, 32, 102, 97, 108, 108, 98, 97, 99, 107, 95, 118, 97, 108, 32,
+        125, 125, 32, 10, 10, 99, 111, 110, 100, 61, 61, 118, 97, 108, 117, 101,
+        116, 101, 115, 116, 102, 117, 110, 99, 123, 123, 32, 116, 101, 115, 116, 95,
+        118, 97, 108, 32, 125, 125, 32, 61, 61, 118, 97, 108, 117, 101, 101, 120,
+        97, 109, 112, 108, 101, 102, 117, 110, 99, 123, 123, 32, 101, 120, 97, 109,
+        112, 108, 101, 95, 118, 97, 108, 32, 125, 125, 32, 102, 117, 110, 99, 123,
+        123, 32, 102, 97, 108, 108, 98, 97, 99, 107, 95, 118, 97, 108, 32, 125,
+        125, 32, 10, 10, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 32, 82, 65, 87, 32, 84, 69,
+        77, 80, 76, 65, 84, 69, 83, 32, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 10, 10, 114, 97,
+        119, 123, 123, 32, 102, 111, 114, 32, 97, 32, 97, 114, 114, 10, 32, 32,
+        32, 32, 123, 123, 32, 102, 117, 110, 99, 10, 32, 32, 32, 32, 32, 32,
+        32, 32, 123, 123, 32, 97, 32, 125, 125, 10, 32, 32, 32, 32, 125, 125,
+        10, 125, 125, 10, 10, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 32,
+        69, 78, 68, 32, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 10, 84, 104,
+        105, 115, 32, 105, 115, 32, 105, 116, 10, 75, 101, 121, 58, 32, 107, 101,
+        121, 10, 86, 97, 108, 117, 101, 58, 32, 118, 97, 108, 10, 105, 116, 32,
+        107, 101, 121, 58, 118, 97, 108, 32, 116, 101, 115, 116, 95, 118, 97, 108,
+        32, 110, 111, 116, 95, 116, 101, 115, 116, 95, 118, 97, 108, 32, 116, 101,
+        115, 116, 95, 118, 97, 108, 32, 101, 120, 97, 109, 112, 108, 101, 95, 118,
+        97, 108, 32, 102, 97, 108, 108, 98, 97, 99, 107, 95, 118, 97, 108, 32,
+        116, 101, 115, 116, 95, 118, 97, 108, 32, 101, 120, 97, 109, 112, 108, 101,
+        95, 118, 97, 108, 32, 102, 97, 108, 108, 98, 97, 99, 107, 95, 118, 97,
+        108, 32, 0,
+    };
+
+    // Symbols of the called functions, interned on the first render
+    UTTE::Symbol symbols[21];
+    std::once_flag symbolsFlag;
+
+    void resolveSymbols() noexcept
+    {
+        symbols[0] = UTTE::SymbolTable::intern(utte_string_view(literals + 128, 11));
+        symbols[1] = UTTE::SymbolTable::intern(utte_string_view(literals + 126, 2));
+        symbols[2] = UTTE::SymbolTable::intern(utte_string_view(literals + 141, 6));
+        symbols[3] = UTTE::SymbolTable::intern(utte_string_view(literals + 154, 7));
+        symbols[4] = UTTE::SymbolTable::intern(utte_string_view(literals + 339, 4));
+        symbols[5] = UTTE::SymbolTable::intern(utte_string_view(literals + 323, 3));
+        symbols[6] = UTTE::SymbolTable::intern(utte_string_view(literals + 459, 4));
+        symbols[7] = UTTE::SymbolTable::intern(utte_string_view(literals + 519, 4));
+        symbols[8] = UTTE::SymbolTable::intern(utte_string_view(literals + 680, 5));
+        symbols[9] = UTTE::SymbolTable::intern(utte_string_view(literals + 678, 2));
+        symbols[10] = UTTE::SymbolTable::intern(utte_string_view(literals + 676, 2));
+        symbols[11] = UTTE::SymbolTable::intern(utte_string_view(literals + 733, 6));
+        symbols[12] = UTTE::SymbolTable::intern(utte_string_view(literals + 821, 4));
+        symbols[13] = UTTE::SymbolTable::intern(utte_string_view(literals + 1038, 3));
+        symbols[14] = UTTE::SymbolTable::intern(utte_string_view(literals + 1222, 2));
+        symbols[15] = UTTE::SymbolTable::intern(utte_string_view(literals + 1230, 3));
+        symbols[16] = UTTE::SymbolTable::intern(utte_string_view(literals + 1241, 3));
+        symbols[17] = UTTE::SymbolTable::intern(utte_string_view(literals + 1256, 8));
+        symbols[18] = UTTE::SymbolTable::intern(utte_string_view(literals + 1265, 12));
+        symbols[19] = UTTE::SymbolTable::intern(utte_string_view(literals + 1287, 11));
+        symbols[20] = UTTE::SymbolTable::intern(utte_string_view(literals + 1299, 12));
+    }
+
+    UTTE::ParseResultStatus body1(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body2(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body3(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body4(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body5(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body6(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body7(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body8(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body9(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body10(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body11(UTTE::Context& context, utte_string& sink) noexcept;
+    UTTE::ParseResultStatus body12(UTTE::Context& context, utte_string& sink) noexcept;
+}
+
+UTTE::ParseResultStatus showcase::render(UTTE::Context& context, utte_string& sink) noexcept
+{
+    std::call_once(symbolsFlag, resolveSymbols);
+    sink.append(utte_string_view(literals + 0, 126));
+    context.frame();
+    context.push(utte_string_view(literals + 126, 2));
+    context.frame();
+    context.push(utte_string_view(literals + 128, 11));
+    if (auto status = context.call(symbols[0], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 139, 1));
+    if (auto status = context.call(symbols[1], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 140, 1));
+    context.frame();
+    context.push(utte_string_view(literals + 141, 6));
+    if (auto status = context.call(symbols[2], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 147, 5));
+    context.frame();
+    context.push(utte_string_view(literals + 152, 2));
+    context.frame();
+    context.push(utte_string_view(literals + 154, 7));
+    if (auto status = context.call(symbols[3], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 161, 2));
+    if (auto status = context.call(symbols[1], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 163, 10));
+    context.frame();
+    context.push(utte_string_view(literals + 173, 2));
+    context.frame();
+    context.push(utte_string_view(literals + 175, 11));
+    if (auto status = context.call(symbols[0], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 186, 1));
+    if (auto status = context.call(symbols[1], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 187, 136));
+    context.frame();
+    context.push(utte_string_view(literals + 323, 3));
+    context.push(utte_string_view(literals + 326, 2));
+    context.frame();
+    context.push(utte_string_view(literals + 328, 11));
+    if (auto status = context.call(symbols[0], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 339, 4));
+    context.push(utte_string_view(literals + 343, 17), body1);
+    if (auto status = context.call(symbols[4], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[5], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 360, 8));
+    context.frame();
+    context.push(utte_string_view(literals + 368, 3));
+    context.push(utte_string_view(literals + 371, 3));
+    context.push(utte_string_view(literals + 374, 3));
+    context.frame();
+    context.push(utte_string_view(literals + 377, 7));
+    if (auto status = context.call(symbols[3], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 384, 4));
+    context.push(utte_string_view(literals + 388, 32), body2);
+    if (auto status = context.call(symbols[4], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[5], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 420, 34));
+    context.frame();
+    context.push(utte_string_view(literals + 454, 3));
+    context.push(utte_string_view(literals + 457, 2));
+    context.frame();
+    context.push(utte_string_view(literals + 459, 4));
+    context.push(utte_string_view(literals + 463, 1));
+    context.push(utte_string_view(literals + 464, 1));
+    context.push(utte_string_view(literals + 465, 1));
+    if (auto status = context.call(symbols[6], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 466, 4));
+    context.push(utte_string_view(literals + 470, 9), body3);
+    if (auto status = context.call(symbols[4], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[5], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 479, 31));
+    context.frame();
+    context.push(utte_string_view(literals + 510, 3));
+    context.push(utte_string_view(literals + 513, 3));
+    context.push(utte_string_view(literals + 516, 3));
+    context.frame();
+    context.push(utte_string_view(literals + 519, 4));
+    context.push(utte_string_view(literals + 523, 1));
+    context.push(utte_string_view(literals + 524, 1));
+    context.push(utte_string_view(literals + 525, 1));
+    context.push(utte_string_view(literals + 526, 1));
+    context.push(utte_string_view(literals + 527, 1));
+    if (auto status = context.call(symbols[7], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 528, 4));
+    context.push(utte_string_view(literals + 532, 20), body4);
+    if (auto status = context.call(symbols[4], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[5], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 552, 124));
+    context.frame();
+    context.push(utte_string_view(literals + 676, 2));
+    context.frame();
+    context.push(utte_string_view(literals + 678, 2));
+    context.frame();
+    context.push(utte_string_view(literals + 680, 5));
+    if (auto status = context.call(symbols[8], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 685, 4));
+    if (auto status = context.call(symbols[9], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 689, 4));
+    context.push(utte_string_view(literals + 693, 15), body5);
+    if (auto status = context.call(symbols[4], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 708, 4));
+    context.push(utte_string_view(literals + 712, 19), body6);
+    if (auto status = context.call(symbols[4], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[10], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 731, 2));
+    context.frame();
+    context.push(utte_string_view(literals + 733, 6));
+    context.frame();
+    context.push(utte_string_view(literals + 739, 5));
+    if (auto status = context.call(symbols[8], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 744, 4));
+    context.frame();
+    context.push(utte_string_view(literals + 748, 4));
+    context.push(utte_string_view(literals + 752, 15), body7);
+    if (auto status = context.call(symbols[4], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 767, 7));
+    context.frame();
+    context.push(utte_string_view(literals + 774, 4));
+    context.push(utte_string_view(literals + 778, 18), body8);
+    if (auto status = context.call(symbols[4], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 796, 4));
+    context.push(utte_string_view(literals + 800, 19), body9);
+    if (auto status = context.call(symbols[4], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[11], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 819, 2));
+    context.frame();
+    context.push(utte_string_view(literals + 821, 4));
+    context.frame();
+    context.push(utte_string_view(literals + 825, 2));
+    context.frame();
+    context.push(utte_string_view(literals + 827, 5));
+    if (auto status = context.call(symbols[8], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 832, 4));
+    if (auto status = context.call(symbols[9], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 836, 4));
+    context.push(utte_string_view(literals + 840, 15), body10);
+    if (auto status = context.call(symbols[4], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 855, 2));
+    context.frame();
+    context.push(utte_string_view(literals + 857, 5));
+    if (auto status = context.call(symbols[8], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.push(utte_string_view(literals + 862, 7));
+    if (auto status = context.call(symbols[9], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 869, 4));
+    context.push(utte_string_view(literals + 873, 18), body11);
+    if (auto status = context.call(symbols[4], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    context.frame();
+    context.push(utte_string_view(literals + 891, 4));
+    context.push(utte_string_view(literals + 895, 19), body12);
+    if (auto status = context.call(symbols[4], false, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    if (auto status = context.call(symbols[12], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 914, 124));
+    context.frame();
+    context.push(utte_string_view(literals + 1038, 3));
+    context.push(utte_string_view(literals + 1041, 50));
+    if (auto status = context.call(symbols[13], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+    sink.append(utte_string_view(literals + 1091, 123));
+    return context.end(sink);
+}
+
+namespace
+{
+    UTTE::ParseResultStatus body1(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 1214, 8));
+        context.frame();
+        context.push(utte_string_view(literals + 1222, 2));
+        if (auto status = context.call(symbols[14], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 1224, 1));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body2(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        sink.append(utte_string_view(literals + 1225, 5));
+        context.frame();
+        context.push(utte_string_view(literals + 1230, 3));
+        if (auto status = context.call(symbols[15], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 1233, 8));
+        context.frame();
+        context.push(utte_string_view(literals + 1241, 3));
+        if (auto status = context.call(symbols[16], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 1244, 1));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body3(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        context.frame();
+        context.push(utte_string_view(literals + 1245, 2));
+        if (auto status = context.call(symbols[14], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 1247, 1));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body4(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        context.frame();
+        context.push(utte_string_view(literals + 1248, 3));
+        if (auto status = context.call(symbols[15], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 1251, 1));
+        context.frame();
+        context.push(utte_string_view(literals + 1252, 3));
+        if (auto status = context.call(symbols[16], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 1255, 1));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body5(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        context.frame();
+        context.push(utte_string_view(literals + 1256, 8));
+        if (auto status = context.call(symbols[17], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 1264, 1));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body6(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        context.frame();
+        context.push(utte_string_view(literals + 1265, 12));
+        if (auto status = context.call(symbols[18], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 1277, 1));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body7(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        context.frame();
+        context.push(utte_string_view(literals + 1278, 8));
+        if (auto status = context.call(symbols[17], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 1286, 1));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body8(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        context.frame();
+        context.push(utte_string_view(literals + 1287, 11));
+        if (auto status = context.call(symbols[19], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 1298, 1));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body9(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        context.frame();
+        context.push(utte_string_view(literals + 1299, 12));
+        if (auto status = context.call(symbols[20], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 1311, 1));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body10(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        context.frame();
+        context.push(utte_string_view(literals + 1312, 8));
+        if (auto status = context.call(symbols[17], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 1320, 1));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body11(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        context.frame();
+        context.push(utte_string_view(literals + 1321, 11));
+        if (auto status = context.call(symbols[19], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 1332, 1));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    UTTE::ParseResultStatus body12(UTTE::Context& context, utte_string& sink) noexcept
+    {
+        context.frame();
+        context.push(utte_string_view(literals + 1333, 12));
+        if (auto status = context.call(symbols[20], true, sink); status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+        sink.append(utte_string_view(literals + 1345, 1));
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+}
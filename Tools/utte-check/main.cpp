@@ -0,0 +1,1180 @@
+// utte-check - checks promises of the engine that rendering a template doesn't show by itself
+// Usage: utte-check [-v] [directory]
+// Runs every check and fails if any of them fails, so that it can be run on every change. "-v" prints the checks that
+// pass as well. Checks that compare the ways of rendering a template use the templates in the "corpus" directory, and
+// the C++ code generated from them in the "compiled" directory, which has to be built with this file. Both are looked
+// up in the given directory, which defaults to the one this file is in
+#include "Client.hpp"
+#include "Context.hpp"
+#include "FlatMap.hpp"
+#include "GeneratorPool.hpp"
+#include "PartialCache.hpp"
+#include "Snapshot.hpp"
+#include "Transpiler.hpp"
+#include "UTF8.hpp"
+#include "Watch.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <thread>
+#ifdef __linux__
+    #include <sys/socket.h>
+    #include <sys/un.h>
+    #include <unistd.h>
+#endif
+
+struct Check
+{
+    const char* name;
+    bool(*run)();
+};
+
+struct Product
+{
+    utte_string name;
+    int price;
+};
+
+// Limits the corpus is rendered with, so that the ways of rendering a template are compared on failures as well
+struct Limits
+{
+    const char* name;
+    size_t maxDepth;
+    UTTE::RenderBudget budget;
+};
+
+// A template in "corpus", along with the render function generated from it in "compiled" with
+// "utte-compile corpus/<name>.tmpl compiled/<name>.cpp", which is built with this file
+struct CorpusTemplate
+{
+    const char* name;
+    UTTE::RenderFunc* compiled;
+};
+
+namespace showcase { UTTE::ParseResultStatus render(UTTE::Context& context, utte_string& sink) noexcept; }
+namespace control { UTTE::ParseResultStatus render(UTTE::Context& context, utte_string& sink) noexcept; }
+namespace loops { UTTE::ParseResultStatus render(UTTE::Context& context, utte_string& sink) noexcept; }
+namespace include { UTTE::ParseResultStatus render(UTTE::Context& context, utte_string& sink) noexcept; }
+namespace collections { UTTE::ParseResultStatus render(UTTE::Context& context, utte_string& sink) noexcept; }
+
+static std::filesystem::path directory = std::filesystem::path(__FILE__).parent_path();
+static const CorpusTemplate corpusTemplates[] = {
+    { "showcase", showcase::render },
+    { "control", control::render },
+    { "loops", loops::render },
+    { "include", include::render },
+    { "collections", collections::render },
+};
+
+static const Limits corpusLimits[] = {
+    { "defaults", 128, {} },
+    { "max depth 2", 2, {} },
+    { "20 expressions", 128, { .expressions = 20 } },
+    { "3 iterations", 128, { .iterations = 3 } },
+    { "64 output bytes", 128, { .outputBytes = 64 } },
+};
+
+// Nests a loop in a body and makes a list, so it needs more than one level of depth, expression and scratch byte
+static const char* nestedSource = "{{ if {{ == a a }} {{ func {{ for it {{ list x y }} {{ func <{{ it }}> }} }} }} {{ func none }} }}";
+
+// A generator returned to a pool and acquired again has the default settings, not the ones of its previous user
+static bool checkPoolDefaults()
+{
+    UTTE::GeneratorPool pool(1);
+    UTTE::Generator* first = nullptr;
+    {
+        auto generator = pool.acquire();
+        first = generator.get();
+        generator->setBudget({ .milliseconds = 1, .expressions = 1, .iterations = 1, .outputBytes = 1 });
+        generator->setMaxDepth(1);
+        generator->setScratchLimit(1);
+        generator->setUTF8Mode(UTTE_UTF8_MODE_VALIDATE);
+        generator->setMemoCapacity(0, true);
+    }
+
+    auto generator = pool.acquire();
+    if (generator.get() != first)
+        return false;
+
+    UTTE::Generator fresh;
+    fresh.loadFromString(nestedSource);
+    auto expected = fresh.render();
+
+    generator->loadFromString(nestedSource);
+    auto rendered = generator->render();
+    auto parsed = generator->parse();
+    if (rendered.status != UTTE_PARSE_STATUS_SUCCESS || *rendered.result != *expected.result || parsed.status != UTTE_PARSE_STATUS_SUCCESS
+        || *parsed.result != *expected.result)
+        return false;
+
+    // Invalid UTF-8 is only reported when a mode other than the default is set
+    return generator->loadFromString("\xff") == UTTE_INITIALISATION_RESULT_SUCCESS;
+}
+
+// Renders a template with "render" and "parse" into "out" and "status", and returns whether they agree. "render" goes
+// first, because "parse" modifies the loaded template
+static bool renderBoth(UTTE::Generator& generator, const utte_string& source, UTTE::ParseResultStatus& status, utte_string& out) noexcept
+{
+    generator.loadFromString(source);
+    auto rendered = generator.render();
+    status = rendered.status;
+    out = *rendered.result;
+
+    auto parsed = generator.parse();
+    return parsed.status == status && (status != UTTE_PARSE_STATUS_SUCCESS || *parsed.result == out);
+}
+
+// A generator returned to a pool and acquired again has none of the template, variables and functions of its previous
+// user, and the builtins it replaced are restored, so it renders like a new generator
+static bool checkPoolReset()
+{
+    static const char* source = "{{ colour }}|{{ shout a }}|{{ at {{ list a b }} 1 }}";
+
+    UTTE::GeneratorPool pool(1);
+    UTTE::Generator* first = nullptr;
+    {
+        auto generator = pool.acquire();
+        first = generator.get();
+        generator->pushVariable({ .value = "brown" }, "colour");
+        generator->pushFunction({ .name = "shout", .function = [](std::vector<UTTE::Variable>&, UTTE::Generator*) -> UTTE::Variable
+        {
+            return { .value = "A" };
+        }});
+        generator->setFunction("at", [](std::vector<UTTE::Variable>&, UTTE::Generator*) -> UTTE::Variable
+        {
+            return { .value = "replaced" };
+        });
+        generator->loadFromString(source);
+        if (*generator->render().result != "brown|A|replaced")
+            return false;
+    }
+
+    auto generator = pool.acquire();
+    if (generator.get() != first || !generator->render().result->empty())
+        return false;
+
+    UTTE::Generator fresh;
+    UTTE::ParseResultStatus expectedStatus;
+    UTTE::ParseResultStatus status;
+    utte_string expected;
+    utte_string out;
+    if (!renderBoth(fresh, source, expectedStatus, expected) || !renderBoth(*generator, source, status, out))
+        return false;
+    if (status != expectedStatus || out != expected)
+        return false;
+
+    // A generator taken out of its handle goes back with "release", and is reset as well
+    auto* released = generator.release();
+    released->pushVariable({ .value = "brown" }, "colour");
+    pool.release(released);
+    generator = pool.acquire();
+    return generator.get() == released && renderBoth(*generator, source, status, out) && status == expectedStatus && out == expected;
+}
+
+// FlatMap finds every key, by value and by view, after growing and erasing, and iterates in insertion order. "at" on
+// a bound map finds every key of the map, whichever map utte_map is, and "for" iterates it in the map's own order
+static bool checkMaps()
+{
+    UTTE::FlatMap<utte_string, utte_string> flat;
+    std::vector<utte_string> order;
+    for (size_t i = 0; i < 1000; i++)
+    {
+        auto key = "k" + std::to_string(i * 7919 % 1000);
+        order.push_back(key);
+        if (!flat.emplace(key, std::to_string(i)).second)
+            return false;
+    }
+    if (flat.insert({ order[0], "again" }).second || flat.find(order[0])->second != "0")
+        return false;
+
+    for (size_t i = 0; i < order.size(); i += 2)
+        flat.erase(order[i]);
+    size_t i = 1;
+    for (auto& a : flat)
+    {
+        if (a.first != order[i] || a.second != std::to_string(i) || flat.find(utte_string_view(order[i])) == flat.end())
+            return false;
+        i += 2;
+    }
+    if (i != order.size() + 1 || flat.contains(order[0]) || flat.size() != order.size() / 2)
+        return false;
+
+    utte_map<utte_string, utte_string> map;
+    for (size_t j = 0; j < 1000; j++)
+        map.emplace("k" + std::to_string(j * 7919 % 1000), std::to_string(j));
+    UTTE::Generator generator;
+    generator.pushVariable(UTTE::Generator::makeMap(map), "map");
+
+    UTTE::ParseResultStatus status;
+    utte_string out;
+    utte_string expected;
+    for (auto& a : map)
+    {
+        if (!renderBoth(generator, "{{ at {{ map }} " + a.first + " }}", status, out) || status != UTTE_PARSE_STATUS_SUCCESS || out != a.second)
+            return false;
+        expected += a.first + "=" + a.second + ",";
+    }
+    return renderBoth(generator, "{{ at {{ map }} missing }}", status, out) && status == UTTE_PARSE_STATUS_OUT_OF_BOUNDS
+        && renderBoth(generator, "{{ for key val {{ map }} {{ func {{ key }}={{ val }},}} }}", status, out) && out == expected;
+}
+
+// Variables in a scope big enough to be indexed are found by name, setVariable updates a value in place, and a
+// variable renamed through the functions registry, or turned into a function, is still found
+static bool checkVariables()
+{
+    UTTE::Generator generator;
+    for (size_t i = 0; i < 100; i++)
+        generator.pushVariable({ .value = "value " + std::to_string(i) + " of the variables in the store" }, "v" + std::to_string(i));
+    auto& functions = generator.getFunctionsRegistry();
+    auto* variables = &functions[functions.size() - 100];
+
+    UTTE::ParseResultStatus status;
+    utte_string out;
+    if (!renderBoth(generator, "{{ v0 }}|{{ v50 }}|{{ v99 }}", status, out) || out != "value 0 of the variables in the store|value 50 of the variables in the store|value 99 of the variables in the store")
+        return false;
+
+    const char* data = variables[50].variable.value.data();
+    if (!generator.setVariable("v50", { .value = "updated" }) || variables[50].variable.value.data() != data)
+        return false;
+
+    variables[99].name = "renamed";
+    variables[99].symbol = UTTE::UTTE_SYMBOL_INVALID;
+    generator.setFunction("v0", [](std::vector<UTTE::Variable>&, UTTE::Generator*) -> UTTE::Variable
+    {
+        return { .value = "function" };
+    });
+    return renderBoth(generator, "{{ v0 }}|{{ v50 }}|{{ renamed }}", status, out)
+        && out == "function|updated|value 99 of the variables in the store";
+}
+
+// Completes the I/O of async functions in the reverse order it was started, once nothing else can run, so that their
+// results arrive out of document order
+class ReversingExecutor final : public UTTE::Executor
+{
+public:
+    void post(std::coroutine_handle<> handle) noexcept override
+    {
+        ready.push_back(handle);
+    }
+
+    bool runOnce() noexcept override
+    {
+        std::coroutine_handle<> handle;
+        if (!ready.empty())
+        {
+            handle = ready.front();
+            ready.pop_front();
+        }
+        else if (!io.empty())
+        {
+            maxInFlight = std::max(maxInFlight, io.size());
+            handle = io.back();
+            io.pop_back();
+        }
+        else
+            return false;
+
+        handle.resume();
+        return true;
+    }
+
+    // Suspends the calling coroutine until its I/O completes
+    auto read() noexcept
+    {
+        struct Awaiter
+        {
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> handle) noexcept { executor.io.push_back(handle); }
+            void await_resume() const noexcept {}
+
+            ReversingExecutor& executor;
+        };
+        return Awaiter{ *this };
+    }
+
+    size_t maxInFlight = 0;
+private:
+    std::deque<std::coroutine_handle<>> ready;
+    std::vector<std::coroutine_handle<>> io;
+};
+
+// Returns its arguments in angle brackets once its I/O completes
+static UTTE::Task<UTTE::Variable> fetch(std::vector<UTTE::Variable> args, UTTE::Generator* generator)
+{
+    auto* executor = generator->getExecutor();
+    if (auto* reversing = dynamic_cast<ReversingExecutor*>(executor))
+        co_await reversing->read();
+    else
+        co_await executor->yield();
+
+    utte_string result = "<";
+    for (size_t i = 1; i < args.size(); i++)
+        result += args[i].value;
+    co_return UTTE::Variable{ .value = result + ">" };
+}
+
+// renderAsync starts the calls of async functions before awaiting any of them, and puts their results in document
+// order, whatever order they complete in. Results that are arguments of other calls and errors are awaited like
+// "render" does
+static bool checkAsync()
+{
+    static const char* source = "a {{ fetch x }} b {{ fetch y z }} c {{ fetch {{ fetch n }} }} {{ for i {{ list 1 2 3 }} {{ func [{{ fetch {{ i }} }}] }} }} d";
+
+    UTTE::Generator generator;
+    generator.pushFunction({ .name = "fetch", .asyncFunction = fetch });
+    generator.pushFunction({ .name = "fail", .asyncFunction = [](std::vector<UTTE::Variable>, UTTE::Generator* generator) -> UTTE::Task<UTTE::Variable>
+    {
+        co_await generator->getExecutor()->yield();
+        co_return UTTE::Variable{ .status = UTTE_PARSE_STATUS_INVALID_VALUE };
+    }});
+
+    UTTE::ParseResultStatus status;
+    utte_string expected;
+    if (!renderBoth(generator, source, status, expected) || status != UTTE_PARSE_STATUS_SUCCESS)
+        return false;
+
+    ReversingExecutor executor;
+    auto task = generator.renderAsync(executor);
+    if (!task.wait(executor) || task.result().status != UTTE_PARSE_STATUS_SUCCESS || *task.result().result != expected
+        || executor.maxInFlight < 2)
+        return false;
+
+    generator.loadFromString("a {{ fetch x }} {{ fail }} b");
+    auto failed = generator.renderAsync(executor);
+    return failed.wait(executor) && failed.result().status == UTTE_PARSE_STATUS_INVALID_VALUE;
+}
+
+// Nests "count" calls to "length" in each other
+static utte_string nestLengths(size_t count) noexcept
+{
+    utte_string result;
+    for (size_t i = 0; i < count; i++)
+        result += "{{ length ";
+    result += "x";
+    for (size_t i = 0; i < count; i++)
+        result += " }}";
+    return result;
+}
+
+// Every open expression counts against the max depth, so "n" nested expressions need a max depth of exactly "n". A
+// template nested far deeper than the default max depth fails with UTTE_PARSE_STATUS_DEPTH_EXCEEDED instead of
+// overflowing the stack
+static bool checkDepth()
+{
+    UTTE::ParseResultStatus status;
+    utte_string out;
+    for (size_t nesting = 1; nesting <= 6; nesting++)
+    {
+        for (size_t maxDepth = 1; maxDepth <= 7; maxDepth++)
+        {
+            UTTE::Generator generator;
+            generator.setMaxDepth(maxDepth);
+            if (!renderBoth(generator, nestLengths(nesting), status, out)
+                || status != (maxDepth < nesting ? UTTE_PARSE_STATUS_DEPTH_EXCEEDED : UTTE_PARSE_STATUS_SUCCESS))
+                return false;
+        }
+    }
+
+    UTTE::Generator generator;
+    return renderBoth(generator, nestLengths(20000), status, out) && status == UTTE_PARSE_STATUS_DEPTH_EXCEEDED;
+}
+
+// Results of pure functions are cached within and across renders, until the function is replaced, the cache is set to
+// be cleared on every render, or they are evicted. Calls with arrays as arguments are never cached
+static bool checkMemo()
+{
+    static size_t calls = 0;
+    static const char* source = "{{ slow a }}|{{ slow a }}|{{ slow b }}";
+
+    UTTE::Generator generator;
+    generator.pushFunction({ .name = "slow", .function = [](std::vector<UTTE::Variable>& args, UTTE::Generator*) -> UTTE::Variable
+    {
+        ++calls;
+        return { .value = "<" + args[1].value + ">" };
+    }, .bPure = true });
+
+    generator.loadFromString(source);
+    for (size_t i = 0; i < 2; i++)
+    {
+        auto result = generator.render();
+        if (result.status != UTTE_PARSE_STATUS_SUCCESS || *result.result != "<a>|<a>|<b>" || calls != 2)
+            return false;
+    }
+    auto stats = generator.getMemoStats();
+    if (stats.hits != 4 || stats.misses != 2 || stats.size != 2)
+        return false;
+
+    generator.setFunction("slow", [](std::vector<UTTE::Variable>& args, UTTE::Generator*) -> UTTE::Variable
+    {
+        ++calls;
+        return { .value = "[" + args[1].value + "]" };
+    });
+    generator.getFunctionsRegistry().back().bPure = true;
+    if (*generator.render().result != "[a]|[a]|[b]" || calls != 4)
+        return false;
+
+    generator.setMemoCapacity(16, true);
+    generator.render();
+    if (calls != 6)
+        return false;
+
+    generator.setMemoCapacity(1);
+    generator.render();
+    if (calls != 8 || generator.getMemoStats().size != 1 || generator.getMemoStats().evictions == 0)
+        return false;
+
+    generator.loadFromString("{{ slow {{ list a }} }}|{{ slow {{ list a }} }}");
+    generator.render();
+    return calls == 10;
+}
+
+// Binds the variables and functions used by the templates of the corpus
+static void bindCorpus(UTTE::Generator& generator) noexcept
+{
+    static const std::vector<utte_string> descriptors = { "quick", "lazy" };
+    static const std::vector<utte_string> words = { "pear", "apple", "fig", "kiwi" };
+    static const utte_map<utte_string, utte_string> actions = { { "a1", "jumps" }, { "a2", "runs" } };
+
+    static const std::vector<Product> products = { { "lamp", 20 }, { "desk", 150 } };
+    static const UTTE::ObjectType productType = []() -> UTTE::ObjectType
+    {
+        UTTE::ObjectType type;
+        type.field("name", &Product::name).field("price", &Product::price);
+        return type;
+    }();
+    static const UTTE::Sequence productSequence = productType.sequence(products);
+
+    static const utte_string rowValues[] = { "r1", "r2", "r3" };
+    static size_t row = 0;
+    static const UTTE::Sequence rows = {
+        .begin = []() -> void { row = 0; },
+        .next = [](UTTE::VariableView& element) -> bool
+        {
+            if (row == std::size(rowValues))
+                return false;
+            element.value = rowValues[row++];
+            return true;
+        },
+    };
+
+    generator.pushVariable(UTTE::Generator::makeArray(descriptors), "descriptors");
+    generator.pushVariable(UTTE::Generator::makeArray(words), "words");
+    generator.pushVariable(UTTE::Generator::makeMap(actions), "actions");
+    generator.pushVariable(UTTE::Generator::makeObject(productType, &products[0]), "product");
+    generator.pushVariable(UTTE::Generator::makeSequence(productSequence), "products");
+    generator.pushVariable(UTTE::Generator::makeSequence(rows), "rows");
+    generator.pushVariable({ .value = "brown" }, "colour");
+    generator.pushVariable({ .value = "test" }, "value");
+    generator.pushVariable({ .value = "TEST" }, "test_val");
+    generator.pushVariable({ .value = "NOTTEST" }, "not_test_val");
+    generator.pushVariable({ .value = "EXAMPLE" }, "example_val");
+    generator.pushVariable({ .value = "FALLBACK" }, "fallback_val");
+    generator.pushVariable({ .value = "h\xc3\xa9llo w\xc3\xb6rld" }, "text");
+    generator.pushVariable({ .value = "{{ func dynamic {{ colour }} }}" }, "dynbody");
+    generator.pushFunction({ .name = "upper", .function = [](std::vector<UTTE::Variable>& args, UTTE::Generator*) -> UTTE::Variable
+    {
+        utte_string result;
+        for (size_t i = 1; i < args.size(); i++)
+            for (auto a : args[i].value)
+                result += static_cast<char>(std::toupper(static_cast<unsigned char>(a)));
+        return { .value = result };
+    }});
+    generator.pushFunction({ .name = "short", .function = [](std::vector<UTTE::Variable>& args, UTTE::Generator*) -> UTTE::Variable
+    {
+        return { .value = args.size() == 2 && args[1].value.size() < 5 ? "true" : "false" };
+    }});
+}
+
+// Indices of ranges, sequences and "slice" that aren't non-negative integers are errors instead of the index 0, while
+// "at" on arrays keeps reading the number at the start of the index
+static bool checkIndices()
+{
+    UTTE::Generator generator;
+    bindCorpus(generator);
+
+    static const std::pair<const char*, const char*> valid[] = {
+        { "{{ at {{ range 5 }} 3 }}", "3" },
+        { "{{ at {{ rows }} 1 }}", "r2" },
+        { "{{ at {{ descriptors }} x }}", "quick" },
+        { "{{ at {{ descriptors }} 1x }}", "lazy" },
+        { "{{ slice abcdef 1 3 }}", "bc" },
+    };
+    static const char* invalid[] = {
+        "{{ at {{ range 5 }} -1 }}",
+        "{{ at {{ range 5 }} x }}",
+        "{{ at {{ range 5 }} 1x }}",
+        "{{ at {{ rows }} -1 }}",
+        "{{ at {{ rows }} 3 }}",
+        "{{ slice abcdef -1 }}",
+        "{{ slice abcdef 1 x }}",
+        "{{ slice {{ range 5 }} x 2 }}",
+    };
+
+    UTTE::ParseResultStatus status;
+    utte_string out;
+    for (auto& a : valid)
+        if (!renderBoth(generator, a.first, status, out) || status != UTTE_PARSE_STATUS_SUCCESS || out != a.second)
+            return false;
+    for (auto& a : invalid)
+        if (!renderBoth(generator, a, status, out) || status != UTTE_PARSE_STATUS_INVALID_VALUE)
+            return false;
+    return true;
+}
+
+// Ranges count up and down by any step, are measured, indexed and sliced without making their integers, and are
+// iterated by "for" like arrays
+static bool checkRanges()
+{
+    static const std::pair<const char*, const char*> templates[] = {
+        { "{{ for i {{ range 5 }} {{ func {{ i }},}} }}", "0,1,2,3,4," },
+        { "{{ for i {{ range 2 10 3 }} {{ func {{ i }},}} }}", "2,5,8," },
+        { "{{ for i {{ range 5 0 -2 }} {{ func {{ i }},}} }}", "5,3,1," },
+        { "{{ for i {{ range 3 3 }} {{ func {{ i }},}} }}", "" },
+        { "{{ for i {{ slice {{ range 10 }} 2 5 }} {{ func {{ i }},}} }}", "2,3,4," },
+        { "{{ length {{ range -1000000000000 1000000000000 }} }}", "2000000000000" },
+        { "{{ at {{ range 0 1000000000000 7 }} 5 }}", "35" },
+    };
+
+    UTTE::Generator generator;
+    UTTE::ParseResultStatus status;
+    utte_string out;
+    for (auto& a : templates)
+        if (!renderBoth(generator, a.first, status, out) || status != UTTE_PARSE_STATUS_SUCCESS || out != a.second)
+            return false;
+    return renderBoth(generator, "{{ range 0 5 0 }}", status, out) && status == UTTE_PARSE_STATUS_INVALID_VALUE;
+}
+
+// The collection builtins work on the variables of the corpus without changing them: "sort" and "reverse" return
+// copies, "keys" and "values" keep the order of maps and objects, and "filter" keeps the elements its predicate accepts
+static bool checkBuiltins()
+{
+    static const std::pair<const char*, const char*> templates[] = {
+        { "{{ join {{ words }} , }}", "pear,apple,fig,kiwi" },
+        { "{{ join {{ range 1 4 }} }}", "123" },
+        { "{{ join {{ sort {{ words }} }} , }}|{{ join {{ words }} , }}", "apple,fig,kiwi,pear|pear,apple,fig,kiwi" },
+        { "{{ join {{ reverse {{ words }} }} , }}", "kiwi,fig,apple,pear" },
+        { "{{ join {{ reverse {{ range 0 9 4 }} }} , }}", "8,4,0" },
+        { "{{ join {{ keys {{ actions }} }} , }}|{{ join {{ values {{ actions }} }} , }}", "a1,a2|jumps,runs" },
+        { "{{ join {{ keys {{ product }} }} , }}|{{ join {{ values {{ product }} }} , }}", "name,price|lamp,20" },
+        { "{{ contains {{ words }} fig }}{{ contains {{ words }} fi }}{{ contains {{ actions }} a2 }}", "101" },
+        { "{{ contains {{ text }} w\xc3\xb6 }}{{ contains {{ range 0 10 3 }} 9 }}{{ contains {{ range 0 10 3 }} 8 }}", "110" },
+        { "{{ contains {{ product }} price }}{{ contains {{ product }} lamp }}", "10" },
+        { "{{ join {{ filter {{ words }} short }} , }}", "pear,fig,kiwi" },
+    };
+
+    UTTE::Generator generator;
+    bindCorpus(generator);
+    UTTE::ParseResultStatus status;
+    utte_string out;
+    for (auto& a : templates)
+    {
+        if (!renderBoth(generator, a.first, status, out) || status != UTTE_PARSE_STATUS_SUCCESS || out != a.second)
+        {
+            std::cout << "      " << a.first << ": " << status << ", " << out << '\n';
+            return false;
+        }
+    }
+    return renderBoth(generator, "{{ sort {{ actions }} }}", status, out) && status == UTTE_PARSE_STATUS_INVALID_TYPE
+        && renderBoth(generator, "{{ filter {{ words }} missing }}", status, out) && status == UTTE_PARSE_STATUS_INVALID_VALUE;
+}
+
+// A sequence is restarted by every loop over it, its elements are copied before the next one overwrites the memory
+// they view, and it is only produced for as long as the loop runs
+static bool checkSequences()
+{
+    static size_t begins = 0;
+    static size_t nexts = 0;
+    static size_t element = 0;
+    static utte_string buffer;
+    static const UTTE::Sequence sequence = {
+        .begin = []() -> void
+        {
+            ++begins;
+            element = 0;
+        },
+        .next = [](UTTE::VariableView& view) -> bool
+        {
+            ++nexts;
+            if (element == 5)
+                return false;
+            buffer = "e" + std::to_string(element++);
+            view.value = buffer;
+            return true;
+        },
+    };
+
+    UTTE::Generator generator;
+    generator.pushVariable(UTTE::Generator::makeSequence(sequence), "elements");
+    generator.loadFromString("{{ for it {{ elements }} {{ func {{ it }},}} }}|{{ for it {{ elements }} {{ func {{ it }}}} }}");
+    auto result = generator.render();
+    if (result.status != UTTE_PARSE_STATUS_SUCCESS || *result.result != "e0,e1,e2,e3,e4,|e0e1e2e3e4" || begins != 2 || nexts != 12)
+        return false;
+
+    UTTE::ParseResultStatus status;
+    utte_string out;
+    if (!renderBoth(generator, "{{ for it {{ elements }} {{ func {{ it }},}} }}", status, out) || out != "e0,e1,e2,e3,e4,")
+        return false;
+
+    // A loop stopped by the budget doesn't produce the rest of the sequence
+    nexts = 0;
+    generator.setBudget({ .iterations = 2 });
+    generator.loadFromString("{{ for it {{ elements }} {{ func {{ it }},}} }}");
+    return generator.render().status == UTTE_PARSE_STATUS_BUDGET_EXCEEDED && nexts <= 3;
+}
+
+// Objects are read through their type when they're rendered, so "at" only calls the accessor of the field it reads,
+// and changes to an object show in the next render. "for key val" reads the fields in the order they were added, and
+// adding a field again replaces its accessor without moving it
+static bool checkObjects()
+{
+    static size_t labels = 0;
+    std::vector<Product> products = { { "lamp", 20 }, { "desk", 150 } };
+    UTTE::ObjectType type;
+    type.field("name", &Product::name).field("price", &Product::name).field("label", [](const void*, utte_string&) -> UTTE::VariableView
+    {
+        ++labels;
+        return { .value = "label" };
+    });
+    type.field("price", &Product::price);
+    auto sequence = type.sequence(products);
+
+    UTTE::Generator generator;
+    generator.pushVariable(UTTE::Generator::makeObject(type, &products[0]), "product");
+    generator.pushVariable(UTTE::Generator::makeSequence(sequence), "products");
+
+    UTTE::ParseResultStatus status;
+    utte_string out;
+    if (!renderBoth(generator, "{{ at {{ product }} name }} {{ at {{ product }} price }}", status, out) || out != "lamp 20" || labels != 0)
+        return false;
+    if (!renderBoth(generator, "{{ at {{ product }} colour }}", status, out) || status != UTTE_PARSE_STATUS_OUT_OF_BOUNDS)
+        return false;
+    if (!renderBoth(generator, "{{ for key val {{ product }} {{ func {{ key }}={{ val }},}} }}", status, out)
+        || out != "name=lamp,price=20,label=label,")
+        return false;
+
+    products[1].price = 99;
+    return renderBoth(generator, "{{ for it {{ products }} {{ func {{ at {{ it }} name }}:{{ at {{ it }} price }},}} }}", status, out)
+        && out == "lamp:20,desk:99,";
+}
+
+// A render within its budget succeeds, and one that needs a single expression, iteration or byte of output more fails
+// with UTTE_PARSE_STATUS_BUDGET_EXCEEDED, under both parse and render. The budget starts again on every render, and the
+// time limit stops a render that is still making progress
+static bool checkBudget()
+{
+    struct Spending
+    {
+        const char* source;
+        UTTE::RenderBudget spent;
+    };
+    static const Spending spendings[] = {
+        { "a{{ for i {{ list x y z }} {{ func <{{ i }}> }} }}b", { .expressions = 6, .iterations = 3, .outputBytes = 14 } },
+        { "{{ for i {{ range 4 }} {{ func {{ i }},}} }}", { .expressions = 7, .iterations = 4, .outputBytes = 8 } },
+    };
+
+    UTTE::ParseResultStatus status;
+    utte_string out;
+    for (auto& a : spendings)
+    {
+        const UTTE::RenderBudget budgets[] = {
+            { .expressions = a.spent.expressions },
+            { .iterations = a.spent.iterations },
+            { .outputBytes = a.spent.outputBytes },
+        };
+        for (auto budget : budgets)
+        {
+            UTTE::Generator generator;
+            generator.setBudget(budget);
+            for (size_t i = 0; i < 2; i++)
+                if (!renderBoth(generator, a.source, status, out) || status != UTTE_PARSE_STATUS_SUCCESS)
+                    return false;
+
+            budget.expressions -= budget.expressions != 0;
+            budget.iterations -= budget.iterations != 0;
+            budget.outputBytes -= budget.outputBytes != 0;
+            generator.setBudget(budget);
+            if (!renderBoth(generator, a.source, status, out) || status != UTTE_PARSE_STATUS_BUDGET_EXCEEDED)
+                return false;
+        }
+    }
+
+    UTTE::Generator generator;
+    generator.pushFunction({ .name = "wait", .function = [](std::vector<UTTE::Variable>&, UTTE::Generator*) -> UTTE::Variable
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        return {};
+    }});
+    generator.setBudget({ .milliseconds = 20 });
+    return renderBoth(generator, "{{ for i {{ range 1000 }} {{ func {{ wait }} }} }}", status, out) && status == UTTE_PARSE_STATUS_BUDGET_EXCEEDED;
+}
+
+// Two long strings of the same size that only differ between the words sampled by the fingerprint of their UTF-8
+// indices don't share an index. Changing a string in place keeps its address, while a loop variable only does so
+// when the allocator reuses its memory, which sanitizers don't
+static bool checkUTF8Indices()
+{
+    utte_string str(512, 'A');
+    str[101] = 'B';
+    {
+        UTTE::UTF8::IndexScope scope;
+        if (UTTE::UTF8::offset(str, 100) != 100)
+            return false;
+        str.replace(8, 2, "\xc3\xa9");
+        if (UTTE::UTF8::offset(str, 100) != 101)
+            return false;
+    }
+
+    std::vector<utte_string> strs = { utte_string(512, 'A'), str };
+    strs[0][101] = 'B';
+
+    UTTE::Generator generator;
+    generator.pushVariable(UTTE::Generator::makeArray(strs), "strs");
+
+    UTTE::ParseResultStatus status;
+    utte_string out;
+    return renderBoth(generator, "{{ for it {{ strs }} {{ func [{{ at {{ it }} 100 }}] }} }}", status, out)
+        && status == UTTE_PARSE_STATUS_SUCCESS && out == "[A] [B] ";
+}
+
+static utte_string readFile(const std::filesystem::path& location) noexcept
+{
+    std::ifstream in(location, std::ios::binary);
+    std::stringstream ss;
+    ss << in.rdbuf();
+    return ss.str();
+}
+
+static void writeFile(const std::filesystem::path& location, const utte_string& contents) noexcept
+{
+    std::ofstream out(location, std::ios::binary | std::ios::trunc);
+    out << contents;
+}
+
+// A precompiled file renders like its template, and one that is stale, corrupt or cut short is rejected, so that the
+// template it was made from is compiled instead
+static bool checkPrecompiled()
+{
+    auto temp = std::filesystem::temp_directory_path() / "utte-check-precompiled";
+    std::filesystem::create_directories(temp);
+    auto source = (temp / "page.tmpl").string();
+    auto precompiled = (temp / "page.utc").string();
+
+    writeFile(source, nestedSource);
+    UTTE::Generator generator;
+    if (generator.loadFromFile(source) != UTTE_INITIALISATION_RESULT_SUCCESS
+        || generator.savePrecompiled(precompiled) != UTTE_INITIALISATION_RESULT_SUCCESS)
+        return false;
+    utte_string expected = *generator.parse().result;
+
+    const auto renders = [&](const utte_string& templateLocation, const utte_string& result) -> bool
+    {
+        UTTE::Generator loaded;
+        if (loaded.loadFromPrecompiled(precompiled, templateLocation) != UTTE_INITIALISATION_RESULT_SUCCESS)
+            return false;
+        auto rendered = loaded.render();
+        return rendered.status == UTTE_PARSE_STATUS_SUCCESS && *rendered.result == result;
+    };
+    bool bResult = renders("", expected) && renders(source, expected);
+
+    // The file is stale once its template changes
+    writeFile(source, "{{ func changed }}");
+    generator.loadFromFile(source);
+    utte_string changed = *generator.parse().result;
+    bResult &= renders(source, changed);
+
+    // Flipping a byte breaks the checksum, and cutting the file breaks its header
+    utte_string file = readFile(precompiled);
+    file.back() ^= 1;
+    writeFile(precompiled, file);
+    bResult &= renders(source, changed) && UTTE::Generator().loadFromPrecompiled(precompiled, "") == UTTE_INITIALISATION_RESULT_INVALID_FILE;
+
+    writeFile(precompiled, file.substr(0, 16));
+    bResult &= renders(source, changed) && UTTE::Generator().loadFromPrecompiled(precompiled, "") == UTTE_INITIALISATION_RESULT_INVALID_FILE;
+
+    std::filesystem::remove_all(temp);
+    return bResult;
+}
+
+// Watch renders again only the pages that depend on a changed file: the page itself, the pages that included a
+// changed partial, or every page when the manifest changes. A page that renders the same output isn't written again
+static bool checkWatch()
+{
+    auto temp = std::filesystem::temp_directory_path() / "utte-check-watch";
+    std::filesystem::remove_all(temp);
+    std::filesystem::create_directories(temp / "input");
+    auto manifest = (temp / "site.manifest").string();
+    writeFile(temp / "input" / "_header.tmpl", "<h1>{{ title }}</h1>");
+    writeFile(temp / "input" / "a.tmpl", "{{ include _header.tmpl }}a");
+    writeFile(temp / "input" / "b.tmpl", "{{ title }}|b");
+    writeFile(manifest, "title = First");
+
+    // Returns the pages that were rendered, and the state of each
+    const auto rendered = [](const std::vector<UTTE::BuildFileResult>& results) -> utte_string
+    {
+        utte_string result;
+        for (auto& a : results)
+            result += a.input + (a.state == UTTE::BuildFileResult::UTTE_BUILD_FILE_WRITTEN ? "+" : a.state == UTTE::BuildFileResult::UTTE_BUILD_FILE_UNCHANGED ? "=" : "!");
+        return result;
+    };
+
+    bool bResult;
+    {
+        UTTE::Watch watch({ .input = (temp / "input").string(), .output = (temp / "output").string(), .threads = 2 }, manifest);
+        bResult = rendered(watch.build()) == "a.tmpl+b.tmpl+" && readFile(temp / "output" / "a.html") == "<h1>First</h1>a";
+
+        writeFile(temp / "input" / "_header.tmpl", "<h2>{{ title }}</h2>");
+        bResult &= rendered(watch.update({ (temp / "input" / "_header.tmpl").string() })) == "a.tmpl+"
+            && readFile(temp / "output" / "a.html") == "<h2>First</h2>a";
+
+        writeFile(temp / "input" / "b.tmpl", "{{ title }}|B");
+        bResult &= rendered(watch.update({ (temp / "input" / "b.tmpl").string() })) == "b.tmpl+" && readFile(temp / "output" / "b.html") == "First|B";
+
+        writeFile(temp / "input" / "b.tmpl", "{{ title }}|{{ func B}}");
+        bResult &= rendered(watch.update({ (temp / "input" / "b.tmpl").string() })) == "b.tmpl=";
+
+        writeFile(manifest, "title = Second");
+        bResult &= rendered(watch.update({ manifest })) == "a.tmpl+b.tmpl+" && readFile(temp / "output" / "b.html") == "Second|B";
+    }
+
+    std::filesystem::remove_all(temp);
+    return bResult;
+}
+
+#ifdef __linux__
+// A server renders templates with the variables of its manifest and of the request, sent as binary or as JSON, in
+// chunks of any size. Requests that fail return their status and keep the connection open, while a header that
+// isn't one closes it. "reload" picks up changes to the manifest
+static bool checkServer()
+{
+    auto temp = std::filesystem::temp_directory_path() / "utte-check-server";
+    std::filesystem::remove_all(temp);
+    std::filesystem::create_directories(temp);
+    writeFile(temp / "page.tmpl", "{{ site }}/{{ title }}:{{ for it {{ items }} {{ func <{{ it }}>}} }}{{ at {{ tags }} k }}");
+    writeFile(temp / "site.manifest", "site = First");
+
+    UTTE::ServerOptions options{};
+    options.socket = (temp / "socket").string();
+    options.templates = temp.string();
+    options.manifest = (temp / "site.manifest").string();
+    options.threads = 2;
+    options.chunkBytes = 4;
+
+    UTTE::Server server(options);
+    std::thread runner([&]() -> void { server.run(nullptr); });
+
+    UTTE::Client client;
+    for (size_t i = 0; i < 500 && !client.connect(options.socket); i++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    UTTE::RequestContext context;
+    context.pushVariable("title", "Home");
+    context.pushArray("items", { "a", "b" });
+    context.pushMap("tags", { { "k", "v" } });
+    static const utte_string json = R"({ "title": "Home", "items": ["a", "b"], "tags": { "k": "v" } })";
+
+    utte_string output;
+    size_t chunks = 0;
+    bool bResult = client.render("page.tmpl", context, [&](utte_string_view chunk) -> void
+    {
+        output.append(chunk.data(), chunk.size());
+        chunks++;
+    }) == UTTE_PARSE_STATUS_SUCCESS && output == "First/Home:<a><b>v" && chunks == 5;
+
+    bResult &= client.renderJSON("page.tmpl", json, output) == UTTE_PARSE_STATUS_SUCCESS && output == "First/Home:<a><b>v";
+    bResult &= client.render("../page.tmpl", context, output) == UTTE_PARSE_STATUS_INVALID_VALUE;
+    bResult &= client.render("missing.tmpl", context, output) == UTTE_PARSE_STATUS_INVALID_VALUE;
+    bResult &= client.renderJSON("page.tmpl", "{ \"title\": ", output) == UTTE_PARSE_STATUS_INVALID_VALUE;
+
+    writeFile(temp / "site.manifest", "site = Second");
+    bResult &= client.reload() == UTTE_PARSE_STATUS_SUCCESS;
+    bResult &= client.render("page.tmpl", context, output) == UTTE_PARSE_STATUS_SUCCESS && output == "Second/Home:<a><b>v";
+    bResult &= client.stats(output) == UTTE_PARSE_STATUS_SUCCESS && output.starts_with("requests 7\nfailures 3\n");
+
+    // A wrong magic number, written without the client
+    int connection = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un address{ .sun_family = AF_UNIX };
+    std::memcpy(address.sun_path, options.socket.c_str(), options.socket.size() + 1);
+    UTTE::ServerRequestHeader header{ .magic = 0 };
+    uint32_t size;
+    bResult &= connect(connection, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0
+        && UTTE::ServerSocket::write(connection, &header, sizeof(header)) && !UTTE::ServerSocket::read(connection, &size, sizeof(size));
+    close(connection);
+
+    bResult &= client.isConnected() && client.stats(output) == UTTE_PARSE_STATUS_SUCCESS;
+    server.stop();
+    runner.join();
+    std::filesystem::remove_all(temp);
+    return bResult;
+}
+#endif
+
+// Makes a snapshot whose variable and array both hold "value"
+static std::shared_ptr<UTTE::Snapshot> makeSnapshot(const utte_string& value) noexcept
+{
+    auto snapshot = std::make_shared<UTTE::Snapshot>();
+    auto& items = snapshot->requestArrayWithGC();
+    items.push_back(value);
+    snapshot->pushVariable({ .value = value }, "title");
+    snapshot->pushVariable(UTTE::Generator::makeArray(items), "items");
+    return snapshot;
+}
+
+// A generator keeps the snapshot it was given alive and unchanged while newer ones are published, and drops it when
+// it gets another one or is reset. Renders on other threads always see the variables of a single snapshot
+static bool checkSnapshots()
+{
+    static const char* source = "{{ title }}|{{ at {{ items }} 0 }}";
+
+    UTTE::SnapshotSlot slot;
+    auto first = makeSnapshot("one");
+    std::weak_ptr<const UTTE::Snapshot> weakFirst = first;
+    slot.publish(std::move(first));
+
+    UTTE::Generator generator;
+    generator.setSnapshot(slot.load());
+    slot.publish(makeSnapshot("two"));
+
+    UTTE::ParseResultStatus status;
+    utte_string out;
+    if (!renderBoth(generator, source, status, out) || out != "one|one" || weakFirst.expired())
+        return false;
+
+    generator.setSnapshot(slot.load());
+    if (!renderBoth(generator, source, status, out) || out != "two|two" || !weakFirst.expired())
+        return false;
+
+    std::weak_ptr<const UTTE::Snapshot> weakSecond = slot.load();
+    generator.reset();
+    if (!renderBoth(generator, source, status, out) || out != "|" || weakSecond.use_count() != 1)
+        return false;
+
+    std::atomic<bool> bConsistent = true;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 4; i++)
+    {
+        threads.emplace_back([&]() -> void
+        {
+            UTTE::Generator reader;
+            reader.loadFromString(source);
+            for (size_t j = 0; j < 200; j++)
+            {
+                reader.setSnapshot(slot.load());
+                auto result = reader.render();
+                auto separator = result.result->find('|');
+                if (result.status != UTTE_PARSE_STATUS_SUCCESS || result.result->substr(0, separator) != result.result->substr(separator + 1))
+                    bConsistent = false;
+            }
+        });
+    }
+    for (size_t i = 0; i < 200; i++)
+        slot.publish(makeSnapshot(std::to_string(i)));
+    for (auto& a : threads)
+        a.join();
+    return bConsistent;
+}
+
+// Includes partials from the corpus for as long as it exists, then restores the previous loader
+struct CorpusLoader
+{
+    CorpusLoader() noexcept
+    {
+        previous = UTTE::PartialCache::getLoader();
+        UTTE::PartialCache::setLoader([](const utte_string& path, utte_string& out) -> bool
+        {
+            return UTTE::PartialCache::loadFile((directory / "corpus" / path).string(), out);
+        });
+    }
+
+    ~CorpusLoader() noexcept
+    {
+        UTTE::PartialCache::setLoader(previous);
+    }
+
+    std::function<UTTE::IncludeLoader> previous;
+};
+
+// Renders a template of the corpus into "out" in a way that is compared with "parse". The generator is bound, has the
+// limits set and the template loaded
+typedef UTTE::ParseResultStatus(RenderCorpus)(UTTE::Generator& generator, const CorpusTemplate& corpusTemplate, utte_string& out);
+
+// Renders every template of the corpus with all limits, once with "parse" and once with "render", which have to return
+// the same status, and the same result if they succeed. The name of the way "render" renders is printed on failures. Without limits every template has to succeed, and every limit
+// has to stop at least one template, so that the errors are compared too
+static bool compareWithParse(RenderCorpus* render, const char* name)
+{
+    CorpusLoader loader;
+    bool bResult = true;
+    for (auto& limits : corpusLimits)
+    {
+        bool bDefaults = &limits == &corpusLimits[0];
+        bool bStopped = bDefaults;
+        for (auto& a : corpusTemplates)
+        {
+            auto location = (directory / "corpus" / (utte_string(a.name) + ".tmpl")).string();
+            UTTE::Generator parser;
+            UTTE::Generator renderer;
+            for (auto* generator : { &parser, &renderer })
+            {
+                bindCorpus(*generator);
+                generator->setMaxDepth(limits.maxDepth);
+                generator->setBudget(limits.budget);
+                if (generator->loadFromFile(location) != UTTE_INITIALISATION_RESULT_SUCCESS)
+                    return false;
+            }
+
+            auto parsed = parser.parse();
+            utte_string rendered;
+            auto status = render(renderer, a, rendered);
+            bStopped |= parsed.status != UTTE_PARSE_STATUS_SUCCESS;
+            if (parsed.status != status || (parsed.status == UTTE_PARSE_STATUS_SUCCESS && *parsed.result != rendered)
+                || (bDefaults && parsed.status != UTTE_PARSE_STATUS_SUCCESS))
+            {
+                std::cout << "      " << a.name << ", " << limits.name << ": parse " << parsed.status << ", " << name << " " << status << '\n';
+                bResult = false;
+            }
+        }
+        bResult &= bStopped;
+    }
+    return bResult;
+}
+
+static bool checkParseRender()
+{
+    return compareWithParse([](UTTE::Generator& generator, const CorpusTemplate&, utte_string& out) -> UTTE::ParseResultStatus
+    {
+        auto result = generator.render();
+        out = *result.result;
+        return result.status;
+    }, "render");
+}
+
+// The compiled templates are built from the corpus as it is, and run with a Context they render like "parse"
+static bool checkCompiled()
+{
+    bool bResult = true;
+    for (auto& a : corpusTemplates)
+    {
+        UTTE::Program program;
+        utte_string expected;
+        if (UTTE::Compiler::compile(readFile(directory / "corpus" / (utte_string(a.name) + ".tmpl")), program) != UTTE_PARSE_STATUS_SUCCESS)
+            return false;
+        UTTE::Transpiler::transpile(program, a.name, expected);
+
+        if (readFile(directory / "compiled" / (utte_string(a.name) + ".cpp")) != expected)
+        {
+            std::cout << "      compiled/" << a.name << ".cpp is out of date, generate it again with utte-compile\n";
+            bResult = false;
+        }
+    }
+
+    return compareWithParse([](UTTE::Generator& generator, const CorpusTemplate& corpusTemplate, utte_string& out) -> UTTE::ParseResultStatus
+    {
+        UTTE::Context context(generator);
+        return corpusTemplate.compiled(context, out);
+    }, "compiled") && bResult;
+}
+
+// Specializes "source" with every variable and function of the corpus static except "colour", which is bound to a
+// different value while specializing. The residual, rendered and parsed in a nested generator that binds "colour",
+// has to match "parse" on the template itself
+static bool specializeCorpus(const utte_string& source, utte_string& residual) noexcept
+{
+    UTTE::Generator original;
+    bindCorpus(original);
+    original.loadFromString(source);
+    auto expected = original.parse();
+
+    UTTE::Generator specializer;
+    bindCorpus(specializer);
+    for (auto& a : specializer.getFunctionsRegistry())
+        a.bStatic = a.name != "colour";
+    specializer.findFunction("colour")->setValue({ .value = "SPECIALIZED" });
+    specializer.loadFromString(source);
+    if (specializer.specialize(residual) != UTTE_PARSE_STATUS_SUCCESS)
+        return false;
+
+    UTTE::Generator generator(&specializer);
+    generator.pushVariable({ .value = "brown" }, "colour");
+    UTTE::ParseResultStatus status;
+    utte_string out;
+    return renderBoth(generator, residual, status, out) && status == expected.status && out == *expected.result;
+}
+
+// Residual templates of the corpus render like the templates themselves, and branches that only depend on static
+// values are pruned
+static bool checkSpecializer()
+{
+    CorpusLoader loader;
+    utte_string residual;
+    for (auto& a : corpusTemplates)
+    {
+        if (!specializeCorpus(readFile(directory / "corpus" / (utte_string(a.name) + ".tmpl")), residual))
+        {
+            std::cout << "      " << a.name << " renders differently once specialized\n";
+            return false;
+        }
+    }
+
+    return specializeCorpus("{{ if {{ == {{ value }} test }} {{ func <{{ colour }}> }} {{ func {{ not_test_val }} }} }}", residual)
+        && residual.find("not_test_val") == utte_string::npos && residual.find("value") == utte_string::npos
+        && residual.find("colour") != utte_string::npos;
+}
+
+int main(int argc, char** argv)
+{
+    static const Check checks[] = {
+        { "pool defaults", checkPoolDefaults },
+        { "parse and render agree", checkParseRender },
+        { "compiled templates agree with parse", checkCompiled },
+        { "range, sequence and slice indices", checkIndices },
+        { "UTF-8 indices of similar strings", checkUTF8Indices },
+        { "precompiled files", checkPrecompiled },
+        { "pool reset", checkPoolReset },
+        { "map lookups and order", checkMaps },
+        { "variable store", checkVariables },
+        { "async completion order", checkAsync },
+        { "max depth", checkDepth },
+        { "memoized pure functions", checkMemo },
+        { "ranges", checkRanges },
+        { "sequences", checkSequences },
+        { "objects", checkObjects },
+        { "render budgets", checkBudget },
+        { "watch dependencies", checkWatch },
+        { "snapshot lifetime", checkSnapshots },
+        { "specialized templates", checkSpecializer },
+        { "collection builtins", checkBuiltins },
+#ifdef __linux__
+        { "server protocol", checkServer },
+#endif
+    };
+
+    int arg = 1;
+    bool bVerbose = arg < argc && std::strcmp(argv[arg], "-v") == 0;
+    if (bVerbose)
+        ++arg;
+    if (arg < argc)
+        directory = argv[arg];
+
+    size_t failed = 0;
+    for (auto& a : checks)
+    {
+        if (!a.run())
+        {
+            ++failed;
+            std::cout << "FAIL  " << a.name << '\n';
+        }
+        else if (bVerbose)
+            std::cout << "OK    " << a.name << '\n';
+    }
+
+    std::cout << std::size(checks) - failed << " of " << std::size(checks) << " checks passed" << std::endl;
+    return failed == 0 ? 0 : 1;
+}
\ No newline at end of file
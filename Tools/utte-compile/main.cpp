@@ -0,0 +1,62 @@
+// utte-compile - compiles a template to a C++ source file
+// Usage: utte-compile <template> <output.cpp> [namespace]
+// The generated file defines "UTTE::ParseResultStatus <namespace>::render(UTTE::Context&, utte_string&)" and has to be
+// built together with the UntitledTemplatingEngine sources. The namespace defaults to the name of the template file
+#include "Transpiler.hpp"
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+static utte_string defaultName(const utte_string& path) noexcept
+{
+    size_t begin = path.find_last_of("/\\");
+    begin = begin == utte_string::npos ? 0 : begin + 1;
+
+    utte_string result = path.substr(begin, path.find('.', begin) - begin);
+    for (auto& a : result)
+        if (!std::isalnum(static_cast<unsigned char>(a)))
+            a = '_';
+    if (result.empty() || std::isdigit(static_cast<unsigned char>(result[0])))
+        result.insert(result.begin(), '_');
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 3 || argc > 4)
+    {
+        std::cerr << "Usage: " << argv[0] << " <template> <output.cpp> [namespace]" << std::endl;
+        return 1;
+    }
+
+    std::ifstream in(argv[1]);
+    if (!in)
+    {
+        std::cerr << "Couldn't open the template: " << argv[1] << std::endl;
+        return 1;
+    }
+    std::stringstream ss;
+    ss << in.rdbuf();
+    utte_string source = ss.str();
+
+    UTTE::Program program;
+    auto status = UTTE::Compiler::compile(source, program);
+    if (status != UTTE_PARSE_STATUS_SUCCESS)
+    {
+        std::cerr << "Couldn't compile the template: " << argv[1] << ", status: " << status << std::endl;
+        return 1;
+    }
+
+    utte_string code;
+    UTTE::Transpiler::transpile(program, argc == 4 ? argv[3] : defaultName(argv[1]), code);
+
+    std::ofstream out(argv[2]);
+    if (!out)
+    {
+        std::cerr << "Couldn't open the output file: " << argv[2] << std::endl;
+        return 1;
+    }
+    out << code;
+    return 0;
+}
\ No newline at end of file
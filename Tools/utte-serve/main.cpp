@@ -0,0 +1,102 @@
+// utte-serve - renders templates for other processes over a Unix domain socket
+// Usage: utte-serve <socket> <template directory> [-m manifest] [-j threads] [-q]
+// Keeps the compiled templates and the variables of the manifest in memory between requests, see UTTE::Server for
+// the protocol and UTTE::Client for a client. Prints the time every request took, unless "-q" is given. SIGHUP loads
+// the manifest again and drops the compiled templates, and SIGINT or SIGTERM stop the server and print its latencies
+#include "Server.hpp"
+#include <csignal>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+static const char* requestName(UTTE::ServerRequestType type) noexcept
+{
+    switch (type)
+    {
+    case UTTE::UTTE_SERVER_REQUEST_RENDER:
+        return "render";
+    case UTTE::UTTE_SERVER_REQUEST_STATS:
+        return "stats";
+    default:
+        return "reload";
+    }
+}
+
+int main(int argc, char** argv)
+{
+    UTTE::ServerOptions options;
+    bool bQuiet = false;
+
+    std::vector<utte_string> positional;
+    for (int i = 1; i < argc; i++)
+    {
+        utte_string arg = argv[i];
+        if (arg == "-q")
+            bQuiet = true;
+        else if (arg == "-j" && i + 1 < argc)
+            options.threads = std::strtoul(argv[++i], nullptr, 10);
+        else if (arg == "-m" && i + 1 < argc)
+            options.manifest = argv[++i];
+        else
+            positional.push_back(arg);
+    }
+
+    if (positional.size() != 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <socket> <template directory> [-m manifest] [-j threads] [-q]" << std::endl;
+        return 1;
+    }
+    options.socket = positional[0];
+    options.templates = positional[1];
+
+    // Signals are blocked on every thread and taken by one that waits for them, so they can do more than a handler
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    sigaddset(&signals, SIGHUP);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+    UTTE::Server server(options);
+    std::thread waiter([&]() -> void
+    {
+        int signal = 0;
+        while (sigwait(&signals, &signal) == 0 && signal == SIGHUP)
+        {
+            if (!server.reload())
+                std::cerr << "Couldn't load the manifest: " << options.manifest << std::endl;
+        }
+        server.stop();
+    });
+
+    std::mutex outputMutex;
+    bool bRunning = server.run([&](const UTTE::ServerRequestResult& result) -> void
+    {
+        if (bQuiet && result.status == UTTE_PARSE_STATUS_SUCCESS)
+            return;
+
+        std::lock_guard<std::mutex> lock(outputMutex);
+        std::cout << std::fixed << std::setprecision(3) << std::setw(10) << static_cast<double>(result.microseconds) / 1000.0
+                  << " ms  " << std::left << std::setw(7) << requestName(result.type) << std::right << result.id;
+        if (result.status != UTTE_PARSE_STATUS_SUCCESS)
+            std::cout << " (status " << result.status << ")";
+        std::cout << '\n';
+    });
+
+    // Wakes up the waiter if "run" returned on its own
+    if (!bRunning)
+        pthread_kill(waiter.native_handle(), SIGTERM);
+    waiter.join();
+    if (!bRunning)
+    {
+        std::cerr << "Couldn't listen on " << options.socket << " or load the manifest" << std::endl;
+        return 1;
+    }
+
+    auto stats = server.stats();
+    std::cout << stats.requests << " requests, " << stats.failures << " failed, latency mean " << stats.meanMicroseconds
+              << " us, p50 " << stats.p50Microseconds << " us, p90 " << stats.p90Microseconds << " us, p99 "
+              << stats.p99Microseconds << " us, max " << stats.maxMicroseconds << " us" << std::endl;
+    return 0;
+}
\ No newline at end of file
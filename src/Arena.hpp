@@ -0,0 +1,45 @@
+#pragma once
+#include <memory>
+#include <vector>
+
+namespace UTTE
+{
+    /**
+     * @brief Hands out containers whose addresses never change. Containers are allocated in chunks, and growing the
+     * arena only adds chunks, so references and the pointers encoded by makeArray and makeMap stay valid until the
+     * arena is reset or destroyed. Resetting is O(1): the containers are kept and cleared when they are handed out
+     * again, so their memory is reused
+     */
+    template<typename T>
+    class Arena
+    {
+    public:
+        T& request() noexcept
+        {
+            if (used == chunks.size() * chunkSize)
+                chunks.emplace_back(std::make_unique<T[]>(chunkSize));
+
+            T& result = chunks[used / chunkSize][used % chunkSize];
+            result.clear();
+            ++used;
+            return result;
+        }
+
+        // Makes all containers available again. References to them stay valid, but they will be reused
+        void reset() noexcept
+        {
+            used = 0;
+        }
+
+        // The number of containers handed out since the last reset
+        size_t size() const noexcept
+        {
+            return used;
+        }
+    private:
+        static constexpr size_t chunkSize = 16;
+
+        std::vector<std::unique_ptr<T[]>> chunks;
+        size_t used = 0;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,17 @@
+#include "Async.hpp"
+
+void UTTE::InlineExecutor::post(std::coroutine_handle<> handle) noexcept
+{
+    queue.push_back(handle);
+}
+
+bool UTTE::InlineExecutor::runOnce() noexcept
+{
+    if (queue.empty())
+        return false;
+
+    auto handle = queue.front();
+    queue.pop_front();
+    handle.resume();
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,186 @@
+#pragma once
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <utility>
+#include "Common.h"
+
+namespace UTTE
+{
+    /**
+     * @brief Resumes suspended coroutines, used by Generator::renderAsync and by async functions that wait for I/O. To
+     * render on an event loop, like one built on io_uring, implement "post" to queue a coroutine on the loop and
+     * "runOnce" to run one iteration of it. "runOnce" may be called while another coroutine of the same render is
+     * running, when the render needs a result right away, so it has to be reentrant
+     */
+    class MLS_PUBLIC_API Executor
+    {
+    public:
+        virtual ~Executor() noexcept = default;
+
+        // Queues a coroutine to be resumed by "runOnce". Can be called from any thread if the executor supports it
+        virtual void post(std::coroutine_handle<> handle) noexcept = 0;
+
+        // Resumes at least one queued coroutine, waiting for one if there are pending I/O operations. Returns false if
+        // there's nothing queued or pending, in which case a coroutine that is still suspended will never be resumed
+        virtual bool runOnce() noexcept = 0;
+
+        // Returns an awaitable that suspends the calling coroutine and posts it, letting other coroutines run first
+        auto yield() noexcept
+        {
+            struct Awaiter
+            {
+                bool await_ready() const noexcept { return false; }
+                void await_suspend(std::coroutine_handle<> handle) noexcept { executor.post(handle); }
+                void await_resume() const noexcept {}
+
+                Executor& executor;
+            };
+            return Awaiter{ *this };
+        }
+    };
+
+    // Runs queued coroutines in order on the calling thread. Used when an async function is called outside of
+    // Generator::renderAsync, and enough for async functions that only suspend through Executor::yield
+    class MLS_PUBLIC_API InlineExecutor final : public Executor
+    {
+    public:
+        void post(std::coroutine_handle<> handle) noexcept override;
+        bool runOnce() noexcept override;
+    private:
+        std::deque<std::coroutine_handle<>> queue;
+    };
+
+    /**
+     * @brief The result of a coroutine, like the one returned by an async function. The coroutine starts running as soon
+     * as it's called, so calling several of them puts their I/O in flight at the same time. Awaiting the task suspends
+     * the caller until the coroutine returns, and destroying it destroys the coroutine, which must not be suspended on
+     * I/O at that point
+     */
+    template<typename T>
+    class Task
+    {
+    public:
+        struct promise_type
+        {
+            Task get_return_object() noexcept
+            {
+                return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+
+            std::suspend_never initial_suspend() const noexcept
+            {
+                return {};
+            }
+
+            // Stays suspended at the end, so that the result lives until the task is destroyed, and resumes whoever
+            // awaited the task
+            auto final_suspend() const noexcept
+            {
+                struct Awaiter
+                {
+                    bool await_ready() const noexcept { return false; }
+                    std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) const noexcept
+                    {
+                        auto continuation = handle.promise().continuation;
+                        return continuation ? continuation : std::noop_coroutine();
+                    }
+                    void await_resume() const noexcept {}
+                };
+                return Awaiter{};
+            }
+
+            void return_value(T&& value) noexcept
+            {
+                result = std::move(value);
+            }
+
+            void return_value(const T& value) noexcept
+            {
+                result = value;
+            }
+
+            void unhandled_exception() const noexcept
+            {
+                std::terminate();
+            }
+
+            T result{};
+            std::coroutine_handle<> continuation;
+        };
+
+        Task() noexcept = default;
+
+        Task(Task&& task) noexcept : handle(std::exchange(task.handle, {}))
+        {
+        }
+
+        Task& operator=(Task&& task) noexcept
+        {
+            if (this != &task)
+            {
+                if (handle)
+                    handle.destroy();
+                handle = std::exchange(task.handle, {});
+            }
+            return *this;
+        }
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        ~Task() noexcept
+        {
+            if (handle)
+                handle.destroy();
+        }
+
+        // Returns false for tasks that were default constructed or moved from
+        bool valid() const noexcept
+        {
+            return static_cast<bool>(handle);
+        }
+
+        bool done() const noexcept
+        {
+            return !handle || handle.done();
+        }
+
+        // The value the coroutine returned. Only valid once the task is done
+        T& result() noexcept
+        {
+            return handle.promise().result;
+        }
+
+        // Runs the executor until the task is done. Returns false if the executor ran out of work before that
+        bool wait(Executor& executor) noexcept
+        {
+            while (!done())
+                if (!executor.runOnce())
+                    return false;
+            return true;
+        }
+
+        bool await_ready() const noexcept
+        {
+            return done();
+        }
+
+        void await_suspend(std::coroutine_handle<> continuation) noexcept
+        {
+            handle.promise().continuation = continuation;
+        }
+
+        // The result stays in the task, so that awaiting a task and reading "result" afterwards both work
+        T& await_resume() noexcept
+        {
+            return handle.promise().result;
+        }
+    private:
+        explicit Task(std::coroutine_handle<promise_type> h) noexcept : handle(h)
+        {
+        }
+
+        std::coroutine_handle<promise_type> handle;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,242 @@
+#include "Build.hpp"
+#include "GeneratorPool.hpp"
+#include "PartialCache.hpp"
+#include "Snapshot.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+static utte_string_view trim(utte_string_view str) noexcept
+{
+    while (!str.empty() && std::isspace(static_cast<unsigned char>(str.front())))
+        str.remove_prefix(1);
+    while (!str.empty() && std::isspace(static_cast<unsigned char>(str.back())))
+        str.remove_suffix(1);
+    return str;
+}
+
+bool UTTE::BuildManifest::load(const utte_string& location) noexcept
+{
+    std::ifstream in(location);
+    if (!in)
+        return false;
+
+    std::stringstream ss;
+    ss << in.rdbuf();
+    return loadFromString(ss.str());
+}
+
+bool UTTE::BuildManifest::loadFromString(utte_string_view data) noexcept
+{
+    BuildBindings* section = &global;
+    while (!data.empty())
+    {
+        size_t end = data.find('\n');
+        auto line = trim(data.substr(0, end));
+        data.remove_prefix(end == utte_string_view::npos ? data.size() : end + 1);
+
+        if (line.empty() || line.front() == '#')
+            continue;
+        if (line.front() == '[')
+        {
+            if (line.back() != ']')
+                return false;
+
+            auto name = trim(line.substr(1, line.size() - 2));
+            section = name == "*" ? &global : &pages[utte_string(name)];
+            continue;
+        }
+
+        size_t equals = line.find('=');
+        if (equals == utte_string_view::npos)
+            return false;
+
+        auto name = trim(line.substr(0, equals));
+        auto value = utte_string(trim(line.substr(equals + 1)));
+        if (name.empty())
+            return false;
+
+        size_t dot = name.find('.');
+        if (name.size() > 2 && name.ends_with("[]"))
+            section->arrays[utte_string(name.substr(0, name.size() - 2))].push_back(std::move(value));
+        else if (dot != utte_string_view::npos && dot != 0 && dot + 1 != name.size())
+            section->maps[utte_string(name.substr(0, dot))][utte_string(name.substr(dot + 1))] = std::move(value);
+        else
+            section->values[utte_string(name)] = std::move(value);
+    }
+    return true;
+}
+
+void UTTE::BuildManifest::bind(const utte_string& page, UTTE::Generator& generator) const noexcept
+{
+    visit(page, [&](const utte_string& name, const auto& value) -> void
+    {
+        using T = std::decay_t<decltype(value)>;
+        if constexpr (std::is_same_v<T, utte_string>)
+            generator.pushVariable({ .value = value, .type = UTTE_VARIABLE_TYPE_HINT_NORMAL }, name);
+        else if constexpr (std::is_same_v<T, std::vector<utte_string>>)
+            generator.pushVariable(Generator::makeArray(value), name);
+        else
+            generator.pushVariable(Generator::makeMap(value), name);
+    });
+}
+
+void UTTE::BuildManifest::bind(const utte_string& page, UTTE::Snapshot& snapshot) const noexcept
+{
+    visit(page, [&](const utte_string& name, const auto& value) -> void
+    {
+        using T = std::decay_t<decltype(value)>;
+        if constexpr (std::is_same_v<T, utte_string>)
+            snapshot.pushVariable({ .value = value, .type = UTTE_VARIABLE_TYPE_HINT_NORMAL }, name);
+        else if constexpr (std::is_same_v<T, std::vector<utte_string>>)
+        {
+            auto& copy = snapshot.requestArrayWithGC();
+            copy = value;
+            snapshot.pushVariable(Generator::makeArray(copy), name);
+        }
+        else
+        {
+            auto& copy = snapshot.requestMapWithGC();
+            copy = value;
+            snapshot.pushVariable(Generator::makeMap(copy), name);
+        }
+    });
+}
+
+template<typename T>
+void UTTE::BuildManifest::visit(const utte_string& page, T&& push) const noexcept
+{
+    auto it = pages.find(page);
+    const BuildBindings* local = it != pages.end() ? &it->second : nullptr;
+
+    // Variables of the page hide the ones of "[*]" with the same name
+    const auto bHidden = [&](const utte_string& name) -> bool
+    {
+        return local != nullptr && (local->values.contains(name) || local->arrays.contains(name) || local->maps.contains(name));
+    };
+
+    const auto each = [&](const BuildBindings& bindings, bool bGlobal) -> void
+    {
+        for (auto& a : bindings.values)
+            if (!bGlobal || !bHidden(a.first))
+                push(a.first, a.second);
+        for (auto& a : bindings.arrays)
+            if (!bGlobal || !bHidden(a.first))
+                push(a.first, a.second);
+        for (auto& a : bindings.maps)
+            if (!bGlobal || !bHidden(a.first))
+                push(a.first, a.second);
+    };
+
+    if (local != nullptr)
+        each(*local, false);
+    each(global, true);
+}
+
+std::vector<UTTE::BuildFileResult> UTTE::Build::run(const UTTE::BuildOptions& options, const UTTE::BuildManifest& manifest) noexcept
+{
+    namespace fs = std::filesystem;
+    std::vector<BuildFileResult> results;
+
+    std::error_code ec;
+    for (auto it = fs::recursive_directory_iterator(options.input, ec); !ec && it != fs::recursive_directory_iterator(); it.increment(ec))
+    {
+        std::error_code e;
+        auto& path = it->path();
+        if (!it->is_regular_file(e) || path.extension() != options.extension || path.filename().string().starts_with('_'))
+            continue;
+
+        auto relative = path.lexically_relative(options.input);
+        auto output = fs::path(options.output) / relative;
+        output.replace_extension(options.outputExtension);
+        results.push_back({ .input = relative.generic_string(), .output = output.string() });
+    }
+    std::sort(results.begin(), results.end(), [](const BuildFileResult& a, const BuildFileResult& b) -> bool { return a.input < b.input; });
+
+    if (options.bIncludeFromInput)
+    {
+        PartialCache::setLoader([input = fs::path(options.input)](const utte_string& path, utte_string& out) -> bool
+        {
+            return PartialCache::loadFile(fs::path(path).is_absolute() ? path : (input / path).string(), out);
+        });
+    }
+
+    // The hashes of the previous build, by output path
+    utte_map<utte_string, uint64_t> hashes;
+    auto hashesLocation = (fs::path(options.output) / ".utte-build").string();
+    {
+        std::ifstream in(hashesLocation);
+        uint64_t h = 0;
+        utte_string location;
+        while (in >> std::hex >> h && std::getline(in >> std::ws, location))
+            hashes[location] = h;
+    }
+
+    ThreadPool threads(options.threads);
+    GeneratorPool generators(threads.size());
+    for (auto& a : results)
+    {
+        // Every task only writes to its own result, and the hashes are only read while rendering
+        threads.submit([&options, &manifest, &hashes, &generators, &result = a]() -> void
+        {
+            auto begin = std::chrono::steady_clock::now();
+            auto generator = generators.acquire();
+            if (generator->loadFromFile((fs::path(options.input) / result.input).string()) != UTTE_INITIALISATION_RESULT_SUCCESS)
+                result.state = BuildFileResult::UTTE_BUILD_FILE_READ_ERROR;
+            else
+            {
+                manifest.bind(result.input, *generator);
+                auto rendered = generator->render();
+                if (rendered.status != UTTE_PARSE_STATUS_SUCCESS)
+                {
+                    result.state = BuildFileResult::UTTE_BUILD_FILE_RENDER_ERROR;
+                    result.status = rendered.status;
+                }
+                else
+                {
+                    result.hash = hash(*rendered.result);
+                    auto it = hashes.find(result.output);
+
+                    std::error_code e;
+                    if (it != hashes.end() && it->second == result.hash && fs::exists(result.output, e))
+                        result.state = BuildFileResult::UTTE_BUILD_FILE_UNCHANGED;
+                    else
+                    {
+                        fs::create_directories(fs::path(result.output).parent_path(), e);
+                        std::ofstream out(result.output, std::ios::binary | std::ios::trunc);
+                        out.write(rendered.result->data(), static_cast<std::streamsize>(rendered.result->size()));
+                        result.state = out ? BuildFileResult::UTTE_BUILD_FILE_WRITTEN : BuildFileResult::UTTE_BUILD_FILE_WRITE_ERROR;
+                    }
+                }
+            }
+            result.microseconds = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+        });
+    }
+    threads.wait();
+
+    // Pages that failed keep the hash of their last good output, so that they're compared against it next time
+    for (auto& a : results)
+        if (a.state == BuildFileResult::UTTE_BUILD_FILE_WRITTEN || a.state == BuildFileResult::UTTE_BUILD_FILE_UNCHANGED)
+            hashes[a.output] = a.hash;
+
+    fs::create_directories(options.output, ec);
+    std::ofstream out(hashesLocation, std::ios::trunc);
+    for (auto& a : hashes)
+        out << std::hex << a.second << ' ' << a.first << '\n';
+    return results;
+}
+
+uint64_t UTTE::Build::hash(utte_string_view data) noexcept
+{
+    uint64_t result = 14695981039346656037ull;
+    for (auto a : data)
+    {
+        result ^= static_cast<unsigned char>(a);
+        result *= 1099511628211ull;
+    }
+    return result;
+}
\ No newline at end of file
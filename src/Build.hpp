@@ -0,0 +1,113 @@
+#pragma once
+#include "Generator.hpp"
+
+namespace UTTE
+{
+    // The variables, arrays and maps bound to a page
+    struct MLS_PUBLIC_API BuildBindings
+    {
+        utte_map<utte_string, utte_string> values;
+        utte_map<utte_string, std::vector<utte_string>> arrays;
+        utte_map<utte_string, utte_map<utte_string, utte_string>> maps;
+    };
+
+    /**
+     * @brief The data bound to the pages of a build, loaded from a manifest like this one:
+     *
+     *     # Lines starting with "#" are comments. Lines before the first section belong to "[*]"
+     *     [*]
+     *     title = My site
+     *     nav[] = Home
+     *     links.home = /
+     *     [blog/post.tmpl]
+     *     title = First post
+     *
+     * Variables in "[*]" are bound to every page, the ones in other sections only to the page with that path, relative
+     * to the input directory, and hide variables of "[*]" with the same name. "name[] = value" appends to the array
+     * "name" and "name.key = value" sets "key" in the map "name". Spaces around names and values are removed
+     */
+    class MLS_PUBLIC_API BuildManifest
+    {
+    public:
+        // Returns false if the file couldn't be read or has a line that is not a section, comment or assignment
+        bool load(const utte_string& location) noexcept;
+        bool loadFromString(utte_string_view data) noexcept;
+
+        // Pushes the variables of the page and of "[*]" to the generator. Arrays and maps are bound by address, so the
+        // manifest has to outlive the render
+        void bind(const utte_string& page, Generator& generator) const noexcept;
+
+        // Pushes the variables of the page and of "[*]" to a snapshot that isn't published yet. Arrays and maps are
+        // copied into the snapshot, so it doesn't depend on the manifest
+        void bind(const utte_string& page, Snapshot& snapshot) const noexcept;
+    private:
+        // Calls "push" with the name and the value, array or map of every variable of the page and of "[*]" that isn't
+        // hidden
+        template<typename T>
+        void visit(const utte_string& page, T&& push) const noexcept;
+
+        BuildBindings global;
+        utte_map<utte_string, BuildBindings> pages;
+    };
+
+    struct MLS_PUBLIC_API BuildOptions
+    {
+        utte_string input;
+        utte_string output;
+
+        // Only files with this extension are rendered, and the extension is replaced with "outputExtension". Files
+        // whose name starts with "_", like layouts and partials, are not rendered on their own
+        utte_string extension = ".tmpl";
+        utte_string outputExtension = ".html";
+
+        // The number of threads to render on, 0 means one per hardware thread
+        size_t threads = 0;
+
+        // Resolves relative paths given to "include" from the input directory, by replacing the loader of PartialCache
+        bool bIncludeFromInput = true;
+    };
+
+    struct MLS_PUBLIC_API BuildFileResult
+    {
+        enum State : uint8_t
+        {
+            UTTE_BUILD_FILE_WRITTEN,
+            // The output has the same content hash as in the previous build, so it was not written again
+            UTTE_BUILD_FILE_UNCHANGED,
+            UTTE_BUILD_FILE_READ_ERROR,
+            // "status" holds the error
+            UTTE_BUILD_FILE_RENDER_ERROR,
+            UTTE_BUILD_FILE_WRITE_ERROR,
+        };
+
+        // The path of the page, relative to the input directory
+        utte_string input;
+        utte_string output;
+
+        State state = UTTE_BUILD_FILE_WRITTEN;
+        ParseResultStatus status = UTTE_PARSE_STATUS_SUCCESS;
+
+        // The time it took to load, render and write the page
+        uint64_t microseconds = 0;
+        uint64_t hash = 0;
+    };
+
+    /**
+     * @brief Renders a tree of templates to a tree of output files, for static sites. Pages are rendered in parallel on
+     * a work-stealing ThreadPool, each with a generator from a GeneratorPool. Layouts and partials used through
+     * "include" are compiled once and shared by all pages through the PartialCache. The content hashes of the outputs
+     * are kept in a ".utte-build" file in the output directory, and outputs whose hash didn't change are not written
+     * again, so that tools watching the output only see the pages that changed
+     */
+    class MLS_PUBLIC_API Build
+    {
+    public:
+        // Returns the result of every page, sorted by its path
+        static std::vector<BuildFileResult> run(const BuildOptions& options, const BuildManifest& manifest) noexcept;
+    private:
+        friend class Watch;
+
+        // A 64-bit FNV-1a hash of the rendered output
+        static uint64_t hash(utte_string_view data) noexcept;
+    };
+}
\ No newline at end of file
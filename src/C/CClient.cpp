@@ -0,0 +1,107 @@
+#include "CClient.h"
+#include "../Client.hpp"
+
+#define cast(x) ((UTTE::Client*)(x))
+#define castContext(x) ((UTTE::RequestContext*)(x))
+
+// The value of a result, allocated so that UTTE_CGenerator_tryFreeCVariable can free it
+static UTTE_CVariable makeResult(const utte_string& value, UTTE::ParseResultStatus status)
+{
+    auto* data = (char*)malloc(value.size() + 1);
+    memcpy(data, value.c_str(), value.size() + 1);
+    return { .value = data, .type = UTTE_VARIABLE_TYPE_HINT_NORMAL, .bDeallocate = true, .status = status };
+}
+
+UTTE_CClient* UTTE_CClient_Connect(const char* socket)
+{
+    auto* client = new UTTE::Client();
+    if (!client->connect(socket))
+    {
+        delete client;
+        return nullptr;
+    }
+    return client;
+}
+
+void UTTE_CClient_Free(UTTE_CClient* client)
+{
+    delete cast(client);
+}
+
+UTTE_CRequestContext* UTTE_CRequestContext_Allocate()
+{
+    return new UTTE::RequestContext();
+}
+
+void UTTE_CRequestContext_pushVariable(UTTE_CRequestContext* context, const char* name, const char* value)
+{
+    castContext(context)->pushVariable(name, value);
+}
+
+void UTTE_CRequestContext_pushArray(UTTE_CRequestContext* context, const char* name, char** arr, size_t size)
+{
+    castContext(context)->beginArray(name, (uint32_t)size);
+    for (size_t i = 0; i < size; i++)
+        castContext(context)->pushString(arr[i]);
+}
+
+void UTTE_CRequestContext_pushMap(UTTE_CRequestContext* context, const char* name, UTTE_CPair* map, size_t size)
+{
+    castContext(context)->beginMap(name, (uint32_t)size);
+    for (size_t i = 0; i < size; i++)
+    {
+        castContext(context)->pushString(map[i].key);
+        castContext(context)->pushString(map[i].val);
+    }
+}
+
+void UTTE_CRequestContext_clear(UTTE_CRequestContext* context)
+{
+    castContext(context)->clear();
+}
+
+void UTTE_CRequestContext_Free(UTTE_CRequestContext* context)
+{
+    delete castContext(context);
+}
+
+UTTE_CVariable UTTE_CClient_render(UTTE_CClient* client, const char* id, const UTTE_CRequestContext* context)
+{
+    static const UTTE::RequestContext empty{};
+    utte_string output;
+    auto status = cast(client)->render(id, context == nullptr ? empty : *(const UTTE::RequestContext*)context, output);
+    return makeResult(output, status);
+}
+
+UTTE_CVariable UTTE_CClient_renderJSON(UTTE_CClient* client, const char* id, const char* json)
+{
+    utte_string output;
+    auto status = cast(client)->renderJSON(id, json, output);
+    return makeResult(output, status);
+}
+
+UTTE_ParseResultStatus UTTE_CClient_renderStream(UTTE_CClient* client, const char* id, const UTTE_CRequestContext* context, UTTE_CChunkCallback callback, void* userData)
+{
+    static const UTTE::RequestContext empty{};
+    return cast(client)->render(id, context == nullptr ? empty : *(const UTTE::RequestContext*)context, [callback, userData](utte_string_view chunk) -> void
+    {
+        callback(chunk.data(), chunk.size(), userData);
+    });
+}
+
+UTTE_CVariable UTTE_CClient_stats(UTTE_CClient* client)
+{
+    utte_string output;
+    auto status = cast(client)->stats(output);
+    return makeResult(output, status);
+}
+
+UTTE_ParseResultStatus UTTE_CClient_reload(UTTE_CClient* client)
+{
+    return cast(client)->reload();
+}
+
+uint64_t UTTE_CClient_getMicroseconds(UTTE_CClient* client)
+{
+    return cast(client)->getMicroseconds();
+}
\ No newline at end of file
@@ -0,0 +1,47 @@
+#pragma once
+#include "CGenerator.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+    typedef void UTTE_CClient;
+    typedef void UTTE_CRequestContext;
+
+    // Called with every chunk of the output of a render as it arrives, see UTTE_CClient_renderStream
+    typedef void(*UTTE_CChunkCallback)(const char* data, size_t size, void* userData);
+
+    // Connects to the socket of utte-serve. Returns NULL if it couldn't connect. Free with UTTE_CClient_Free. Requests
+    // on a client are sent one after the other, so use one client per thread
+    MLS_PUBLIC_API UTTE_CClient* UTTE_CClient_Connect(const char* socket);
+    MLS_PUBLIC_API void UTTE_CClient_Free(UTTE_CClient* client);
+
+    // The variables of a render request. Free with UTTE_CRequestContext_Free
+    MLS_PUBLIC_API UTTE_CRequestContext* UTTE_CRequestContext_Allocate();
+    MLS_PUBLIC_API void UTTE_CRequestContext_pushVariable(UTTE_CRequestContext* context, const char* name, const char* value);
+    MLS_PUBLIC_API void UTTE_CRequestContext_pushArray(UTTE_CRequestContext* context, const char* name, char** arr, size_t size);
+    MLS_PUBLIC_API void UTTE_CRequestContext_pushMap(UTTE_CRequestContext* context, const char* name, UTTE_CPair* map, size_t size);
+    MLS_PUBLIC_API void UTTE_CRequestContext_clear(UTTE_CRequestContext* context);
+    MLS_PUBLIC_API void UTTE_CRequestContext_Free(UTTE_CRequestContext* context);
+
+    // Renders the template with the given id on the server. The context may be NULL. The value is heap-allocated,
+    // free it by calling "UTTE_CGenerator_tryFreeCVariable". If the connection failed the status is
+    // UTTE_PARSE_STATUS_CONNECTION_FAILED, and the client has to be connected again
+    MLS_PUBLIC_API UTTE_CVariable UTTE_CClient_render(UTTE_CClient* client, const char* id, const UTTE_CRequestContext* context);
+
+    // Like UTTE_CClient_render, with the variables given as a flat JSON object
+    MLS_PUBLIC_API UTTE_CVariable UTTE_CClient_renderJSON(UTTE_CClient* client, const char* id, const char* json);
+
+    // Like UTTE_CClient_render, but calls the callback with every chunk of the output instead of returning it
+    MLS_PUBLIC_API UTTE_ParseResultStatus UTTE_CClient_renderStream(UTTE_CClient* client, const char* id, const UTTE_CRequestContext* context, UTTE_CChunkCallback callback, void* userData);
+
+    // Returns the statistics of the server as text, one "name value" pair per line. Free the value like the one of
+    // UTTE_CClient_render
+    MLS_PUBLIC_API UTTE_CVariable UTTE_CClient_stats(UTTE_CClient* client);
+    MLS_PUBLIC_API UTTE_ParseResultStatus UTTE_CClient_reload(UTTE_CClient* client);
+
+    // The time the server took to handle the last request, 0 if it failed
+    MLS_PUBLIC_API uint64_t UTTE_CClient_getMicroseconds(UTTE_CClient* client);
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "CGenerator.h"
 #include "../Generator.hpp"
+#include "../PartialCache.hpp"
+#include "../Snapshot.hpp"
 
 #define cast(x) ((UTTE::Generator*)(x))
 
@@ -39,6 +41,32 @@ UTTE_CParseResult UTTE_CGenerator_parse(UTTE_CGenerator* generator)
     return { .status = tmp.status, .result = tmp.result->c_str() };
 }
 
+void UTTE_CGenerator_reset(UTTE_CGenerator* generator)
+{
+    cast(generator)->reset();
+}
+
+UTTE_ParseResultStatus UTTE_CGenerator_compile(UTTE_CGenerator* generator)
+{
+    return cast(generator)->compile();
+}
+
+UTTE_CParseResult UTTE_CGenerator_render(UTTE_CGenerator* generator)
+{
+    auto tmp = cast(generator)->render();
+    return { .status = tmp.status, .result = tmp.result->c_str() };
+}
+
+UTTE_InitialisationResult UTTE_CGenerator_savePrecompiled(UTTE_CGenerator* generator, const char* location)
+{
+    return cast(generator)->savePrecompiled(location);
+}
+
+UTTE_InitialisationResult UTTE_CGenerator_loadFromPrecompiled(UTTE_CGenerator* generator, const char* location, const char* templateLocation)
+{
+    return cast(generator)->loadFromPrecompiled(location, templateLocation == nullptr ? "" : templateLocation);
+}
+
 UTTE_CFunctionHandle* UTTE_CGenerator_pushVariable(UTTE_CGenerator* generator, const UTTE_CVariable var, const char* name)
 {
     auto& func = cast(generator)->pushVariable({ .value = var.value, .type = var.type }, name);
@@ -62,7 +90,7 @@ UTTE_CFunctionHandle* UTTE_CGenerator_pushFunction(UTTE_CGenerator* generator, c
         // them here if the user informs us using this boolean
         UTTE_CGenerator_tryFreeCVariable(&result);
         return ret;
-    } });
+    }, .bPure = f.bPure, .bStatic = f.bStatic });
 
     if (f.bDeallocate)
         free((void*)f.name);
@@ -120,6 +148,167 @@ UTTE_CVariable UTTE_CGenerator_makeMap(UTTE_CGenerator* generator, UTTE_CPair* m
     return { .value = UTTE_strdup(variable.value.c_str()), .type = variable.type, .bDeallocate = true };
 }
 
+UTTE_CVariable UTTE_CGenerator_makeSequence(UTTE_CGenerator* generator, UTTE_CSequence sequence)
+{
+    auto& seq = cast(generator)->requestSequenceWithGC();
+    if (sequence.begin != nullptr)
+        seq.begin = [sequence]() -> void { sequence.begin(sequence.userData); };
+
+    // Elements that have to be deallocated are copied to a buffer first, which the element then views
+    seq.next = [sequence, buffer = utte_string()](UTTE::VariableView& element) mutable -> bool
+    {
+        UTTE_CVariable result{ .value = "", .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
+        if (sequence.next == nullptr || !sequence.next(sequence.userData, &result))
+            return false;
+
+        if (result.bDeallocate)
+        {
+            buffer = result.value;
+            UTTE_CGenerator_tryFreeCVariable(&result);
+            element = { .value = utte_string_view(buffer.data(), buffer.size()), .type = result.type };
+        }
+        else
+            element = { .value = result.value, .type = result.type };
+        return true;
+    };
+
+    auto variable = UTTE::Generator::makeSequence(seq);
+    return { .value = UTTE_strdup(variable.value.c_str()), .type = variable.type, .bDeallocate = true };
+}
+
+UTTE_CObjectType* UTTE_CGenerator_makeObjectType(UTTE_CGenerator* generator)
+{
+    return &cast(generator)->requestObjectTypeWithGC();
+}
+
+void UTTE_CGenerator_addField(UTTE_CObjectType* type, const char* name, UTTE_CFieldAccessor accessor)
+{
+    ((UTTE::ObjectType*)type)->field(name, [accessor](const void* object, utte_string& buffer) -> UTTE::VariableView
+    {
+        auto result = accessor(object);
+        if (!result.bDeallocate)
+            return { .value = result.value, .type = result.type };
+
+        buffer = result.value;
+        UTTE_CGenerator_tryFreeCVariable(&result);
+        return { .value = utte_string_view(buffer.data(), buffer.size()), .type = result.type };
+    });
+}
+
+UTTE_CVariable UTTE_CGenerator_makeObject(UTTE_CGenerator*, const UTTE_CObjectType* type, const void* object)
+{
+    auto variable = UTTE::Generator::makeObject(*(const UTTE::ObjectType*)type, object);
+    return { .value = UTTE_strdup(variable.value.c_str()), .type = variable.type, .bDeallocate = true };
+}
+
+UTTE_CVariable UTTE_CGenerator_makeObjectArray(UTTE_CGenerator* generator, const UTTE_CObjectType* type, const void* objects, size_t size, size_t stride)
+{
+    auto& seq = cast(generator)->requestSequenceWithGC();
+    seq = ((const UTTE::ObjectType*)type)->sequence(objects, size, stride);
+
+    auto variable = UTTE::Generator::makeSequence(seq);
+    return { .value = UTTE_strdup(variable.value.c_str()), .type = variable.type, .bDeallocate = true };
+}
+
+UTTE_CSnapshot* UTTE_CSnapshot_Allocate()
+{
+    return new UTTE::Snapshot;
+}
+
+void UTTE_CSnapshot_pushVariable(UTTE_CSnapshot* snapshot, const UTTE_CVariable var, const char* name)
+{
+    ((UTTE::Snapshot*)snapshot)->pushVariable({ .value = var.value, .type = var.type }, name);
+    UTTE_CGenerator_tryFreeCVariable(&var);
+}
+
+UTTE_CVariable UTTE_CSnapshot_makeArray(UTTE_CSnapshot* snapshot, char** arr, size_t size)
+{
+    auto& vector = ((UTTE::Snapshot*)snapshot)->requestArrayWithGC();
+    vector.reserve(size);
+
+    for (size_t i = 0; i < size; i++)
+        vector.emplace_back(arr[i]);
+
+    auto variable = UTTE::Generator::makeArray(vector);
+    return { .value = UTTE_strdup(variable.value.c_str()), .type = variable.type, .bDeallocate = true };
+}
+
+UTTE_CVariable UTTE_CSnapshot_makeMap(UTTE_CSnapshot* snapshot, UTTE_CPair* map, size_t size)
+{
+    auto& dict = ((UTTE::Snapshot*)snapshot)->requestMapWithGC();
+
+    for (size_t i = 0; i < size; i++)
+        dict.insert({ map[i].key, map[i].val });
+
+    auto variable = UTTE::Generator::makeMap(dict);
+    return { .value = UTTE_strdup(variable.value.c_str()), .type = variable.type, .bDeallocate = true };
+}
+
+void UTTE_CSnapshot_Free(UTTE_CSnapshot* snapshot)
+{
+    delete (UTTE::Snapshot*)snapshot;
+}
+
+UTTE_CSnapshotSlot* UTTE_CSnapshotSlot_Allocate()
+{
+    return new UTTE::SnapshotSlot;
+}
+
+void UTTE_CSnapshotSlot_publish(UTTE_CSnapshotSlot* slot, UTTE_CSnapshot* snapshot)
+{
+    ((UTTE::SnapshotSlot*)slot)->publish(std::shared_ptr<UTTE::Snapshot>((UTTE::Snapshot*)snapshot));
+}
+
+void UTTE_CSnapshotSlot_Free(UTTE_CSnapshotSlot* slot)
+{
+    delete (UTTE::SnapshotSlot*)slot;
+}
+
+void UTTE_CGenerator_setSnapshot(UTTE_CGenerator* generator, const UTTE_CSnapshotSlot* slot)
+{
+    cast(generator)->setSnapshot(slot != nullptr ? ((const UTTE::SnapshotSlot*)slot)->load() : nullptr);
+}
+
+void UTTE_CGenerator_resetScratch(UTTE_CGenerator* generator)
+{
+    cast(generator)->resetScratch();
+}
+
+void UTTE_CGenerator_setScratchLimit(UTTE_CGenerator* generator, size_t bytes)
+{
+    cast(generator)->setScratchLimit(bytes);
+}
+
+void UTTE_CGenerator_setMaxDepth(UTTE_CGenerator* generator, size_t depth)
+{
+    cast(generator)->setMaxDepth(depth);
+}
+
+void UTTE_CGenerator_setUTF8Mode(UTTE_CGenerator* generator, UTTE_UTF8Mode mode)
+{
+    cast(generator)->setUTF8Mode(mode);
+}
+
+void UTTE_CGenerator_setBudget(UTTE_CGenerator* generator, UTTE_RenderBudget budget)
+{
+    cast(generator)->setBudget(budget);
+}
+
+void UTTE_CGenerator_setMemoCapacity(UTTE_CGenerator* generator, size_t entries, bool bPerRender)
+{
+    cast(generator)->setMemoCapacity(entries, bPerRender);
+}
+
+void UTTE_CGenerator_clearMemo(UTTE_CGenerator* generator)
+{
+    cast(generator)->clearMemo();
+}
+
+UTTE_MemoStats UTTE_CGenerator_getMemoStats(UTTE_CGenerator* generator)
+{
+    return cast(generator)->getMemoStats();
+}
+
 void UTTE_CGenerator_Free(UTTE_CGenerator* generator)
 {
     delete (UTTE::Generator*)generator;
@@ -134,6 +323,11 @@ void UTTE_CGenerator_tryFreeCVariable(const UTTE_CVariable* var)
 void UTTE_CGenerator_modify(UTTE_CFunctionHandle* handle, UTTE_CFunction function)
 {
     auto* f = (UTTE::Function*)handle;
+    f->viewFunction = nullptr;
+    f->asyncFunction = nullptr;
+    f->bVariable = false;
+    f->bPure = function.bPure;
+    f->bStatic = function.bStatic;
     f->function = [function](std::vector<UTTE::Variable>& args, UTTE::Generator* gen) -> UTTE::Variable
     {
         std::vector<UTTE_CVariable> cvars;
@@ -152,7 +346,10 @@ void UTTE_CGenerator_modify(UTTE_CFunctionHandle* handle, UTTE_CFunction functio
     };
     // If given an empty string, don't change the name
     if (strlen(function.name) > 0)
+    {
         f->name = function.name;
+        f->symbol = UTTE::SymbolTable::intern(f->name);
+    }
 
     // Deallocate the name if needed
     if (function.bDeallocate)
@@ -164,14 +361,28 @@ const char* UTTE_CGenerator_getName(UTTE_CFunctionHandle* handle)
     return ((UTTE::Function*)handle)->name.c_str();
 }
 
+void UTTE_CGenerator_setStatic(UTTE_CFunctionHandle* handle, bool bStatic)
+{
+    ((UTTE::Function*)handle)->bStatic = bStatic;
+}
+
+UTTE_CVariable UTTE_CGenerator_specialize(UTTE_CGenerator* generator)
+{
+    utte_string residual;
+    auto status = cast(generator)->specialize(residual);
+    if (status != UTTE_PARSE_STATUS_SUCCESS)
+        return { .value = "", .type = UTTE_VARIABLE_TYPE_HINT_NORMAL, .bDeallocate = false, .status = status };
+    return { .value = UTTE_strdup(residual.c_str()), .type = UTTE_VARIABLE_TYPE_HINT_NORMAL, .bDeallocate = true, .status = status };
+}
+
 bool UTTE_CoreFuncs_getBooleanV(const char* str)
 {
-    return UTTE::CoreFuncs::getBooleanV(str);
+    return UTTE::CoreFuncs::getBooleanV(utte_string_view(str));
 }
 
 char** UTTE_CoreFuncs_getArray(const UTTE_CVariable* variable, size_t* size)
 {
-    auto* arr = UTTE::CoreFuncs::getArray({ .value = variable->value, .type = variable->type });
+    auto* arr = UTTE::CoreFuncs::getArray(UTTE::VariableView{ .value = variable->value, .type = variable->type });
     if (arr == nullptr)
         return nullptr;
 
@@ -185,7 +396,7 @@ char** UTTE_CoreFuncs_getArray(const UTTE_CVariable* variable, size_t* size)
 
 UTTE_CPair* UTTE_CoreFuncs_getMap(const UTTE_CVariable* variable, size_t* size)
 {
-    auto* map = UTTE::CoreFuncs::getMap({ .value = variable->value, .type = variable->type });
+    auto* map = UTTE::CoreFuncs::getMap(UTTE::VariableView{ .value = variable->value, .type = variable->type });
     if (map == nullptr)
         return nullptr;
     *size = map->size();
@@ -205,6 +416,16 @@ UTTE_CPair* UTTE_CoreFuncs_getMap(const UTTE_CVariable* variable, size_t* size)
     return result;
 }
 
+const char* UTTE_CoreFuncs_mapAt(const UTTE_CVariable* variable, const char* key)
+{
+    auto* map = UTTE::CoreFuncs::getMap(UTTE::VariableView{ .value = variable->value, .type = variable->type });
+    if (map == nullptr)
+        return nullptr;
+
+    auto* value = UTTE::CoreFuncs::find(*map, utte_string_view(key));
+    return value == nullptr ? nullptr : value->c_str();
+}
+
 void UTTE_CoreFuncs_freeArray(char** array, size_t size)
 {
     for (size_t i = 0; i < size; i++)
@@ -220,4 +441,29 @@ void UTTE_CoreFuncs_freeMap(UTTE_CPair* map, size_t size)
         free((void*)map[i].key);
     }
     free((void*)map);
+}
+
+void UTTE_PartialCache_setLoader(UTTE_CIncludeLoaderCallback loader)
+{
+    if (loader == nullptr)
+    {
+        UTTE::PartialCache::setLoader(UTTE::PartialCache::loadFile);
+        return;
+    }
+
+    UTTE::PartialCache::setLoader([loader](const utte_string& path, utte_string& out) -> bool
+    {
+        char* result = loader(path.c_str());
+        if (result == nullptr)
+            return false;
+
+        out = result;
+        free((void*)result);
+        return true;
+    });
+}
+
+void UTTE_PartialCache_clear()
+{
+    UTTE::PartialCache::clear();
 }
\ No newline at end of file
@@ -8,9 +8,20 @@ extern "C"
     typedef struct UTTE_CVariable UTTE_CVariable;
     typedef void UTTE_CGenerator;
     typedef void UTTE_CFunctionHandle;
+    typedef void UTTE_CObjectType;
+    typedef void UTTE_CSnapshot;
+    typedef void UTTE_CSnapshotSlot;
 
     typedef UTTE_CVariable(*UTTE_CFunctionCallback)(UTTE_CVariable*, size_t, UTTE_CGenerator*);
 
+    // Loads the partial at the given path for the "include" function. Return a heap-allocated string that will be
+    // freed by the library, or NULL if the partial could not be found
+    typedef char*(*UTTE_CIncludeLoaderCallback)(const char*);
+
+    // Reads a field of an object, see UTTE_CGenerator_addField. The value is copied right away, so it may point into
+    // the object. If "bDeallocate" is set it is freed
+    typedef UTTE_CVariable(*UTTE_CFieldAccessor)(const void*);
+
     typedef struct MLS_PUBLIC_API UTTE_CVariable
     {
         const char* value;
@@ -30,8 +41,29 @@ extern "C"
         const char* name;
         UTTE_CFunctionCallback function;
         bool bDeallocate;
+
+        // Set if the result only depends on the arguments, so that it can be cached, see UTTE_CGenerator_setMemoCapacity
+        bool bPure;
+
+        // Set if the result only depends on the arguments and never changes, so that it can be called ahead of time by
+        // UTTE_CGenerator_specialize
+        bool bStatic;
     } UTTE_CFunction;
 
+    // Produces the elements of a "for" loop one at a time, see UTTE_CGenerator_makeSequence
+    typedef struct MLS_PUBLIC_API UTTE_CSequence
+    {
+        // Passed to the callbacks
+        void* userData;
+
+        // Called at the start of every loop over the sequence. May be NULL
+        void(*begin)(void* userData);
+
+        // Sets the next element and returns true, or returns false at the end of the sequence. The value is copied
+        // right away, so it may point to a buffer that the next call reuses. If "bDeallocate" is set it is freed
+        bool(*next)(void* userData, UTTE_CVariable* element);
+    } UTTE_CSequence;
+
     typedef struct MLS_PUBLIC_API UTTE_CPair
     {
         char* key;
@@ -46,6 +78,23 @@ extern "C"
 
     MLS_PUBLIC_API UTTE_CParseResult UTTE_CGenerator_parse(UTTE_CGenerator* generator);
 
+    // Returns the generator to the state it was in after being allocated, while keeping its memory
+    MLS_PUBLIC_API void UTTE_CGenerator_reset(UTTE_CGenerator* generator);
+
+    // Compiles the loaded template ahead of time. Optional, UTTE_CGenerator_render compiles it when needed
+    MLS_PUBLIC_API UTTE_ParseResultStatus UTTE_CGenerator_compile(UTTE_CGenerator* generator);
+
+    // Like UTTE_CGenerator_parse, but runs the compiled template, so it can be rendered again without being reloaded.
+    // The result is valid until the next call to UTTE_CGenerator_render
+    MLS_PUBLIC_API UTTE_CParseResult UTTE_CGenerator_render(UTTE_CGenerator* generator);
+
+    // Saves the compiled template, so that it can be loaded without being compiled again
+    MLS_PUBLIC_API UTTE_InitialisationResult UTTE_CGenerator_savePrecompiled(UTTE_CGenerator* generator, const char* location);
+
+    // Loads a template saved with UTTE_CGenerator_savePrecompiled. If templateLocation is not NULL, the template is loaded
+    // as well, and used instead of the precompiled file if the file is corrupt or stale
+    MLS_PUBLIC_API UTTE_InitialisationResult UTTE_CGenerator_loadFromPrecompiled(UTTE_CGenerator* generator, const char* location, const char* templateLocation);
+
     // If var->bDeallocate is set to true it will automatically deallocate the value after use
     MLS_PUBLIC_API UTTE_CFunctionHandle* UTTE_CGenerator_pushVariable(UTTE_CGenerator* generator, UTTE_CVariable var, const char* name);
     // If f->bDeallocate is set to true it will automatically deallocate the value after use
@@ -63,6 +112,87 @@ extern "C"
     // yourself by calling "UTTE_CGenerator_tryFreeCVariable"
     MLS_PUBLIC_API UTTE_CVariable UTTE_CGenerator_makeMap(UTTE_CGenerator* generator, UTTE_CPair* map, size_t size);
 
+    // Makes a sequence, whose elements are produced by the callbacks while "for" iterates it, so that they don't have
+    // to be copied into an array first. "userData" has to outlive the generator. Data inside the return value is
+    // heap-allocated. Either call "UTTE_CGenerator_pushVariable" or deallocate it yourself by calling
+    // "UTTE_CGenerator_tryFreeCVariable"
+    MLS_PUBLIC_API UTTE_CVariable UTTE_CGenerator_makeSequence(UTTE_CGenerator* generator, UTTE_CSequence sequence);
+
+    // Makes a type that describes the fields of objects, so that they can be bound by address instead of being copied
+    // into a map. Freed with the generator
+    MLS_PUBLIC_API UTTE_CObjectType* UTTE_CGenerator_makeObjectType(UTTE_CGenerator* generator);
+
+    // Adds a field to a type. "at" and "for key val" call the accessor only when they read the field
+    MLS_PUBLIC_API void UTTE_CGenerator_addField(UTTE_CObjectType* type, const char* name, UTTE_CFieldAccessor accessor);
+
+    // Makes an object of the given type. The object has to outlive the generator. Data inside the return value is
+    // heap-allocated. Either call "UTTE_CGenerator_pushVariable" or deallocate it yourself by calling
+    // "UTTE_CGenerator_tryFreeCVariable"
+    MLS_PUBLIC_API UTTE_CVariable UTTE_CGenerator_makeObject(UTTE_CGenerator* generator, const UTTE_CObjectType* type, const void* object);
+
+    // Makes a sequence of "size" objects, the first at "objects" and each "stride" bytes after the previous one, so that
+    // "for" can iterate an array of structs. Data inside the return value is heap-allocated. Either call
+    // "UTTE_CGenerator_pushVariable" or deallocate it yourself by calling "UTTE_CGenerator_tryFreeCVariable"
+    MLS_PUBLIC_API UTTE_CVariable UTTE_CGenerator_makeObjectArray(UTTE_CGenerator* generator, const UTTE_CObjectType* type, const void* objects, size_t size, size_t stride);
+
+    // Makes a snapshot of variables that any number of generators can read at the same time, see
+    // UTTE_CSnapshotSlot_publish. Free with UTTE_CSnapshot_Free, unless it's published
+    MLS_PUBLIC_API UTTE_CSnapshot* UTTE_CSnapshot_Allocate();
+
+    // If var->bDeallocate is set to true it will automatically deallocate the value after use
+    MLS_PUBLIC_API void UTTE_CSnapshot_pushVariable(UTTE_CSnapshot* snapshot, UTTE_CVariable var, const char* name);
+
+    // Like UTTE_CGenerator_makeArray, but the array is owned by the snapshot
+    MLS_PUBLIC_API UTTE_CVariable UTTE_CSnapshot_makeArray(UTTE_CSnapshot* snapshot, char** arr, size_t size);
+
+    // Like UTTE_CGenerator_makeMap, but the map is owned by the snapshot
+    MLS_PUBLIC_API UTTE_CVariable UTTE_CSnapshot_makeMap(UTTE_CSnapshot* snapshot, UTTE_CPair* map, size_t size);
+
+    MLS_PUBLIC_API void UTTE_CSnapshot_Free(UTTE_CSnapshot* snapshot);
+
+    // Holds the current snapshot. Free with UTTE_CSnapshotSlot_Free, once no generator loads from it
+    MLS_PUBLIC_API UTTE_CSnapshotSlot* UTTE_CSnapshotSlot_Allocate();
+
+    // Makes the snapshot the current one and takes ownership of it. It's freed once it was replaced and no generator
+    // uses it anymore. Thread-safe
+    MLS_PUBLIC_API void UTTE_CSnapshotSlot_publish(UTTE_CSnapshotSlot* slot, UTTE_CSnapshot* snapshot);
+
+    MLS_PUBLIC_API void UTTE_CSnapshotSlot_Free(UTTE_CSnapshotSlot* slot);
+
+    // Makes the variables of the current snapshot of the slot visible to the generator, after its own variables, until
+    // this is called again or the generator is reset. Pass NULL to remove the snapshot. Thread-safe with respect to
+    // the slot
+    MLS_PUBLIC_API void UTTE_CGenerator_setSnapshot(UTTE_CGenerator* generator, const UTTE_CSnapshotSlot* slot);
+
+    // Makes the containers made while rendering, for example by "list" and "dict", available for reuse. Call it between
+    // renders
+    MLS_PUBLIC_API void UTTE_CGenerator_resetScratch(UTTE_CGenerator* generator);
+
+    // Sets the number of bytes these containers may hold between resets. Renders that need more fail with
+    // UTTE_PARSE_STATUS_OUT_OF_MEMORY. 0 means no limit
+    MLS_PUBLIC_API void UTTE_CGenerator_setScratchLimit(UTTE_CGenerator* generator, size_t bytes);
+
+    // Sets how deep expressions and bodies of functions may be nested. Renders that nest deeper fail with
+    // UTTE_PARSE_STATUS_DEPTH_EXCEEDED. 0 means no limit
+    MLS_PUBLIC_API void UTTE_CGenerator_setMaxDepth(UTTE_CGenerator* generator, size_t depth);
+
+    // Sets whether loading a template checks that it is valid UTF-8, and whether invalid bytes are replaced with U+FFFD.
+    // Loads of invalid templates return UTTE_INITIALISATION_RESULT_INVALID_UTF8
+    MLS_PUBLIC_API void UTTE_CGenerator_setUTF8Mode(UTTE_CGenerator* generator, UTTE_UTF8Mode mode);
+
+    // Limits the time, expressions, loop iterations and output of every render. Renders that exceed a limit fail with
+    // UTTE_PARSE_STATUS_BUDGET_EXCEEDED, and their result holds the output rendered up to that point. 0 means no limit
+    MLS_PUBLIC_API void UTTE_CGenerator_setBudget(UTTE_CGenerator* generator, UTTE_RenderBudget budget);
+
+    // Sets how many results of pure functions are cached. 0 disables caching. If "bPerRender" is true, the cache is
+    // cleared whenever a render starts
+    MLS_PUBLIC_API void UTTE_CGenerator_setMemoCapacity(UTTE_CGenerator* generator, size_t entries, bool bPerRender);
+
+    // Removes all cached results of pure functions. Call it after changing a pure function with UTTE_CGenerator_modify
+    MLS_PUBLIC_API void UTTE_CGenerator_clearMemo(UTTE_CGenerator* generator);
+
+    MLS_PUBLIC_API UTTE_MemoStats UTTE_CGenerator_getMemoStats(UTTE_CGenerator* generator);
+
     MLS_PUBLIC_API void UTTE_CGenerator_Free(UTTE_CGenerator* generator);
 
     // Named "tryFreeCVariable" because it will not free the value if "UTTE_CVariable::bDeallocate" is not set to true
@@ -77,6 +207,13 @@ extern "C"
     // Returns the name of a function from a function handle
     MLS_PUBLIC_API const char* UTTE_CGenerator_getName(UTTE_CFunctionHandle* handle);
 
+    // Marks a variable as fixed for as long as a template is used, so that UTTE_CGenerator_specialize substitutes it
+    MLS_PUBLIC_API void UTTE_CGenerator_setStatic(UTTE_CFunctionHandle* handle, bool bStatic);
+
+    // Partially evaluates the loaded template against the static variables and functions. Returns the residual template,
+    // which should be freed with UTTE_CGenerator_tryFreeCVariable
+    MLS_PUBLIC_API UTTE_CVariable UTTE_CGenerator_specialize(UTTE_CGenerator* generator);
+
     // Returns a bool given a boolean value as a string
     MLS_PUBLIC_API bool UTTE_CoreFuncs_getBooleanV(const char* str);
 
@@ -86,10 +223,21 @@ extern "C"
     // Should be explicitly freed using "UTTE_CoreFuncs_freeMap"
     MLS_PUBLIC_API UTTE_CPair* UTTE_CoreFuncs_getMap(const UTTE_CVariable* variable, size_t* size);
 
+    // Looks up a key in a map without copying the map. Returns NULL if the variable isn't a map or the key isn't in it.
+    // The result is owned by the map and should not be freed
+    MLS_PUBLIC_API const char* UTTE_CoreFuncs_mapAt(const UTTE_CVariable* variable, const char* key);
+
     MLS_PUBLIC_API void UTTE_CoreFuncs_freeArray(char** array, size_t size);
 
     MLS_PUBLIC_API void UTTE_CoreFuncs_freeMap(UTTE_CPair* map, size_t size);
 
+    // Sets the loader used by the "include" function for all generators and clears the partial cache. Pass NULL to
+    // go back to loading partials from files
+    MLS_PUBLIC_API void UTTE_PartialCache_setLoader(UTTE_CIncludeLoaderCallback loader);
+
+    // Clears the partial cache, so that partials are loaded again on their next use
+    MLS_PUBLIC_API void UTTE_PartialCache_clear();
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
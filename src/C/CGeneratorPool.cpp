@@ -0,0 +1,29 @@
+#include "CGeneratorPool.h"
+#include "../GeneratorPool.hpp"
+
+#define cast(x) ((UTTE::GeneratorPool*)(x))
+
+UTTE_CGeneratorPool* UTTE_CGeneratorPool_Allocate(size_t maxIdle)
+{
+    return new UTTE::GeneratorPool(maxIdle);
+}
+
+UTTE_CGenerator* UTTE_CGeneratorPool_acquire(UTTE_CGeneratorPool* pool)
+{
+    return cast(pool)->acquire().release();
+}
+
+void UTTE_CGeneratorPool_release(UTTE_CGeneratorPool* pool, UTTE_CGenerator* generator)
+{
+    cast(pool)->release((UTTE::Generator*)generator);
+}
+
+void UTTE_CGeneratorPool_reserve(UTTE_CGeneratorPool* pool, size_t count)
+{
+    cast(pool)->reserve(count);
+}
+
+void UTTE_CGeneratorPool_Free(UTTE_CGeneratorPool* pool)
+{
+    delete cast(pool);
+}
\ No newline at end of file
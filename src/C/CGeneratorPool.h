@@ -0,0 +1,25 @@
+#pragma once
+#include "CGenerator.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+    typedef void UTTE_CGeneratorPool;
+
+    // A thread-safe pool of generators. At most maxIdle generators are kept in the pool. Free with
+    // UTTE_CGeneratorPool_Free, after all acquired generators were released
+    MLS_PUBLIC_API UTTE_CGeneratorPool* UTTE_CGeneratorPool_Allocate(size_t maxIdle);
+
+    // Returns a generator in the same state as one returned by UTTE_CGenerator_Allocate. Return it with
+    // UTTE_CGeneratorPool_release instead of freeing it
+    MLS_PUBLIC_API UTTE_CGenerator* UTTE_CGeneratorPool_acquire(UTTE_CGeneratorPool* pool);
+    MLS_PUBLIC_API void UTTE_CGeneratorPool_release(UTTE_CGeneratorPool* pool, UTTE_CGenerator* generator);
+
+    // Allocates generators ahead of time, until the pool holds count of them or is full
+    MLS_PUBLIC_API void UTTE_CGeneratorPool_reserve(UTTE_CGeneratorPool* pool, size_t count);
+
+    MLS_PUBLIC_API void UTTE_CGeneratorPool_Free(UTTE_CGeneratorPool* pool);
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
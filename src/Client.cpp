@@ -0,0 +1,189 @@
+#include "Client.hpp"
+#ifdef __linux__
+    #include <sys/socket.h>
+    #include <sys/un.h>
+    #include <unistd.h>
+#endif
+
+void UTTE::RequestContext::pushVariable(utte_string_view name, utte_string_view value) noexcept
+{
+    buffer += '\0';
+    pushString(name);
+    pushString(value);
+}
+
+void UTTE::RequestContext::pushArray(utte_string_view name, const std::vector<utte_string>& array) noexcept
+{
+    beginArray(name, static_cast<uint32_t>(array.size()));
+    for (const auto& a : array)
+        pushString(a);
+}
+
+void UTTE::RequestContext::pushMap(utte_string_view name, const utte_map<utte_string, utte_string>& map) noexcept
+{
+    beginMap(name, static_cast<uint32_t>(map.size()));
+    for (const auto& a : map)
+    {
+        pushString(a.first);
+        pushString(a.second);
+    }
+}
+
+void UTTE::RequestContext::beginArray(utte_string_view name, uint32_t count) noexcept
+{
+    buffer += '\1';
+    pushString(name);
+    pushSize(count);
+}
+
+void UTTE::RequestContext::beginMap(utte_string_view name, uint32_t count) noexcept
+{
+    buffer += '\2';
+    pushString(name);
+    pushSize(count);
+}
+
+void UTTE::RequestContext::pushString(utte_string_view value) noexcept
+{
+    pushSize(static_cast<uint32_t>(value.size()));
+    buffer.append(value);
+}
+
+void UTTE::RequestContext::clear() noexcept
+{
+    buffer.clear();
+}
+
+utte_string_view UTTE::RequestContext::data() const noexcept
+{
+    return buffer;
+}
+
+void UTTE::RequestContext::pushSize(uint32_t size) noexcept
+{
+    buffer.append(reinterpret_cast<const char*>(&size), sizeof(size));
+}
+
+UTTE::Client::~Client() noexcept
+{
+    close();
+}
+
+bool UTTE::Client::connect(const utte_string& socket) noexcept
+{
+    close();
+#ifdef __linux__
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socket.empty() || socket.size() >= sizeof(address.sun_path))
+        return false;
+    memcpy(address.sun_path, socket.c_str(), socket.size() + 1);
+
+    connection = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (connection == -1)
+        return false;
+    if (::connect(connection, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        close();
+        return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+void UTTE::Client::close() noexcept
+{
+#ifdef __linux__
+    if (connection != -1)
+        ::close(connection);
+#endif
+    connection = -1;
+}
+
+bool UTTE::Client::isConnected() const noexcept
+{
+    return connection != -1;
+}
+
+UTTE::ParseResultStatus UTTE::Client::render(const utte_string& id, const RequestContext& context, utte_string& output) noexcept
+{
+    output.clear();
+    return request(UTTE_SERVER_REQUEST_RENDER, id, UTTE_SERVER_CONTEXT_BINARY, context.data(), [&output](utte_string_view chunk) -> void
+    {
+        output.append(chunk);
+    });
+}
+
+UTTE::ParseResultStatus UTTE::Client::render(const utte_string& id, const RequestContext& context, const std::function<ChunkCallback>& chunk) noexcept
+{
+    return request(UTTE_SERVER_REQUEST_RENDER, id, UTTE_SERVER_CONTEXT_BINARY, context.data(), chunk);
+}
+
+UTTE::ParseResultStatus UTTE::Client::renderJSON(const utte_string& id, utte_string_view json, utte_string& output) noexcept
+{
+    output.clear();
+    return request(UTTE_SERVER_REQUEST_RENDER, id, UTTE_SERVER_CONTEXT_JSON, json, [&output](utte_string_view chunk) -> void
+    {
+        output.append(chunk);
+    });
+}
+
+UTTE::ParseResultStatus UTTE::Client::stats(utte_string& output) noexcept
+{
+    output.clear();
+    return request(UTTE_SERVER_REQUEST_STATS, {}, UTTE_SERVER_CONTEXT_BINARY, {}, [&output](utte_string_view chunk) -> void
+    {
+        output.append(chunk);
+    });
+}
+
+UTTE::ParseResultStatus UTTE::Client::reload() noexcept
+{
+    return request(UTTE_SERVER_REQUEST_RELOAD, {}, UTTE_SERVER_CONTEXT_BINARY, {}, nullptr);
+}
+
+uint64_t UTTE::Client::getMicroseconds() const noexcept
+{
+    return microseconds;
+}
+
+UTTE::ParseResultStatus UTTE::Client::request(ServerRequestType type, utte_string_view id, ServerContextFormat format, utte_string_view context, const std::function<ChunkCallback>& chunk) noexcept
+{
+    microseconds = 0;
+    if (connection == -1)
+        return UTTE_PARSE_STATUS_CONNECTION_FAILED;
+
+    ServerRequestHeader header{ .type = type, .format = format, .idSize = static_cast<uint32_t>(id.size()), .contextSize = context.size() };
+    if (!ServerSocket::write(connection, &header, sizeof(header)) || !ServerSocket::write(connection, id.data(), id.size())
+        || !ServerSocket::write(connection, context.data(), context.size()))
+    {
+        close();
+        return UTTE_PARSE_STATUS_CONNECTION_FAILED;
+    }
+
+    utte_string buffer;
+    while (true)
+    {
+        uint32_t size = 0;
+        if (!ServerSocket::read(connection, &size, sizeof(size)))
+            break;
+        if (size == 0)
+        {
+            ServerResponseTrailer trailer{};
+            if (!ServerSocket::read(connection, &trailer, sizeof(trailer)))
+                break;
+            microseconds = trailer.microseconds;
+            return static_cast<ParseResultStatus>(trailer.status);
+        }
+
+        buffer.resize(size);
+        if (!ServerSocket::read(connection, buffer.data(), size))
+            break;
+        if (chunk)
+            chunk(buffer);
+    }
+    close();
+    return UTTE_PARSE_STATUS_CONNECTION_FAILED;
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+#pragma once
+#include "Server.hpp"
+
+namespace UTTE
+{
+    // Encodes the variables of a render request, see UTTE_SERVER_CONTEXT_BINARY
+    class MLS_PUBLIC_API RequestContext
+    {
+    public:
+        void pushVariable(utte_string_view name, utte_string_view value) noexcept;
+        void pushArray(utte_string_view name, const std::vector<utte_string>& array) noexcept;
+        void pushMap(utte_string_view name, const utte_map<utte_string, utte_string>& map) noexcept;
+
+        // Start an array of "count" elements or a map of "count" entries, that are then added with "pushString", the
+        // key and the value of every entry one after the other. For arrays and maps that aren't held in containers
+        void beginArray(utte_string_view name, uint32_t count) noexcept;
+        void beginMap(utte_string_view name, uint32_t count) noexcept;
+        void pushString(utte_string_view value) noexcept;
+
+        void clear() noexcept;
+        utte_string_view data() const noexcept;
+    private:
+        void pushSize(uint32_t size) noexcept;
+
+        utte_string buffer;
+    };
+
+    /**
+     * @brief A connection to a Server. Requests are sent one after the other, so use one client per thread. If a
+     * request can't be sent or its response can't be read, it returns UTTE_PARSE_STATUS_CONNECTION_FAILED and the
+     * connection is closed, since the server may be in the middle of a response
+     */
+    class MLS_PUBLIC_API Client
+    {
+    public:
+        // Called with every chunk of the output as it arrives
+        typedef void(ChunkCallback)(utte_string_view chunk);
+
+        Client() noexcept = default;
+        ~Client() noexcept;
+
+        Client(const Client&) = delete;
+        Client& operator=(const Client&) = delete;
+
+        // Connects to the socket of a server, closing the current connection. Returns false if it couldn't connect
+        bool connect(const utte_string& socket) noexcept;
+        void close() noexcept;
+        bool isConnected() const noexcept;
+
+        // Render the template with the given id on the server, with the variables of the context bound to it
+        ParseResultStatus render(const utte_string& id, const RequestContext& context, utte_string& output) noexcept;
+        ParseResultStatus render(const utte_string& id, const RequestContext& context, const std::function<ChunkCallback>& chunk) noexcept;
+
+        // Like "render", with the variables given as a JSON object, see UTTE_SERVER_CONTEXT_JSON
+        ParseResultStatus renderJSON(const utte_string& id, utte_string_view json, utte_string& output) noexcept;
+
+        // Returns the ServerStats of the server as text, one "name value" pair per line
+        ParseResultStatus stats(utte_string& output) noexcept;
+
+        // Makes the server load its manifest again and drop its compiled templates
+        ParseResultStatus reload() noexcept;
+
+        // The time the server took to handle the last request, 0 if it failed
+        uint64_t getMicroseconds() const noexcept;
+    private:
+        ParseResultStatus request(ServerRequestType type, utte_string_view id, ServerContextFormat format, utte_string_view context, const std::function<ChunkCallback>& chunk) noexcept;
+
+        int connection = -1;
+        uint64_t microseconds = 0;
+    };
+}
\ No newline at end of file
@@ -36,6 +36,13 @@ extern "C"
     * @enum UTTE_VARIABLE_TYPE_HINT_FUNCTION - A string encoded as a function. Use the `function` function in code to
     * generate such a string. This string can be passed to the static `Generator::parseFunction` to run and get the
     * return value of it
+    * @enum UTTE_VARIABLE_TYPE_HINT_RANGE - A sequence of integers, encoded as its start, stop and step. Made by the
+    * `range` function or the static `Generator::makeRange` function. Its elements are generated when they're read, so
+    * it can be iterated by `for` and indexed by `at` like an array, without allocating one
+    * @enum UTTE_VARIABLE_TYPE_HINT_SEQUENCE - A string, encoded as a sequence, whose elements are produced by callbacks
+    * while `for` iterates it. Use the static `Generator::makeSequence` function to encode one
+    * @enum UTTE_VARIABLE_TYPE_HINT_OBJECT - A string, encoded as an object and the type that describes its fields. Use
+    * the static `Generator::makeObject` function to encode one. `at` and `for` read its fields when they need them
     */
     typedef enum UTTE_VariableTypeHint
     {
@@ -43,6 +50,9 @@ extern "C"
         UTTE_VARIABLE_TYPE_HINT_ARRAY = 1,
         UTTE_VARIABLE_TYPE_HINT_MAP = 2,
         UTTE_VARIABLE_TYPE_HINT_FUNCTION = 3,
+        UTTE_VARIABLE_TYPE_HINT_RANGE = 4,
+        UTTE_VARIABLE_TYPE_HINT_SEQUENCE = 5,
+        UTTE_VARIABLE_TYPE_HINT_OBJECT = 6,
     } UTTE_VariableTypeHint;
 
     // Result after initialising the parser with a string or file. These, especially
@@ -53,8 +63,20 @@ extern "C"
     {
         UTTE_INITIALISATION_RESULT_SUCCESS = 0,
         UTTE_INITIALISATION_RESULT_INVALID_FILE = 1,
+        UTTE_INITIALISATION_RESULT_INVALID_UTF8 = 2,
     } UTTE_InitialisationResult;
 
+    // What loading a template does if it isn't valid UTF-8, see "setUTF8Mode"
+    typedef enum UTTE_UTF8Mode
+    {
+        // The template is not checked
+        UTTE_UTF8_MODE_NONE = 0,
+        // The template is loaded as it is, and the load returns UTTE_INITIALISATION_RESULT_INVALID_UTF8
+        UTTE_UTF8_MODE_VALIDATE = 1,
+        // Invalid bytes are replaced with U+FFFD, and the load returns UTTE_INITIALISATION_RESULT_INVALID_UTF8
+        UTTE_UTF8_MODE_REPAIR = 2,
+    } UTTE_UTF8Mode;
+
     /**
     * @brief Result after initialising the parser with a string or file
     * @enum UTTE_PARSE_STATUS_SUCCESS - We parsed the file without any errors
@@ -62,6 +84,14 @@ extern "C"
     * @enum UTTE_PARSE_STATUS_EXPECTED_TERMINATION - Parsing a function stated, but it was not terminated by a normal
     * function call termination character, instead an EOF or '\0' character was encountered that stopped iteration of
     * the input string/file
+    * @enum UTTE_PARSE_STATUS_OUT_OF_MEMORY - A function needed more scratch memory than the limit set with
+    * "setScratchLimit" allows
+    * @enum UTTE_PARSE_STATUS_DEPTH_EXCEEDED - Expressions or bodies of functions were nested deeper than the limit set
+    * with "setMaxDepth" allows
+    * @enum UTTE_PARSE_STATUS_BUDGET_EXCEEDED - The render took longer, evaluated more expressions, iterated more often
+    * or rendered more text than the budget set with "setBudget" allows
+    * @enum UTTE_PARSE_STATUS_CONNECTION_FAILED - A request couldn't be sent to utte-serve, or its response couldn't be
+    * read, see UTTE::Client
     */
     typedef enum UTTE_ParseResultStatus
     {
@@ -70,7 +100,38 @@ extern "C"
         UTTE_PARSE_STATUS_EXPECTED_TERMINATION = 2,
         UTTE_PARSE_STATUS_INVALID_VALUE = 3,
         UTTE_PARSE_STATUS_INVALID_TYPE = 4,
+        UTTE_PARSE_STATUS_OUT_OF_MEMORY = 5,
+        UTTE_PARSE_STATUS_DEPTH_EXCEEDED = 6,
+        UTTE_PARSE_STATUS_BUDGET_EXCEEDED = 7,
+        UTTE_PARSE_STATUS_CONNECTION_FAILED = 8,
     } UTTE_ParseResultStatus;
+
+    // Limits on the work done by a single render, see "setBudget". 0 means no limit
+    typedef struct UTTE_RenderBudget
+    {
+        // Wall-clock time since the render started
+        uint64_t milliseconds;
+
+        // Calls of functions and reads of variables, including the ones in bodies of functions
+        size_t expressions;
+
+        // Iterations of "for" loops, counted across all loops of the render
+        size_t iterations;
+
+        // The size of the output, and of any body that is rendered into an argument
+        size_t outputBytes;
+    } UTTE_RenderBudget;
+
+    // Statistics of the cache of pure function results, see "setMemoCapacity"
+    typedef struct UTTE_MemoStats
+    {
+        size_t hits;
+        size_t misses;
+        size_t evictions;
+
+        // The number of results currently cached
+        size_t size;
+    } UTTE_MemoStats;
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
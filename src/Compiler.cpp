@@ -0,0 +1,216 @@
+#include "Compiler.hpp"
+#include "Generator.hpp"
+
+UTTE::ParseResultStatus UTTE::Compiler::compile(utte_string_view source, UTTE::Program& program, size_t maxDepth) noexcept
+{
+    program = {};
+    std::vector<PendingBody> bodies;
+
+    auto status = compileTemplate(utte_string(source.data(), source.size()), maxDepth, program, bodies);
+    if (status != UTTE_PARSE_STATUS_SUCCESS)
+        return status;
+
+    // Bodies are compiled after the template, so that their code is never in the way of the code that uses them. The
+    // bodies can contain more bodies, which are added to the end of the list
+    for (size_t i = 0; i < bodies.size(); i++)
+    {
+        program.code[bodies[i].instruction].b = static_cast<uint32_t>(program.code.size());
+
+        auto body = program.literal(bodies[i].literal);
+        status = compileTemplate(utte_string(body.data(), body.size()), maxDepth, program, bodies);
+        if (status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+    }
+    return UTTE_PARSE_STATUS_SUCCESS;
+}
+
+UTTE::ParseResultStatus UTTE::Compiler::compileTemplate(utte_string data, size_t maxDepth, UTTE::Program& program, std::vector<PendingBody>& bodies) noexcept
+{
+    size_t pos = 0;
+    for (size_t begin = data.find("{{"); begin != utte_string::npos; begin = data.find("{{", pos))
+    {
+        if (begin != pos)
+            emit(program, UTTE_OP_TEXT, pushLiteral(program, utte_string_view(data.data() + pos, begin - pos)));
+
+        size_t i = begin + 2;
+        if (i == data.size())
+            return UTTE_PARSE_STATUS_EXPECTED_TERMINATION;
+
+        auto status = compileExpression(data, i, maxDepth, program, bodies);
+        if (status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+
+        // Remove the expression, like parsing replaces it with its result. "i" is at the last bracket of the expression
+        data.erase(begin, i - begin + 1);
+        pos = begin;
+    }
+
+    if (pos < data.size())
+        emit(program, UTTE_OP_TEXT, pushLiteral(program, utte_string_view(data.data() + pos, data.size() - pos)));
+    emit(program, UTTE_OP_RETURN);
+    return UTTE_PARSE_STATUS_SUCCESS;
+}
+
+UTTE::ParseResultStatus UTTE::Compiler::compileExpression(utte_string& data, size_t& i, size_t maxDepth, UTTE::Program& program, std::vector<PendingBody>& bodies) noexcept
+{
+    // This follows Generator::parseFunction step by step, including removing nested expressions from the data, so that
+    // arguments are cut at exactly the same places. Instead of calling functions, it emits the code that calls them.
+    // Nested expressions get a new frame on the heap, like when parsing
+    std::vector<Expression> expressions;
+    expressions.push_back({ .beginCut = i, .bEmit = true });
+    emit(program, UTTE_OP_FRAME);
+
+    // Whether the expression that was finished last is a comment
+    bool bComment = false;
+
+    const auto pushArgument = [&](Expression& expression, size_t begin, size_t size) -> void
+    {
+        auto literal = pushLiteral(program, utte_string_view(data.data() + begin, size));
+        emit(program, UTTE_OP_PUSH, literal);
+
+        if (expression.args.empty())
+            expression.name = literal;
+        expression.args.push_back(true);
+    };
+
+    const auto call = [&](Expression& expression) -> void
+    {
+        uint32_t flags = expression.bEmit ? static_cast<uint32_t>(UTTE_CALL_FLAG_EMIT) : 0u;
+        if (expression.args.empty() || !expression.args[0])
+            emit(program, UTTE_OP_CALL_DYNAMIC, 0, flags);
+        else
+            emit(program, UTTE_OP_CALL, pushSymbol(program, expression.name), flags);
+        bComment = !expression.args.empty() && expression.args[0] && program.literal(expression.name) == "comment";
+    };
+
+    for (;;)
+    {
+        auto& expression = expressions.back();
+        bool bNested = false;
+        for (; i < data.size(); i++)
+        {
+            auto& it = data[i];
+            auto& pit = data[i - 1];
+
+            // Start function
+            if (it == '{' && pit == '{')
+            {
+                expression.locationBeforeAppend = i - 1;
+
+                ++i;
+                if (i == data.size())
+                    return UTTE_PARSE_STATUS_EXPECTED_TERMINATION;
+                if (maxDepth != 0 && expressions.size() >= maxDepth)
+                    return UTTE_PARSE_STATUS_DEPTH_EXCEEDED;
+
+                bNested = true;
+                break;
+            } // End function
+            else if (it == '}' && pit == '}')
+            {
+                if (!Generator::isSpace(data[i - 2]))
+                    pushArgument(expression, expression.beginCut, i - 1 - expression.beginCut);
+
+                call(expression);
+                goto exit_expression;
+            }
+            if (!((i + 1) < data.size() && it == '}' && data[i + 1] == '}')
+                && (Generator::isSpace(it) || ((i + 1) < data.size() && it == '{' && data[i + 1] == '{') || (i + 1) == data.size()))
+            {
+                if (expression.bWasSpace)
+                    ++expression.beginCut;
+                else
+                {
+                    pushArgument(expression, expression.beginCut, i - expression.beginCut);
+
+                    Symbol symbol = expression.args.size() == 1 ? SymbolTable::find(program.literal(expression.name)) : UTTE_SYMBOL_INVALID;
+                    if (symbol == UTTE_SYMBOL_FUNC || symbol == UTTE_SYMBOL_RAW || symbol == UTTE_SYMBOL_COMMENT)
+                    {
+                        i = (i + 1) == data.size() ? i : i + 1;
+                        size_t depth = 0;
+                        size_t initialPos = i;
+                        for (; i < data.size(); i++)
+                        {
+                            if (data[i] == '{' && data[i - 1] == '{')
+                                ++depth;
+                            else if (data[i] == '}' && data[i - 1] == '}')
+                            {
+                                if (depth == 0)
+                                    break;
+                                --depth;
+                                ++i;
+                            }
+                        }
+                        if (i >= data.size())
+                            return UTTE_PARSE_STATUS_EXPECTED_TERMINATION;
+
+                        auto body = pushLiteral(program, utte_string_view(data.data() + initialPos, i - initialPos - 1));
+                        if (symbol == UTTE_SYMBOL_FUNC)
+                        {
+                            bodies.push_back({ .instruction = program.code.size(), .literal = body });
+                            emit(program, UTTE_OP_PUSH_BODY, body);
+                        }
+                        else
+                            emit(program, UTTE_OP_PUSH, body);
+                        expression.args.push_back(true);
+
+                        call(expression);
+                        goto exit_expression;
+                    }
+                }
+                expression.bWasSpace = true;
+                expression.beginCut = (i + 1) < data.size() ? i + 1 : i;
+            }
+            else
+                expression.bWasSpace = false;
+        }
+
+        if (!bNested)
+            return UTTE_PARSE_STATUS_EXPECTED_TERMINATION;
+        expressions.push_back({ .beginCut = i });
+        emit(program, UTTE_OP_FRAME);
+        continue;
+
+exit_expression:
+        expressions.pop_back();
+        if (expressions.empty())
+            return UTTE_PARSE_STATUS_SUCCESS;
+
+        auto& parent = expressions.back();
+        data.erase(parent.locationBeforeAppend, i - parent.locationBeforeAppend + 1);
+        i = parent.locationBeforeAppend;
+
+        // Comments don't produce an argument. This is also checked when running, since a comment could be called
+        // through a variable or by a function that is not named "comment"
+        if (!bComment)
+            parent.args.push_back(false);
+
+        parent.bWasSpace = i >= data.size() || Generator::isSpace(data[i]);
+        parent.beginCut = parent.bWasSpace ? i + 1 : i;
+        ++i;
+    }
+}
+
+uint32_t UTTE::Compiler::pushLiteral(UTTE::Program& program, utte_string_view str) noexcept
+{
+    program.literals.push_back({ .offset = static_cast<uint32_t>(program.strings.size()), .size = static_cast<uint32_t>(str.size()) });
+    program.strings.append(str.data(), str.size());
+    return static_cast<uint32_t>(program.literals.size() - 1);
+}
+
+uint32_t UTTE::Compiler::pushSymbol(UTTE::Program& program, uint32_t name) noexcept
+{
+    Symbol symbol = SymbolTable::intern(program.literal(name));
+    for (size_t i = 0; i < program.symbols.size(); i++)
+        if (program.symbols[i] == symbol)
+            return static_cast<uint32_t>(i);
+
+    program.symbols.push_back(symbol);
+    program.names.push_back(name);
+    return static_cast<uint32_t>(program.symbols.size() - 1);
+}
+
+void UTTE::Compiler::emit(UTTE::Program& program, UTTE::OpCode op, uint32_t a, uint32_t b) noexcept
+{
+    program.code.push_back({ .op = op, .a = a, .b = b });
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+#include "Generator.hpp"
+
+namespace UTTE
+{
+    /**
+     * @brief Compiles templates to bytecode for the VM. The compiler cuts arguments exactly like
+     * Generator::parseFunction does, so a compiled template renders the same result as parsing it
+     */
+    class MLS_PUBLIC_API Compiler
+    {
+    public:
+        /**
+         * @brief Compiles a template
+         * @param source - The template
+         * @param program - The program to compile to. Any previous contents are discarded
+         * @param maxDepth - How deep expressions may be nested, 0 means no limit
+         * @return UTTE_PARSE_STATUS_SUCCESS, UTTE_PARSE_STATUS_EXPECTED_TERMINATION if an expression is not terminated,
+         * or UTTE_PARSE_STATUS_DEPTH_EXCEEDED if expressions are nested deeper than the limit
+         */
+        static ParseResultStatus compile(utte_string_view source, Program& program, size_t maxDepth = 0) noexcept;
+    private:
+        // The PUSH_BODY instruction of a "func" body whose code has not been compiled yet
+        struct PendingBody
+        {
+            size_t instruction;
+            uint32_t literal;
+        };
+
+        // An expression that is being compiled, see compileExpression
+        struct Expression
+        {
+            size_t beginCut = 0;
+            // The position of the nested expression that is being compiled
+            size_t locationBeforeAppend = 0;
+            bool bWasSpace = true;
+            bool bEmit = false;
+
+            // Whether each argument is a literal, and the literal of the first argument, which is the name of the function
+            std::vector<bool> args;
+            uint32_t name = 0;
+        };
+
+        static ParseResultStatus compileTemplate(utte_string data, size_t maxDepth, Program& program, std::vector<PendingBody>& bodies) noexcept;
+        static ParseResultStatus compileExpression(utte_string& data, size_t& i, size_t maxDepth, Program& program, std::vector<PendingBody>& bodies) noexcept;
+
+        static uint32_t pushLiteral(Program& program, utte_string_view str) noexcept;
+
+        // Returns the index of the name's symbol in the symbol table of the program, adding it if needed
+        static uint32_t pushSymbol(Program& program, uint32_t name) noexcept;
+        static void emit(Program& program, OpCode op, uint32_t a = 0, uint32_t b = 0) noexcept;
+    };
+}
\ No newline at end of file
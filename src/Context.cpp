@@ -0,0 +1,342 @@
+#include "Context.hpp"
+#include "VM.hpp"
+
+UTTE::Context::Context(UTTE::Generator& generator) noexcept
+{
+    scope = &generator;
+    root = &generator.root();
+    depth = root->depth;
+    generator.startBudget();
+}
+
+UTTE::Context::~Context() noexcept
+{
+    root->depth = depth;
+}
+
+void UTTE::Context::frame() noexcept
+{
+    ++root->depth;
+    arguments.push_back(stack.size());
+}
+
+void UTTE::Context::push(utte_string_view literal) noexcept
+{
+    stack.push_back({ .literal = literal, .bLiteral = true });
+}
+
+void UTTE::Context::push(utte_string_view literal, UTTE::RenderFunc* body) noexcept
+{
+    stack.push_back({ .literal = literal, .body = body, .bLiteral = true });
+}
+
+UTTE::ParseResultStatus UTTE::Context::call(UTTE::Symbol symbol, bool bEmit, utte_string& sink) noexcept
+{
+    // Like when parsing, an expression counts against the max depth until its function returns, including the body it
+    // runs. The innermost expression is called first, so the limit is checked there
+    struct Ascend
+    {
+        ~Ascend() noexcept
+        {
+            --root->depth;
+        }
+
+        Generator* root;
+    } ascend{ root };
+    if (root->maxDepth != 0 && root->depth > root->maxDepth)
+        return UTTE_PARSE_STATUS_DEPTH_EXCEEDED;
+
+    size_t base = arguments.back();
+    arguments.pop_back();
+
+    Function* f = nullptr;
+    if (symbol != UTTE_SYMBOL_INVALID)
+        f = scope->findFunction(symbol);
+    else if (stack.size() > base)
+        f = scope->findFunction(stack[base].view());
+    if (f == nullptr)
+    {
+        stack.resize(base);
+        finish(Variable{}, bEmit, sink);
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+    if (!root->charge(1, 0, sink.size()))
+        return UTTE_PARSE_STATUS_BUDGET_EXCEEDED;
+
+    // Same as in the VM, variables are read in place
+    if (f->bVariable)
+    {
+        stack.resize(base);
+        if (f->variable.status != UTTE_PARSE_STATUS_SUCCESS)
+            return f->variable.status;
+        if (f->variable._internalBoolComment)
+            return UTTE_PARSE_STATUS_SUCCESS;
+
+        if (bEmit)
+            sink.append(f->variable.value);
+        else
+            stack.push_back({ .variable = f->variable });
+        return UTTE_PARSE_STATUS_SUCCESS;
+    }
+
+    views.clear();
+    for (size_t i = base; i < stack.size(); i++)
+        views.push_back({ .value = stack[i].view(), .type = stack[i].variable.type });
+
+    // Same as in the VM, control flow builtins run compiled bodies, anything else is a regular call
+    if (Generator::isBuiltin(*f))
+    {
+        switch (f->symbol)
+        {
+        case UTTE_SYMBOL_FUNC:
+            if (views.size() == 2 && stack[base + 1].body != nullptr)
+            {
+                Value value = std::move(stack[base + 1]);
+                value.variable.type = UTTE_VARIABLE_TYPE_HINT_FUNCTION;
+                stack.resize(base);
+
+                if (bEmit)
+                    sink.append(value.literal.data(), value.literal.size());
+                else
+                    stack.push_back(std::move(value));
+                return UTTE_PARSE_STATUS_SUCCESS;
+            }
+            break;
+        case UTTE_SYMBOL_IF:
+        case UTTE_SYMBOL_SWITCH:
+        case UTTE_SYMBOL_COND:
+        {
+            size_t index = 0;
+            auto status = f->symbol == UTTE_SYMBOL_IF ? CoreFuncs::selectIf(views, index)
+                        : f->symbol == UTTE_SYMBOL_SWITCH ? CoreFuncs::selectSwitch(views, index)
+                        : CoreFuncs::selectCond(views, index);
+            if (status != UTTE_PARSE_STATUS_SUCCESS)
+                return status;
+
+            if (index == views.size())
+            {
+                stack.resize(base);
+                finish(Variable{}, bEmit, sink);
+                return UTTE_PARSE_STATUS_SUCCESS;
+            }
+
+            auto* body = stack[base + index].body;
+            if (body != nullptr)
+            {
+                stack.resize(base);
+                return runBody(body, bEmit, sink);
+            }
+            break;
+        }
+        case UTTE_SYMBOL_FOR:
+        {
+            // Same checks as CoreFuncs::funcFor, in the same order
+            if (views.size() < 4 || views.size() > 5)
+                return UTTE_PARSE_STATUS_OUT_OF_BOUNDS;
+
+            auto& body = stack[base + views.size() - 1];
+            if (body.variable.type != UTTE_VARIABLE_TYPE_HINT_FUNCTION)
+                return UTTE_PARSE_STATUS_INVALID_TYPE;
+            if (body.body != nullptr)
+                return runLoop(body.body, base, bEmit, sink);
+            break;
+        }
+        case UTTE_SYMBOL_INCLUDE:
+        {
+            if (views.size() != 2)
+                return UTTE_PARSE_STATUS_OUT_OF_BOUNDS;
+
+            auto partial = PartialCache::get(utte_string(views[1].value.data(), views[1].value.size()));
+            stack.resize(base);
+            if (partial == nullptr)
+                return UTTE_PARSE_STATUS_INVALID_VALUE;
+            if (partial->status != UTTE_PARSE_STATUS_SUCCESS)
+                return partial->status;
+
+            // Partials are loaded at runtime, so they run on the VM
+            if (bEmit)
+                return VM::run(*scope, partial->view, sink);
+
+            utte_string capture;
+            auto status = VM::run(*scope, partial->view, capture);
+            if (status == UTTE_PARSE_STATUS_SUCCESS)
+                stack.push_back({ .variable = { .value = std::move(capture), .type = UTTE_VARIABLE_TYPE_HINT_NORMAL } });
+            return status;
+        }
+        default:
+            break;
+        }
+    }
+
+    auto result = f->call(views, scope);
+    stack.resize(base);
+    if (result.status != UTTE_PARSE_STATUS_SUCCESS)
+        return result.status;
+
+    finish(std::move(result), bEmit, sink);
+    return UTTE_PARSE_STATUS_SUCCESS;
+}
+
+UTTE::ParseResultStatus UTTE::Context::end(const utte_string& sink) noexcept
+{
+    return root->charge(0, 0, sink.size()) ? UTTE_PARSE_STATUS_SUCCESS : UTTE_PARSE_STATUS_BUDGET_EXCEEDED;
+}
+
+UTTE::ParseResultStatus UTTE::Context::runBody(UTTE::RenderFunc* body, bool bEmit, utte_string& sink) noexcept
+{
+    utte_string capture;
+    auto status = body(*this, bEmit ? sink : capture);
+    if (status == UTTE_PARSE_STATUS_SUCCESS && !bEmit)
+        stack.push_back({ .variable = { .value = std::move(capture), .type = UTTE_VARIABLE_TYPE_HINT_NORMAL } });
+    return status;
+}
+
+UTTE::ParseResultStatus UTTE::Context::runLoop(UTTE::RenderFunc* body, size_t base, bool bEmit, utte_string& sink) noexcept
+{
+    const std::vector<utte_string>* array = nullptr;
+    const utte_map<utte_string, utte_string>* map = nullptr;
+    Range range;
+    Sequence* sequence = nullptr;
+    const ObjectType* objectType = nullptr;
+    const void* object = nullptr;
+    bool bRange = views.size() == 4 && views[2].type == UTTE_VARIABLE_TYPE_HINT_RANGE;
+    if (bRange)
+    {
+        if (!CoreFuncs::getRange(views[2], range))
+            return UTTE_PARSE_STATUS_INVALID_VALUE;
+    }
+    else if (views.size() == 4 && views[2].type == UTTE_VARIABLE_TYPE_HINT_SEQUENCE)
+    {
+        sequence = CoreFuncs::getSequence(views[2]);
+        if (sequence == nullptr || !sequence->next)
+            return UTTE_PARSE_STATUS_INVALID_VALUE;
+    }
+    else if (views.size() == 4)
+    {
+        array = CoreFuncs::getArray(views[2]);
+        if (array == nullptr)
+            return UTTE_PARSE_STATUS_INVALID_VALUE;
+    }
+    else if (views[3].type == UTTE_VARIABLE_TYPE_HINT_OBJECT)
+    {
+        if (!CoreFuncs::getObject(views[3], objectType, object))
+            return UTTE_PARSE_STATUS_INVALID_VALUE;
+    }
+    else
+    {
+        map = CoreFuncs::getMap(views[3]);
+        if (map == nullptr)
+            return UTTE_PARSE_STATUS_INVALID_VALUE;
+    }
+
+    if (scopes.empty())
+        scopes.push_back(std::make_unique<Generator>(scope));
+    auto loopScope = std::move(scopes.back());
+    scopes.pop_back();
+
+    // Loops push at most 2 variables. Reserving keeps the references to them valid
+    loopScope->parent = scope;
+    loopScope->functions.clear();
+    loopScope->functions.reserve(2);
+
+    auto& key = loopScope->pushVariable({}, utte_string(views[1].value.data(), views[1].value.size()));
+    Function* val = views.size() == 5 ? &loopScope->pushVariable({}, utte_string(views[2].value.data(), views[2].value.size())) : nullptr;
+    stack.resize(base);
+
+    utte_string capture;
+    utte_string& target = bEmit ? sink : capture;
+    Generator* outer = scope;
+    scope = loopScope.get();
+
+    // Every iteration counts against the budget of the render
+    const auto iterate = [&]() -> ParseResultStatus
+    {
+        return root->charge(0, 1, target.size()) ? body(*this, target) : UTTE_PARSE_STATUS_BUDGET_EXCEEDED;
+    };
+
+    auto status = UTTE_PARSE_STATUS_SUCCESS;
+    if (bRange)
+    {
+        char buffer[20];
+        for (size_t i = 0; i < range.size(); i++)
+        {
+            key.setValue(buffer, CoreFuncs::formatInteger(range.at(i), buffer), UTTE_VARIABLE_TYPE_HINT_NORMAL);
+            status = iterate();
+            if (status != UTTE_PARSE_STATUS_SUCCESS)
+                break;
+        }
+    }
+    else if (sequence != nullptr)
+    {
+        if (sequence->begin)
+            sequence->begin();
+
+        VariableView element;
+        while (sequence->next(element))
+        {
+            key.setValue(element.value.data(), element.value.size(), element.type);
+            status = iterate();
+            if (status != UTTE_PARSE_STATUS_SUCCESS)
+                break;
+        }
+    }
+    else if (array != nullptr)
+    {
+        for (auto& a : *array)
+        {
+            // Capture a pointer, capturing the element would copy it
+            auto* element = &a;
+            UTTE_VARIABLE_SET_NEW_VAL(key, element, *element, UTTE_VARIABLE_TYPE_HINT_NORMAL);
+            status = iterate();
+            if (status != UTTE_PARSE_STATUS_SUCCESS)
+                break;
+        }
+    }
+    else if (objectType != nullptr)
+    {
+        utte_string buffer;
+        for (size_t i = 0; i < objectType->size(); i++)
+        {
+            auto value = objectType->get(object, i, buffer);
+            UTTE_VARIABLE_SET_NEW_VAL(key, objectType, objectType->name(i), UTTE_VARIABLE_TYPE_HINT_NORMAL);
+            val->setValue(value.value.data(), value.value.size(), value.type);
+            status = iterate();
+            if (status != UTTE_PARSE_STATUS_SUCCESS)
+                break;
+        }
+    }
+    else
+    {
+        for (auto& a : *map)
+        {
+            auto* element = &a;
+            UTTE_VARIABLE_SET_NEW_VAL(key, element, element->first, UTTE_VARIABLE_TYPE_HINT_NORMAL);
+            UTTE_VARIABLE_SET_NEW_VAL((*val), element, element->second, UTTE_VARIABLE_TYPE_HINT_NORMAL);
+            status = iterate();
+            if (status != UTTE_PARSE_STATUS_SUCCESS)
+                break;
+        }
+    }
+
+    scope = outer;
+    scopes.push_back(std::move(loopScope));
+
+    if (status == UTTE_PARSE_STATUS_SUCCESS && !bEmit)
+        stack.push_back({ .variable = { .value = std::move(capture), .type = UTTE_VARIABLE_TYPE_HINT_NORMAL } });
+    return status;
+}
+
+void UTTE::Context::finish(UTTE::Variable&& result, bool bEmit, utte_string& sink) noexcept
+{
+    if (result._internalBoolComment)
+        return;
+    if (bEmit)
+        sink.append(result.value);
+    else
+        stack.push_back({ .variable = std::move(result) });
+}
+
+utte_string_view UTTE::Context::Value::view() const noexcept
+{
+    return bLiteral ? literal : utte_string_view(variable.value.data(), variable.value.size());
+}
\ No newline at end of file
@@ -1,32 +1,23 @@
 #include "CoreFuncs.hpp"
 #include "Generator.hpp"
-#include <sstream>
+#include "PartialCache.hpp"
+#include "UTF8.hpp"
+#include "VM.hpp"
+#include <algorithm>
+#include <charconv>
 
 
-UTTE::Variable UTTE::CoreFuncs::funcIf(std::vector<Variable>& args, UTTE::Generator* generator) noexcept
+UTTE::Variable UTTE::CoreFuncs::funcIf(std::vector<VariableView>& args, UTTE::Generator* generator) noexcept
 {
-    // This is because this is a binary function + 1 for the boolean expression and 1 for the name of the function
-    if (args.size() != 4)
-        return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_BOUNDS);
-    if (args[2].type != UTTE_VARIABLE_TYPE_HINT_FUNCTION || args[3].type != UTTE_VARIABLE_TYPE_HINT_FUNCTION)
-        return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_TYPE);
-
-    UTTE::Generator gen{};
-    gen.functions = generator->functions;
+    size_t index;
+    auto status = selectIf(args, index);
+    if (status != UTTE_PARSE_STATUS_SUCCESS)
+        return UTTE_ERROR(status);
 
-    uint8_t index = 2;
-    if (!getBooleanV(args[1].value))
-        index = 3;
-
-    gen.loadFromString(args[index].value);
-    auto result = gen.parse();
-    if (result.status != UTTE_PARSE_STATUS_SUCCESS)
-        return UTTE_ERROR(result.status);
-
-    return { .value = *result.result, .type = result._internalBuffer.type };
+    return renderBody(args[index].value, generator);
 }
 
-UTTE::Variable UTTE::CoreFuncs::funcAt(std::vector<Variable>& args, UTTE::Generator*) noexcept
+UTTE::Variable UTTE::CoreFuncs::funcAt(std::vector<VariableView>& args, UTTE::Generator*) noexcept
 {
     if (args.size() != 3)
         return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_BOUNDS);
@@ -37,11 +28,8 @@ UTTE::Variable UTTE::CoreFuncs::funcAt(std::vector<Variable>& args, UTTE::Genera
         if (map == nullptr)
             return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
 
-        for (auto& a : *map)
-            if (args[2].value == a.first)
-                return { .value = a.second, .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
-
-        return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_BOUNDS);
+        auto value = find(*map, args[2].value);
+        return value == nullptr ? UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_BOUNDS) : Variable{ .value = *value, .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
     }
     else if (args[1].type == UTTE_VARIABLE_TYPE_HINT_ARRAY)
     {
@@ -49,70 +37,132 @@ UTTE::Variable UTTE::CoreFuncs::funcAt(std::vector<Variable>& args, UTTE::Genera
         if (array == nullptr)
             return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
 
-        size_t index;
-        std::istringstream(args[2].value) >> index;
+        size_t index = getIndex(args[2].value);
 
         return (array->size() <= index) ? UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE)
                                         : Variable{ .value = (*array)[index], .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
     }
-    else
+    else if (args[1].type == UTTE_VARIABLE_TYPE_HINT_OBJECT)
     {
-        size_t index;
-        std::istringstream(args[2].value) >> index;
+        const ObjectType* type;
+        const void* object;
+        if (!getObject(args[1], type, object))
+            return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
 
-        return (args[1].value.length() <= index) ? Variable{ .value = "", .type = UTTE_VARIABLE_TYPE_HINT_NORMAL }
-                                                 : Variable{ .value = (utte_string() + args[1].value[index]), .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
+        // Fields are only read when they're needed
+        utte_string buffer;
+        VariableView value;
+        if (!type->get(object, args[2].value, value, buffer))
+            return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_BOUNDS);
+        return value.toVariable();
     }
+    else if (args[1].type == UTTE_VARIABLE_TYPE_HINT_RANGE)
+    {
+        Range range;
+        if (!getRange(args[1], range))
+            return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+
+        size_t index = 0;
+        if (!getIndex(args[2].value, index) || range.size() <= index)
+            return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+
+        char buffer[20];
+        return { .value = utte_string(buffer, formatInteger(range.at(index), buffer)), .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
+    }
+    else if (args[1].type == UTTE_VARIABLE_TYPE_HINT_SEQUENCE)
+    {
+        // Sequences only go forward, so the elements before the index are produced and skipped
+        Sequence* sequence = getSequence(args[1]);
+        size_t index = 0;
+        if (sequence == nullptr || !sequence->next || !getIndex(args[2].value, index))
+            return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+
+        if (sequence->begin)
+            sequence->begin();
+
+        VariableView element;
+        for (size_t i = 0; sequence->next(element); i++)
+            if (i == index)
+                return element.toVariable();
+        return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+    }
+    else
+    {
+        // Strings are indexed by code points, so that multibyte characters aren't split
+        size_t index = getIndex(args[2].value);
+        auto character = UTF8::slice(args[1].value, index, index + 1);
+        return { .value = utte_string(character.data(), character.size()), .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
+    }
+}
+
+UTTE::Variable UTTE::CoreFuncs::funcSwitch(std::vector<VariableView>& args, UTTE::Generator* generator) noexcept
+{
+    size_t index;
+    auto status = selectSwitch(args, index);
+    if (status != UTTE_PARSE_STATUS_SUCCESS)
+        return UTTE_ERROR(status);
+
+    return index == args.size() ? Variable{ .value = "", .type = UTTE_VARIABLE_TYPE_HINT_NORMAL } : renderBody(args[index].value, generator);
+}
+
+UTTE::Variable UTTE::CoreFuncs::funcCond(std::vector<VariableView>& args, UTTE::Generator* generator) noexcept
+{
+    size_t index;
+    auto status = selectCond(args, index);
+    if (status != UTTE_PARSE_STATUS_SUCCESS)
+        return UTTE_ERROR(status);
+
+    return index == args.size() ? Variable{ .value = "", .type = UTTE_VARIABLE_TYPE_HINT_NORMAL } : renderBody(args[index].value, generator);
+}
+
+UTTE::ParseResultStatus UTTE::CoreFuncs::selectIf(const std::vector<VariableView>& args, size_t& index) noexcept
+{
+    // This is because this is a binary function + 1 for the boolean expression and 1 for the name of the function
+    if (args.size() != 4)
+        return UTTE_PARSE_STATUS_OUT_OF_BOUNDS;
+    if (args[2].type != UTTE_VARIABLE_TYPE_HINT_FUNCTION || args[3].type != UTTE_VARIABLE_TYPE_HINT_FUNCTION)
+        return UTTE_PARSE_STATUS_INVALID_TYPE;
+
+    index = getBooleanV(args[1].value) ? 2 : 3;
+    return UTTE_PARSE_STATUS_SUCCESS;
 }
 
-UTTE::Variable UTTE::CoreFuncs::funcSwitch(std::vector<Variable>& args, UTTE::Generator* generator) noexcept
+UTTE::ParseResultStatus UTTE::CoreFuncs::selectSwitch(const std::vector<VariableView>& args, size_t& index) noexcept
 {
     if (args.size() < 2)
-        return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_BOUNDS);
-    
-    Variable result;
-    
-    Generator gen{};
-    gen.functions = generator->functions;
-    
+        return UTTE_PARSE_STATUS_OUT_OF_BOUNDS;
+
     for (size_t i = 2; i < args.size(); i++)
     {
         if ((i + 1) < args.size() && args[i].type == UTTE_VARIABLE_TYPE_HINT_NORMAL && args[i + 1].type == UTTE_VARIABLE_TYPE_HINT_FUNCTION)
         {
             if (args[1] == args[i])
             {
-                gen.loadFromString(args[i + 1].value);
-                auto r = gen.parse();
-                if (r.status != UTTE_PARSE_STATUS_SUCCESS)
-                    return UTTE_ERROR(r.status);
-                return { .value = *r.result, .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
+                index = i + 1;
+                return UTTE_PARSE_STATUS_SUCCESS;
             }
             ++i;
         } // This will be called if the last function is also one that matches a value. The default fallback function which returns an empty value will be called
         else if ((i + 1) == args.size() && args[i].type == UTTE_VARIABLE_TYPE_HINT_NORMAL && args[i - 1].type == UTTE_VARIABLE_TYPE_HINT_FUNCTION)
-            return { .value = "", .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
+        {
+            index = args.size();
+            return UTTE_PARSE_STATUS_SUCCESS;
+        }
         else if ((i + 1) == args.size() && args[i].type == UTTE_VARIABLE_TYPE_HINT_FUNCTION)// Last argument is function
         {
-            gen.loadFromString(args[i].value);
-            auto r = gen.parse();
-            if (r.status != UTTE_PARSE_STATUS_SUCCESS)
-                return UTTE_ERROR(r.status);
-            return { .value = *r.result, .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
+            index = i;
+            return UTTE_PARSE_STATUS_SUCCESS;
         }
         else // Last element is not a function, therefore return an invalid type
-            return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_TYPE);
+            return UTTE_PARSE_STATUS_INVALID_TYPE;
     }
-    return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_BOUNDS);
+    return UTTE_PARSE_STATUS_OUT_OF_BOUNDS;
 }
 
-UTTE::Variable UTTE::CoreFuncs::funcCond(std::vector<Variable>& args, UTTE::Generator* generator) noexcept
+UTTE::ParseResultStatus UTTE::CoreFuncs::selectCond(const std::vector<VariableView>& args, size_t& index) noexcept
 {
     if (args.size() < 2)
-        return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_BOUNDS);
-
-    Variable result;
-    Generator gen{};
-    gen.functions = generator->functions;
+        return UTTE_PARSE_STATUS_OUT_OF_BOUNDS;
 
     for (size_t i = 1; i < args.size(); i++)
     {
@@ -120,39 +170,47 @@ UTTE::Variable UTTE::CoreFuncs::funcCond(std::vector<Variable>& args, UTTE::Gene
         {
             if (getBooleanV(args[i].value))
             {
-                gen.loadFromString(args[i + 1].value);
-                auto r = gen.parse();
-                if (r.status != UTTE_PARSE_STATUS_SUCCESS)
-                    return UTTE_ERROR(r.status);
-                return { .value = *r.result, .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
+                index = i + 1;
+                return UTTE_PARSE_STATUS_SUCCESS;
             }
             ++i;
         } // This will be called if the last function is also one that matches a value. The default fallback function which returns an empty value will be called
         else if ((i + 1) == args.size() && args[i].type == UTTE_VARIABLE_TYPE_HINT_NORMAL && args[i - 1].type == UTTE_VARIABLE_TYPE_HINT_FUNCTION)
-            return { .value = "", .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
+        {
+            index = args.size();
+            return UTTE_PARSE_STATUS_SUCCESS;
+        }
         else if ((i + 1) == args.size() && args[i].type == UTTE_VARIABLE_TYPE_HINT_FUNCTION)// Last argument is function
         {
-            gen.loadFromString(args[i].value);
-            auto r = gen.parse();
-            if (r.status != UTTE_PARSE_STATUS_SUCCESS)
-                return UTTE_ERROR(r.status);
-            return { .value = *r.result, .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
+            index = i;
+            return UTTE_PARSE_STATUS_SUCCESS;
         }
         else // Last element is not a function, therefore return an invalid type
-            return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_TYPE);
+            return UTTE_PARSE_STATUS_INVALID_TYPE;
     }
-    return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_BOUNDS);
+    return UTTE_PARSE_STATUS_OUT_OF_BOUNDS;
 }
 
-UTTE::Variable UTTE::CoreFuncs::funcFor(std::vector<Variable>& args, UTTE::Generator* generator) noexcept
+UTTE::Variable UTTE::CoreFuncs::renderBody(utte_string_view body, UTTE::Generator* generator) noexcept
+{
+    Generator gen(generator);
+
+    gen.loadFromString(body);
+    auto result = gen.parse();
+    if (result.status != UTTE_PARSE_STATUS_SUCCESS)
+        return UTTE_ERROR(result.status);
+
+    return { .value = *result.result, .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
+}
+
+UTTE::Variable UTTE::CoreFuncs::funcFor(std::vector<VariableView>& args, UTTE::Generator* generator) noexcept
 {
     if (args.size() < 4 || args.size() > 5)
         return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_BOUNDS);
 
     Variable result;
     // This will interpret the body of the for loop
-    Generator gen{};
-    gen.functions = generator->functions;
+    Generator gen(generator);
 
     // 4 is the magic number corresponding to the number of arguments needed for a "for" loop of an array
     if (args.size() == 4)
@@ -160,14 +218,69 @@ UTTE::Variable UTTE::CoreFuncs::funcFor(std::vector<Variable>& args, UTTE::Gener
         if (args[3].type != UTTE_VARIABLE_TYPE_HINT_FUNCTION)
             return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_TYPE);
 
+        // Ranges generate their elements on the fly
+        Range range;
+        if (args[2].type == UTTE_VARIABLE_TYPE_HINT_RANGE)
+        {
+            if (!getRange(args[2], range))
+                return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+
+            char buffer[20];
+            auto& key = gen.pushVariable({ .value = "", .type = UTTE_VARIABLE_TYPE_HINT_NORMAL }, utte_string(args[1].value.data(), args[1].value.size()));
+            for (size_t i = 0; i < range.size(); i++)
+            {
+                key.setValue(buffer, formatInteger(range.at(i), buffer), UTTE_VARIABLE_TYPE_HINT_NORMAL);
+
+                // Every iteration counts against the budget of the render, along with the text rendered so far
+                if (!gen.charge(0, 1, result.value.size()))
+                    return UTTE_ERROR(UTTE_PARSE_STATUS_BUDGET_EXCEEDED);
+                gen.loadFromString(args[3].value);
+
+                auto r = gen.parse();
+                if (r.status != UTTE_PARSE_STATUS_SUCCESS)
+                    return UTTE_ERROR(r.status);
+                result.value += *r.result;
+            }
+            return result;
+        }
+
+        // Sequences produce their elements while they're iterated
+        if (args[2].type == UTTE_VARIABLE_TYPE_HINT_SEQUENCE)
+        {
+            Sequence* sequence = getSequence(args[2]);
+            if (sequence == nullptr || !sequence->next)
+                return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+
+            auto& key = gen.pushVariable({ .value = "", .type = UTTE_VARIABLE_TYPE_HINT_NORMAL }, utte_string(args[1].value.data(), args[1].value.size()));
+            if (sequence->begin)
+                sequence->begin();
+
+            VariableView element;
+            while (sequence->next(element))
+            {
+                key.setValue(element.value.data(), element.value.size(), element.type);
+                if (!gen.charge(0, 1, result.value.size()))
+                    return UTTE_ERROR(UTTE_PARSE_STATUS_BUDGET_EXCEEDED);
+                gen.loadFromString(args[3].value);
+
+                auto r = gen.parse();
+                if (r.status != UTTE_PARSE_STATUS_SUCCESS)
+                    return UTTE_ERROR(r.status);
+                result.value += *r.result;
+            }
+            return result;
+        }
+
         std::vector<utte_string>* array = getArray(args[2]);
         if (array == nullptr)
             return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
 
-        auto& key = gen.pushVariable({ .value = "", .type = UTTE_VARIABLE_TYPE_HINT_NORMAL }, args[1].value);
+        auto& key = gen.pushVariable({ .value = "", .type = UTTE_VARIABLE_TYPE_HINT_NORMAL }, utte_string(args[1].value.data(), args[1].value.size()));
         for (auto& a : *array)
         {
             UTTE_VARIABLE_SET_NEW_VAL(key, a, a, UTTE_VARIABLE_TYPE_HINT_NORMAL);
+            if (!gen.charge(0, 1, result.value.size()))
+                return UTTE_ERROR(UTTE_PARSE_STATUS_BUDGET_EXCEEDED);
             gen.loadFromString(args[3].value);
 
             auto r = gen.parse();
@@ -182,18 +295,51 @@ UTTE::Variable UTTE::CoreFuncs::funcFor(std::vector<Variable>& args, UTTE::Gener
         if (args[4].type != UTTE_VARIABLE_TYPE_HINT_FUNCTION)
             return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_TYPE);
 
+        // Objects are iterated by their fields, in the order they were added to the type
+        if (args[3].type == UTTE_VARIABLE_TYPE_HINT_OBJECT)
+        {
+            const ObjectType* type;
+            const void* object;
+            if (!getObject(args[3], type, object))
+                return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+
+            gen.functions.reserve(2);
+            auto& key = gen.pushVariable({ .value = "", .type = UTTE_VARIABLE_TYPE_HINT_NORMAL }, utte_string(args[1].value.data(), args[1].value.size()));
+            auto& val = gen.pushVariable({ .value = "", .type = UTTE_VARIABLE_TYPE_HINT_NORMAL }, utte_string(args[2].value.data(), args[2].value.size()));
+            utte_string buffer;
+            for (size_t i = 0; i < type->size(); i++)
+            {
+                auto value = type->get(object, i, buffer);
+                UTTE_VARIABLE_SET_NEW_VAL(key, type, type->name(i), UTTE_VARIABLE_TYPE_HINT_NORMAL);
+                val.setValue(value.value.data(), value.value.size(), value.type);
+
+                if (!gen.charge(0, 1, result.value.size()))
+                    return UTTE_ERROR(UTTE_PARSE_STATUS_BUDGET_EXCEEDED);
+                gen.loadFromString(args[4].value);
+                auto r = gen.parse();
+                if (r.status != UTTE_PARSE_STATUS_SUCCESS)
+                    return UTTE_ERROR(r.status);
+                result.value += *r.result;
+            }
+            return result;
+        }
+
         utte_map<utte_string, utte_string>* map = getMap(args[3]);
         if (map == nullptr)
             return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
 
-        // Push these variables then use the reference to append new values in the loop.
-        auto& key = gen.pushVariable({ .value = "", .type = UTTE_VARIABLE_TYPE_HINT_NORMAL }, args[1].value);
-        auto& val = gen.pushVariable({ .value = "", .type = UTTE_VARIABLE_TYPE_HINT_NORMAL }, args[2].value);
+        // Push these variables then use the reference to append new values in the loop. Reserve first, so that
+        // pushing the second variable doesn't invalidate the reference to the first one
+        gen.functions.reserve(2);
+        auto& key = gen.pushVariable({ .value = "", .type = UTTE_VARIABLE_TYPE_HINT_NORMAL }, utte_string(args[1].value.data(), args[1].value.size()));
+        auto& val = gen.pushVariable({ .value = "", .type = UTTE_VARIABLE_TYPE_HINT_NORMAL }, utte_string(args[2].value.data(), args[2].value.size()));
         for (auto& a : *map)
         {
             UTTE_VARIABLE_SET_NEW_VAL(key, a, a.first, UTTE_VARIABLE_TYPE_HINT_NORMAL);
             UTTE_VARIABLE_SET_NEW_VAL(val, a, a.second, UTTE_VARIABLE_TYPE_HINT_NORMAL);
 
+            if (!gen.charge(0, 1, result.value.size()))
+                return UTTE_ERROR(UTTE_PARSE_STATUS_BUDGET_EXCEEDED);
             gen.loadFromString(args[4].value);
             auto r = gen.parse();
             if (r.status != UTTE_PARSE_STATUS_SUCCESS)
@@ -204,9 +350,9 @@ UTTE::Variable UTTE::CoreFuncs::funcFor(std::vector<Variable>& args, UTTE::Gener
     return result;
 }
 
-UTTE::Variable UTTE::CoreFuncs::funcBoolEqual(std::vector<Variable>& args, UTTE::Generator*) noexcept
+UTTE::Variable UTTE::CoreFuncs::funcBoolEqual(std::vector<VariableView>& args, UTTE::Generator*) noexcept
 {
-    Variable* variable = nullptr;
+    VariableView* variable = nullptr;
     bool result = true;
     for (size_t i = 2; i < args.size(); i++)
     {
@@ -221,9 +367,9 @@ UTTE::Variable UTTE::CoreFuncs::funcBoolEqual(std::vector<Variable>& args, UTTE:
     return { .value = std::to_string(result), .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
 }
 
-UTTE::Variable UTTE::CoreFuncs::funcBoolNotEqual(std::vector<Variable>& args, UTTE::Generator*) noexcept
+UTTE::Variable UTTE::CoreFuncs::funcBoolNotEqual(std::vector<VariableView>& args, UTTE::Generator*) noexcept
 {
-    Variable* variable = nullptr;
+    VariableView* variable = nullptr;
     bool result = true;
     for (size_t i = 2; i < args.size(); i++)
     {
@@ -236,7 +382,7 @@ UTTE::Variable UTTE::CoreFuncs::funcBoolNotEqual(std::vector<Variable>& args, UT
     return { .value = std::to_string(result), .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
 }
 
-UTTE::Variable UTTE::CoreFuncs::funcBoolNot(std::vector<Variable>& args, UTTE::Generator*) noexcept
+UTTE::Variable UTTE::CoreFuncs::funcBoolNot(std::vector<VariableView>& args, UTTE::Generator*) noexcept
 {
     if (args.size() < 2)
         return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_BOUNDS);
@@ -244,11 +390,11 @@ UTTE::Variable UTTE::CoreFuncs::funcBoolNot(std::vector<Variable>& args, UTTE::G
     return { .value = std::to_string(!getBooleanV(args[1].value)), .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
 }
 
-UTTE::Variable UTTE::CoreFuncs::funcBoolAnd(std::vector<Variable>& args, UTTE::Generator*) noexcept
+UTTE::Variable UTTE::CoreFuncs::funcBoolAnd(std::vector<VariableView>& args, UTTE::Generator*) noexcept
 {
     if (args.size() < 3)
         return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_BOUNDS);
-    Variable& comparator = args[1];
+    VariableView& comparator = args[1];
     bool result = true;
 
     for (size_t i = 2; i < args.size(); i++)
@@ -262,11 +408,11 @@ UTTE::Variable UTTE::CoreFuncs::funcBoolAnd(std::vector<Variable>& args, UTTE::G
     return { .value = std::to_string(result), .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
 }
 
-UTTE::Variable UTTE::CoreFuncs::funcBoolOr(std::vector<Variable>& args, UTTE::Generator*) noexcept
+UTTE::Variable UTTE::CoreFuncs::funcBoolOr(std::vector<VariableView>& args, UTTE::Generator*) noexcept
 {
     if (args.size() < 3)
         return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_BOUNDS);
-    Variable& comparator = args[1];
+    VariableView& comparator = args[1];
     if (getBooleanV(comparator.value))
         return { .value = std::to_string(true), .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
 
@@ -282,23 +428,23 @@ UTTE::Variable UTTE::CoreFuncs::funcBoolOr(std::vector<Variable>& args, UTTE::Ge
     return { .value = std::to_string(result), .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
 }
 
-UTTE::Variable UTTE::CoreFuncs::funcFunc(std::vector<Variable>& args, UTTE::Generator*) noexcept
+UTTE::Variable UTTE::CoreFuncs::funcFunc(std::vector<VariableView>& args, UTTE::Generator*) noexcept
 {
     if (args.size() > 1)
     {
         args[1].type = UTTE_VARIABLE_TYPE_HINT_FUNCTION;
-        return args[1];
+        return args[1].toVariable();
     }
     return Variable{ .value = "", .type = UTTE_VARIABLE_TYPE_HINT_FUNCTION };
 }
 
-UTTE::Variable UTTE::CoreFuncs::funcRaw(std::vector<Variable>& args, UTTE::Generator*) noexcept
+UTTE::Variable UTTE::CoreFuncs::funcRaw(std::vector<VariableView>& args, UTTE::Generator*) noexcept
 {
     // First argument will be the raw string. If no second value exists return empty
-    return args.size() > 1 ? args[1] : Variable{ .value = "", .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
+    return args.size() > 1 ? args[1].toVariable() : Variable{ .value = "", .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
 }
 
-UTTE::Variable UTTE::CoreFuncs::funcComment(std::vector<Variable>&, UTTE::Generator*) noexcept
+UTTE::Variable UTTE::CoreFuncs::funcComment(std::vector<VariableView>&, UTTE::Generator*) noexcept
 {
     return
     {
@@ -308,70 +454,657 @@ UTTE::Variable UTTE::CoreFuncs::funcComment(std::vector<Variable>&, UTTE::Genera
     };
 }
 
-UTTE::Variable UTTE::CoreFuncs::funcList(std::vector<Variable>& args, UTTE::Generator* generator) noexcept
+UTTE::Variable UTTE::CoreFuncs::funcList(std::vector<VariableView>& args, UTTE::Generator* generator) noexcept
 {
     if (args.size() == 1)
         return { .value = std::to_string((intptr_t)nullptr), .type = UTTE_VARIABLE_TYPE_HINT_ARRAY };
 
-    auto& arr = generator->requestArrayWithGC();
+    size_t bytes = 0;
+    for (size_t i = 1; i < args.size(); i++)
+        bytes += sizeof(utte_string) + args[i].value.size();
+    if (!generator->chargeScratch(bytes))
+        return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_MEMORY);
+
+    auto& arr = generator->requestScratchArray();
+    arr.reserve(args.size() - 1);
     for (size_t i = 1; i < args.size(); i++)
-        arr.push_back(args[i].value);
+        arr.emplace_back(args[i].value.data(), args[i].value.size());
 
     return UTTE::Generator::makeArray(arr);
 }
 
 bool UTTE::CoreFuncs::getBooleanV(const utte_string& str) noexcept
+{
+    return getBooleanV(utte_string_view(str.data(), str.size()));
+}
+
+bool UTTE::CoreFuncs::getBooleanV(utte_string_view str) noexcept
 {
     // Description: This function generates a boolean from a boolean value represented as a keyword or as a number.
-    // If a string has the value "true", "b1" will be set to "true" since that is valid C++ syntax for booleans.
-    // However, it's also valid to have the value to evaluate to true using an integer. We use the integer "b2" to
-    // represent integer values. If any of these returns "true" we return "true"
-    bool b1;
-    int b2;
+    // If a string has the value "true" it evaluates to "true" since that is valid C++ syntax for booleans. However,
+    // it's also valid to have the value evaluate to true using an integer, in which case any non-zero integer is true.
+    // Leading whitespace is skipped and trailing characters are ignored, like when reading from a stream
+    size_t i = 0;
+    while (i < str.size() && std::isspace(static_cast<unsigned char>(str[i])))
+        ++i;
+    str.remove_prefix(i);
 
-    std::istringstream(str) >> std::boolalpha >> b1;
-    std::istringstream(str) >> b2;
+    if (str.starts_with("true"))
+        return true;
 
-    return b1 || b2;
+    if (!str.empty() && (str[0] == '-' || str[0] == '+'))
+        str.remove_prefix(1);
+    for (auto& a : str)
+    {
+        if (a < '0' || a > '9')
+            break;
+        if (a != '0')
+            return true;
+    }
+    return false;
 }
 
 std::vector<utte_string>* UTTE::CoreFuncs::getArray(const UTTE::Variable& variable) noexcept
+{
+    return getArray(VariableView{ .value = utte_string_view(variable.value.data(), variable.value.size()), .type = variable.type });
+}
+
+std::vector<utte_string>* UTTE::CoreFuncs::getArray(const UTTE::VariableView& variable) noexcept
 {
     if (variable.type != UTTE_VARIABLE_TYPE_HINT_ARRAY)
         return nullptr;
 
     // Get memory address of array. Arrays and maps encode their pointers as strings
-    auto addr = (intptr_t)nullptr;
-    std::istringstream(variable.value) >> addr;
-
+    auto addr = getAddress(variable.value);
     return (addr == (intptr_t)nullptr) ? nullptr : (std::vector<utte_string>*)addr;
 }
 
+UTTE::Sequence* UTTE::CoreFuncs::getSequence(const UTTE::VariableView& variable) noexcept
+{
+    if (variable.type != UTTE_VARIABLE_TYPE_HINT_SEQUENCE)
+        return nullptr;
+
+    auto addr = getAddress(variable.value);
+    return (addr == (intptr_t)nullptr) ? nullptr : (Sequence*)addr;
+}
+
+bool UTTE::CoreFuncs::getObject(const UTTE::VariableView& variable, const UTTE::ObjectType*& type, const void*& object) noexcept
+{
+    if (variable.type != UTTE_VARIABLE_TYPE_HINT_OBJECT)
+        return false;
+
+    size_t separator = variable.value.find(':');
+    if (separator == utte_string_view::npos)
+        return false;
+
+    type = (const ObjectType*)getAddress(variable.value.substr(0, separator));
+    object = (const void*)getAddress(variable.value.substr(separator + 1));
+    return type != nullptr;
+}
+
+size_t UTTE::CoreFuncs::formatObject(const UTTE::ObjectType& type, const void* object, char* buffer) noexcept
+{
+    char* end = std::to_chars(buffer, buffer + 20, (intptr_t)&type).ptr;
+    *end++ = ':';
+    return static_cast<size_t>(std::to_chars(end, end + 20, (intptr_t)object).ptr - buffer);
+}
+
 utte_map<utte_string, utte_string>* UTTE::CoreFuncs::getMap(const UTTE::Variable& variable) noexcept
+{
+    return getMap(VariableView{ .value = utte_string_view(variable.value.data(), variable.value.size()), .type = variable.type });
+}
+
+utte_map<utte_string, utte_string>* UTTE::CoreFuncs::getMap(const UTTE::VariableView& variable) noexcept
 {
     if (variable.type != UTTE_VARIABLE_TYPE_HINT_MAP)
         return nullptr;
 
     // Get memory address of map. Arrays and maps encode their pointers as strings
-    auto addr = (intptr_t)nullptr;
-    std::istringstream(variable.value) >> addr;
-
+    auto addr = getAddress(variable.value);
     return (addr == (intptr_t)nullptr) ? nullptr : (utte_map<utte_string, utte_string>*)addr;
 }
 
-UTTE::Variable UTTE::CoreFuncs::funcDict(std::vector<Variable>& args, UTTE::Generator* generator) noexcept
+const utte_string* UTTE::CoreFuncs::find(const utte_map<utte_string, utte_string>& map, utte_string_view key) noexcept
+{
+    // Generic, so that the requires expression is checked against the map type instead of failing to compile
+    const auto lookup = [](const auto& m, utte_string_view k)
+    {
+        if constexpr (requires { m.find(k); })
+            return m.find(k);
+        else
+            return m.find(utte_string(k.data(), k.size()));
+    };
+    auto it = lookup(map, key);
+    return it == map.end() ? nullptr : &it->second;
+}
+
+size_t UTTE::CoreFuncs::getIndex(utte_string_view str) noexcept
+{
+    size_t i = 0;
+    while (i < str.size() && std::isspace(static_cast<unsigned char>(str[i])))
+        ++i;
+
+    // Like with streams, an index that can't be read is 0
+    size_t index = 0;
+    if (std::from_chars(str.data() + i, str.data() + str.size(), index).ec != std::errc())
+        return 0;
+    return index;
+}
+
+bool UTTE::CoreFuncs::getIndex(utte_string_view str, size_t& index) noexcept
+{
+    const char* end = str.data() + str.size();
+    auto res = std::from_chars(str.data(), end, index);
+    return res.ec == std::errc() && res.ptr == end;
+}
+
+bool UTTE::CoreFuncs::getRange(const UTTE::VariableView& variable, UTTE::Range& range) noexcept
+{
+    if (variable.type != UTTE_VARIABLE_TYPE_HINT_RANGE)
+        return false;
+
+    // Encoded as "start:stop:step" by Generator::makeRange
+    const char* it = variable.value.data();
+    const char* end = it + variable.value.size();
+    int64_t* fields[] = { &range.start, &range.stop, &range.step };
+    for (size_t i = 0; i < 3; i++)
+    {
+        auto res = std::from_chars(it, end, *fields[i]);
+        if (res.ec != std::errc() || (i < 2 && (res.ptr == end || *res.ptr != ':')) || (i == 2 && res.ptr != end))
+            return false;
+        it = res.ptr + 1;
+    }
+    return range.step != 0;
+}
+
+size_t UTTE::CoreFuncs::formatInteger(int64_t value, char* buffer) noexcept
+{
+    return static_cast<size_t>(std::to_chars(buffer, buffer + 20, value).ptr - buffer);
+}
+
+UTTE::Variable UTTE::CoreFuncs::funcRange(std::vector<VariableView>& args, UTTE::Generator*) noexcept
+{
+    // "range stop", "range start stop" or "range start stop step", counting from 0 and by 1 when not given
+    if (args.size() < 2 || args.size() > 4)
+        return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_BOUNDS);
+
+    int64_t values[3] = { 0, 0, 1 };
+    for (size_t i = 1; i < args.size(); i++)
+    {
+        auto str = args[i].value;
+        while (!str.empty() && std::isspace(static_cast<unsigned char>(str.front())))
+            str.remove_prefix(1);
+        if (!str.empty() && str.front() == '+')
+            str.remove_prefix(1);
+
+        auto& value = values[args.size() == 2 ? 1 : i - 1];
+        auto res = std::from_chars(str.data(), str.data() + str.size(), value);
+        if (args[i].type != UTTE_VARIABLE_TYPE_HINT_NORMAL || res.ec != std::errc() || res.ptr != str.data() + str.size())
+            return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+    }
+    if (values[2] == 0)
+        return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+
+    return Generator::makeRange(values[0], values[1], values[2]);
+}
+
+UTTE::Variable UTTE::CoreFuncs::funcLength(std::vector<VariableView>& args, UTTE::Generator*) noexcept
+{
+    if (args.size() != 2)
+        return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_BOUNDS);
+
+    size_t size = 0;
+    if (args[1].type == UTTE_VARIABLE_TYPE_HINT_NORMAL)
+        size = UTF8::length(args[1].value);
+    else if (args[1].type == UTTE_VARIABLE_TYPE_HINT_ARRAY)
+    {
+        auto* array = getArray(args[1]);
+        if (array == nullptr)
+            return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+        size = array->size();
+    }
+    else if (args[1].type == UTTE_VARIABLE_TYPE_HINT_MAP)
+    {
+        auto* map = getMap(args[1]);
+        if (map == nullptr)
+            return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+        size = map->size();
+    }
+    else if (args[1].type == UTTE_VARIABLE_TYPE_HINT_RANGE)
+    {
+        Range range;
+        if (!getRange(args[1], range))
+            return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+        size = range.size();
+    }
+    else if (args[1].type == UTTE_VARIABLE_TYPE_HINT_OBJECT)
+    {
+        const ObjectType* type;
+        const void* object;
+        if (!getObject(args[1], type, object))
+            return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+        size = type->size();
+    }
+    else // Sequences can only be measured by consuming them
+        return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_TYPE);
+
+    char buffer[20];
+    return { .value = utte_string(buffer, formatInteger(static_cast<int64_t>(size), buffer)), .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
+}
+
+UTTE::Variable UTTE::CoreFuncs::funcSlice(std::vector<VariableView>& args, UTTE::Generator* generator) noexcept
+{
+    // "slice collection begin" or "slice collection begin end", where "end" isn't included. Indices past the end are
+    // clamped
+    if (args.size() < 3 || args.size() > 4)
+        return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_BOUNDS);
+
+    size_t begin = 0;
+    size_t end = SIZE_MAX;
+    if (!getIndex(args[2].value, begin) || (args.size() == 4 && !getIndex(args[3].value, end)))
+        return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+    if (args[1].type == UTTE_VARIABLE_TYPE_HINT_NORMAL)
+    {
+        auto result = UTF8::slice(args[1].value, begin, end);
+        return { .value = utte_string(result.data(), result.size()), .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
+    }
+    else if (args[1].type == UTTE_VARIABLE_TYPE_HINT_ARRAY)
+    {
+        auto* array = getArray(args[1]);
+        if (array == nullptr)
+            return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+
+        end = std::min(end, array->size());
+        begin = std::min(begin, end);
+        return makeScratchArray(array->begin() + static_cast<ptrdiff_t>(begin), array->begin() + static_cast<ptrdiff_t>(end), generator);
+    }
+    else if (args[1].type == UTTE_VARIABLE_TYPE_HINT_RANGE)
+    {
+        // A slice of a range is another range, so it's never materialized
+        Range range;
+        if (!getRange(args[1], range))
+            return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+
+        end = std::min(end, range.size());
+        begin = std::min(begin, end);
+        if (begin == end)
+            return Generator::makeRange(0, 0);
+        return Generator::makeRange(range.at(begin), end == range.size() ? range.stop : range.at(end), range.step);
+    }
+    return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_TYPE);
+}
+
+UTTE::Variable UTTE::CoreFuncs::funcJoin(std::vector<VariableView>& args, UTTE::Generator*) noexcept
+{
+    // "join collection" or "join collection separator"
+    if (args.size() < 2 || args.size() > 3)
+        return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_BOUNDS);
+
+    utte_string_view separator = args.size() == 3 ? args[2].value : utte_string_view();
+    Variable result{ .value = "", .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
+    if (args[1].type == UTTE_VARIABLE_TYPE_HINT_ARRAY)
+    {
+        auto* array = getArray(args[1]);
+        if (array == nullptr)
+            return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+        if (array->empty())
+            return result;
+
+        // Sized up front, so that the elements are copied once
+        size_t size = separator.size() * (array->size() - 1);
+        for (auto& a : *array)
+            size += a.size();
+        result.value.reserve(size);
+        for (size_t i = 0; i < array->size(); i++)
+        {
+            if (i != 0)
+                result.value.append(separator.data(), separator.size());
+            result.value += (*array)[i];
+        }
+        return result;
+    }
+    else if (args[1].type == UTTE_VARIABLE_TYPE_HINT_RANGE)
+    {
+        Range range;
+        if (!getRange(args[1], range))
+            return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+
+        char buffer[20];
+        for (size_t i = 0; i < range.size(); i++)
+        {
+            if (i != 0)
+                result.value.append(separator.data(), separator.size());
+            result.value.append(buffer, formatInteger(range.at(i), buffer));
+        }
+        return result;
+    }
+    return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_TYPE);
+}
+
+UTTE::Variable UTTE::CoreFuncs::funcSort(std::vector<VariableView>& args, UTTE::Generator* generator) noexcept
+{
+    if (args.size() != 2)
+        return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_BOUNDS);
+    if (args[1].type != UTTE_VARIABLE_TYPE_HINT_ARRAY)
+        return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_TYPE);
+
+    auto* array = getArray(args[1]);
+    if (array == nullptr)
+        return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+
+    // Sorted by bytes, which for UTF-8 is the same as sorting by code points
+    auto result = makeScratchArray(array->begin(), array->end(), generator);
+    if (result.status == UTTE_PARSE_STATUS_SUCCESS)
+        std::sort(getArray(result)->begin(), getArray(result)->end());
+    return result;
+}
+
+UTTE::Variable UTTE::CoreFuncs::funcReverse(std::vector<VariableView>& args, UTTE::Generator* generator) noexcept
+{
+    if (args.size() != 2)
+        return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_BOUNDS);
+
+    if (args[1].type == UTTE_VARIABLE_TYPE_HINT_ARRAY)
+    {
+        auto* array = getArray(args[1]);
+        if (array == nullptr)
+            return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+        return makeScratchArray(array->rbegin(), array->rend(), generator);
+    }
+    else if (args[1].type == UTTE_VARIABLE_TYPE_HINT_RANGE)
+    {
+        // The reverse of a range is another range, counting back from its last integer and stopping one step before
+        // its first one. Ranges that would have to stop past the limits of int64_t can't be reversed
+        Range range;
+        if (!getRange(args[1], range))
+            return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+
+        size_t size = range.size();
+        if (size <= 1)
+            return args[1].toVariable();
+        if (range.step == INT64_MIN || (range.step > 0 && range.start < INT64_MIN + range.step)
+            || (range.step < 0 && range.start > INT64_MAX + range.step))
+            return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+        return Generator::makeRange(range.at(size - 1), range.start - range.step, -range.step);
+    }
+    return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_TYPE);
+}
+
+UTTE::Variable UTTE::CoreFuncs::funcKeys(std::vector<VariableView>& args, UTTE::Generator* generator) noexcept
+{
+    return getEntries(args, generator, true);
+}
+
+UTTE::Variable UTTE::CoreFuncs::funcValues(std::vector<VariableView>& args, UTTE::Generator* generator) noexcept
+{
+    return getEntries(args, generator, false);
+}
+
+UTTE::Variable UTTE::CoreFuncs::funcContains(std::vector<VariableView>& args, UTTE::Generator*) noexcept
+{
+    // Arrays contain their elements, maps and objects their keys, strings their substrings and ranges their integers
+    if (args.size() != 3)
+        return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_BOUNDS);
+
+    auto value = args[2].value;
+    bool result = false;
+    if (args[1].type == UTTE_VARIABLE_TYPE_HINT_NORMAL)
+        result = args[1].value.find(value) != utte_string_view::npos;
+    else if (args[1].type == UTTE_VARIABLE_TYPE_HINT_ARRAY)
+    {
+        auto* array = getArray(args[1]);
+        if (array == nullptr)
+            return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+        result = std::any_of(array->begin(), array->end(), [&](const utte_string& a) -> bool { return utte_string_view(a.data(), a.size()) == value; });
+    }
+    else if (args[1].type == UTTE_VARIABLE_TYPE_HINT_MAP)
+    {
+        auto* map = getMap(args[1]);
+        if (map == nullptr)
+            return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+        result = find(*map, value) != nullptr;
+    }
+    else if (args[1].type == UTTE_VARIABLE_TYPE_HINT_RANGE)
+    {
+        // Only integers written the way "for" writes them are in a range. The distance from the start is computed on
+        // unsigned integers, like Range::size
+        Range range;
+        if (!getRange(args[1], range))
+            return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+
+        int64_t integer;
+        auto res = std::from_chars(value.data(), value.data() + value.size(), integer);
+        if (res.ec == std::errc() && res.ptr == value.data() + value.size())
+        {
+            uint64_t offset = static_cast<uint64_t>(integer) - static_cast<uint64_t>(range.start);
+            uint64_t step = static_cast<uint64_t>(range.step);
+            if (range.step < 0)
+            {
+                offset = 0 - offset;
+                step = 0 - step;
+            }
+            result = offset % step == 0 && offset / step < range.size();
+        }
+    }
+    else if (args[1].type == UTTE_VARIABLE_TYPE_HINT_OBJECT)
+    {
+        const ObjectType* type;
+        const void* object;
+        if (!getObject(args[1], type, object))
+            return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+        for (size_t i = 0; i < type->size() && !result; i++)
+            result = utte_string_view(type->name(i).data(), type->name(i).size()) == value;
+    }
+    else
+        return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_TYPE);
+
+    return { .value = std::to_string(result), .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
+}
+
+UTTE::Variable UTTE::CoreFuncs::funcFilter(std::vector<VariableView>& args, UTTE::Generator* generator) noexcept
+{
+    // "filter collection predicate arguments...". The predicate is the name of a function, which is called with every
+    // element of an array, or every key and value of a map, followed by the arguments. Elements are kept if it returns
+    // a true value
+    if (args.size() < 3)
+        return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_BOUNDS);
+    if ((args[1].type != UTTE_VARIABLE_TYPE_HINT_ARRAY && args[1].type != UTTE_VARIABLE_TYPE_HINT_MAP) || args[2].type != UTTE_VARIABLE_TYPE_HINT_NORMAL)
+        return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_TYPE);
+
+    const Function* predicate = generator->findFunction(args[2].value);
+    if (predicate == nullptr)
+        return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+
+    // The arguments of the predicate, with the name of the predicate first, like in an expression, and the element
+    // after it
+    bool bMap = args[1].type == UTTE_VARIABLE_TYPE_HINT_MAP;
+    std::vector<VariableView> call(args.begin() + 1, args.end());
+    call[0] = args[2];
+    if (bMap)
+        call.insert(call.begin() + 1, VariableView{});
+
+    // Every call counts as an iteration, like the ones of "for"
+    auto& gen = generator->root();
+    const auto test = [&](const utte_string& key, const utte_string* value, bool& bKeep) -> ParseResultStatus
+    {
+        if (!gen.charge(0, 1, 0))
+            return UTTE_PARSE_STATUS_BUDGET_EXCEEDED;
+
+        call[1] = { .value = utte_string_view(key.data(), key.size()) };
+        if (value != nullptr)
+            call[2] = { .value = utte_string_view(value->data(), value->size()) };
+        auto result = predicate->call(call, generator);
+        bKeep = getBooleanV(utte_string_view(result.value.data(), result.value.size()));
+        return result.status;
+    };
+
+    bool bKeep = false;
+    if (bMap)
+    {
+        auto* map = getMap(args[1]);
+        if (map == nullptr)
+            return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+
+        auto& result = generator->requestScratchMap();
+        for (auto& a : *map)
+        {
+            auto status = test(a.first, &a.second, bKeep);
+            if (status != UTTE_PARSE_STATUS_SUCCESS)
+                return UTTE_ERROR(status);
+            if (!bKeep)
+                continue;
+            if (!generator->chargeScratch(2 * sizeof(utte_string) + 2 * sizeof(void*) + a.first.size() + a.second.size()))
+                return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_MEMORY);
+            result.insert({ a.first, a.second });
+        }
+        return Generator::makeMap(result);
+    }
+
+    auto* array = getArray(args[1]);
+    if (array == nullptr)
+        return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+
+    auto& result = generator->requestScratchArray();
+    for (auto& a : *array)
+    {
+        auto status = test(a, nullptr, bKeep);
+        if (status != UTTE_PARSE_STATUS_SUCCESS)
+            return UTTE_ERROR(status);
+        if (!bKeep)
+            continue;
+        if (!generator->chargeScratch(sizeof(utte_string) + a.size()))
+            return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_MEMORY);
+        result.push_back(a);
+    }
+    return Generator::makeArray(result);
+}
+
+UTTE::Variable UTTE::CoreFuncs::getEntries(std::vector<VariableView>& args, UTTE::Generator* generator, bool bKeys) noexcept
+{
+    if (args.size() != 2)
+        return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_BOUNDS);
+
+    if (args[1].type == UTTE_VARIABLE_TYPE_HINT_MAP)
+    {
+        auto* map = getMap(args[1]);
+        if (map == nullptr)
+            return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+
+        size_t bytes = sizeof(utte_string) * map->size();
+        for (auto& a : *map)
+            bytes += bKeys ? a.first.size() : a.second.size();
+        if (!generator->chargeScratch(bytes))
+            return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_MEMORY);
+
+        auto& result = generator->requestScratchArray();
+        result.reserve(map->size());
+        for (auto& a : *map)
+            result.push_back(bKeys ? a.first : a.second);
+        return Generator::makeArray(result);
+    }
+    else if (args[1].type == UTTE_VARIABLE_TYPE_HINT_OBJECT)
+    {
+        // Fields are listed in the order they were added to the type, and only read for the values
+        const ObjectType* type;
+        const void* object;
+        if (!getObject(args[1], type, object))
+            return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+
+        auto& result = generator->requestScratchArray();
+        result.reserve(type->size());
+        utte_string buffer;
+        for (size_t i = 0; i < type->size(); i++)
+        {
+            auto value = bKeys ? utte_string_view(type->name(i).data(), type->name(i).size()) : type->get(object, i, buffer).value;
+            if (!generator->chargeScratch(sizeof(utte_string) + value.size()))
+                return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_MEMORY);
+            result.emplace_back(value.data(), value.size());
+        }
+        return Generator::makeArray(result);
+    }
+    return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_TYPE);
+}
+
+template<typename T>
+UTTE::Variable UTTE::CoreFuncs::makeScratchArray(T begin, T end, UTTE::Generator* generator) noexcept
+{
+    size_t bytes = 0;
+    for (auto it = begin; it != end; ++it)
+        bytes += sizeof(utte_string) + it->size();
+    if (!generator->chargeScratch(bytes))
+        return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_MEMORY);
+
+    auto& result = generator->requestScratchArray();
+    result.assign(begin, end);
+    return Generator::makeArray(result);
+}
+
+size_t UTTE::Range::size() const noexcept
+{
+    // Computed on unsigned integers, so that ranges spanning more than half of the integers don't overflow
+    if (step > 0 && start < stop)
+        return static_cast<size_t>((static_cast<uint64_t>(stop) - static_cast<uint64_t>(start) - 1) / static_cast<uint64_t>(step) + 1);
+    if (step < 0 && start > stop)
+        return static_cast<size_t>((static_cast<uint64_t>(start) - static_cast<uint64_t>(stop) - 1) / (0 - static_cast<uint64_t>(step)) + 1);
+    return 0;
+}
+
+int64_t UTTE::Range::at(size_t index) const noexcept
+{
+    return static_cast<int64_t>(static_cast<uint64_t>(start) + static_cast<uint64_t>(index) * static_cast<uint64_t>(step));
+}
+
+intptr_t UTTE::CoreFuncs::getAddress(utte_string_view str) noexcept
+{
+    auto addr = (intptr_t)nullptr;
+    if (std::from_chars(str.data(), str.data() + str.size(), addr).ec != std::errc())
+        return (intptr_t)nullptr;
+    return addr;
+}
+
+UTTE::Variable UTTE::CoreFuncs::funcDict(std::vector<VariableView>& args, UTTE::Generator* generator) noexcept
 {
     if (args.size() == 1)
         return { .value = std::to_string((intptr_t)nullptr), .type = UTTE_VARIABLE_TYPE_HINT_MAP };
 
-    auto& map = generator->requestMapWithGC();
+    // Every entry is counted as a node with 2 strings, the exact overhead depends on the map
+    size_t bytes = 0;
+    for (size_t i = 1; i < args.size(); i++)
+        bytes += sizeof(utte_string) + args[i].value.size();
+    if (!generator->chargeScratch(bytes + (args.size() / 2) * 4 * sizeof(void*)))
+        return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_MEMORY);
+
+    auto& map = generator->requestScratchMap();
     for (size_t i = 1; i < args.size(); i++)
         if ((i % 2) == 0)
-            map.insert({ args[i - 1].value, args[i].value });
+            map.insert({ utte_string(args[i - 1].value.data(), args[i - 1].value.size()), utte_string(args[i].value.data(), args[i].value.size()) });
 
     // This will only be called if we have odd arguments. The check is for even because the function name adds 1
     if (args.size() % 2 == 0)
-        map.insert({ args.back().value, "" });
+        map.insert({ utte_string(args.back().value.data(), args.back().value.size()), "" });
 
     return Generator::makeMap(map);
+}
+
+UTTE::Variable UTTE::CoreFuncs::funcInclude(std::vector<VariableView>& args, UTTE::Generator* generator) noexcept
+{
+    if (args.size() != 2)
+        return UTTE_ERROR(UTTE_PARSE_STATUS_OUT_OF_BOUNDS);
+
+    // The partial is shared between all generators, so it is only loaded the first time any of them includes it
+    auto partial = PartialCache::get(utte_string(args[1].value.data(), args[1].value.size()));
+    if (partial == nullptr)
+        return UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+
+    if (partial->status != UTTE_PARSE_STATUS_SUCCESS)
+        return UTTE_ERROR(partial->status);
+
+    // Partials are rendered in the scope of the caller, so they can use the caller's variables and functions. The
+    // compiled program of the cache runs on the VM, like in "render", so the partial is never parsed again
+    utte_string output;
+    auto status = VM::run(*generator, partial->view, output);
+    if (status != UTTE_PARSE_STATUS_SUCCESS)
+        return UTTE_ERROR(status);
+
+    return { .value = std::move(output), .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
 }
\ No newline at end of file
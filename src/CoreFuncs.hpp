@@ -13,6 +13,18 @@
     typedef std::string utte_string;
 #endif
 
+#ifdef UTTE_CUSTOM_STRING_VIEW
+    #ifdef UTTE_CUSTOM_STRING_VIEW_INCLUDE
+		#include UTTE_CUSTOM_STRING_VIEW_INCLUDE
+		typedef UTTE_CUSTOM_STRING_VIEW utte_string_view;
+	#else
+		#error UTTE_CUSTOM_STRING_VIEW defined but UTTE_CUSTOM_STRING_VIEW_INCLUDE not defined, it is needed to include the necessary headers for the string view, and should contain the name of the header wrapped in ""
+	#endif
+#else
+    #include <string_view>
+    typedef std::string_view utte_string_view;
+#endif
+
 #ifdef UTTE_CUSTOM_MAP
     #ifdef UTTE_CUSTOM_MAP_INCLUDE
 		#include UTTE_CUSTOM_MAP_INCLUDE
@@ -21,6 +33,11 @@
 	#else
 		#error UTTE_CUSTOM_MAP defined but UTTE_CUSTOM_MAP_INCLUDE not defined, it is needed to include the necessary headers for the string, and should contain the name of the header wrapped in ""
 	#endif
+#elif defined(UTTE_FLAT_MAP)
+    // Insertion ordered hash map, faster for maps that are filled once and read many times
+    #include "FlatMap.hpp"
+    template<typename T, typename T2>
+    using utte_map = UTTE::FlatMap<T, T2>;
 #else
     #include <map>
     template<typename T, typename T2>
@@ -32,12 +49,12 @@
 /**
  * @brief A utility macro to set a new value to a variable from a Function&
  * @param x - Function& in question
- * @param y - Value or container that need so be passed to the capture of the internal lambda function
- * @param z - Value that the value of the new variable will be set to. Can use the value or container passed to the
- * capture as "y"
+ * @param y - Value or container that "z" is computed from. Unused, since the value is now copied into the variable
+ * right away, but kept so that existing code compiles
+ * @param z - Value that the value of the new variable will be set to. Can use the value or container passed as "y"
  * @param t - The type of the variable in case you want to change it
  */
-#define UTTE_VARIABLE_SET_NEW_VAL(x, y, z, t) x.function = [y](std::vector<UTTE::Variable>&, UTTE::Generator*) -> UTTE::Variable { return { .value = (z), .type = (t) }; }
+#define UTTE_VARIABLE_SET_NEW_VAL(x, y, z, t) (x).setValue((z), (t))
 
 /**
  * @brief A utility macro to return an empty value with an error type
@@ -48,30 +65,64 @@
 namespace UTTE
 {
     struct Variable;
+    struct VariableView;
     struct Function;
+    struct Sequence;
+    class ObjectType;
     class Generator;
 
+    // The integers from "start" up to, but not including, "stop", counting by "step". Made by the "range" function
+    struct MLS_PUBLIC_API Range
+    {
+        // The number of integers in the range
+        size_t size() const noexcept;
+
+        // Returns the integer at the given index, which has to be less than "size"
+        int64_t at(size_t index) const noexcept;
+
+        int64_t start = 0;
+        int64_t stop = 0;
+        int64_t step = 1;
+    };
+
     class MLS_PUBLIC_API CoreFuncs
     {
     public:
-        static Variable funcIf(std::vector<Variable>& args, Generator* generator) noexcept;
-        static Variable funcSwitch(std::vector<Variable>& args, Generator* generator) noexcept;
-        static Variable funcAt(std::vector<Variable>& args, Generator* generator) noexcept;
-        static Variable funcCond(std::vector<Variable>& args, Generator* generator) noexcept;
-        static Variable funcFor(std::vector<Variable>& args, Generator* generator) noexcept;
+        static Variable funcIf(std::vector<VariableView>& args, Generator* generator) noexcept;
+        static Variable funcSwitch(std::vector<VariableView>& args, Generator* generator) noexcept;
+        static Variable funcAt(std::vector<VariableView>& args, Generator* generator) noexcept;
+        static Variable funcCond(std::vector<VariableView>& args, Generator* generator) noexcept;
+        static Variable funcFor(std::vector<VariableView>& args, Generator* generator) noexcept;
 
-        static Variable funcBoolEqual(std::vector<Variable>& args, Generator* generator) noexcept;
-        static Variable funcBoolNotEqual(std::vector<Variable>& args, Generator* generator) noexcept;
-        static Variable funcBoolNot(std::vector<Variable>& args, Generator* generator) noexcept;
-        static Variable funcBoolAnd(std::vector<Variable>& args, Generator* generator) noexcept;
-        static Variable funcBoolOr(std::vector<Variable>& args, Generator* generator) noexcept;
+        static Variable funcBoolEqual(std::vector<VariableView>& args, Generator* generator) noexcept;
+        static Variable funcBoolNotEqual(std::vector<VariableView>& args, Generator* generator) noexcept;
+        static Variable funcBoolNot(std::vector<VariableView>& args, Generator* generator) noexcept;
+        static Variable funcBoolAnd(std::vector<VariableView>& args, Generator* generator) noexcept;
+        static Variable funcBoolOr(std::vector<VariableView>& args, Generator* generator) noexcept;
 
-        static Variable funcFunc(std::vector<Variable>& args, Generator* generator) noexcept;
-        static Variable funcRaw(std::vector<Variable>& args, Generator* generator) noexcept;
-        static Variable funcComment(std::vector<Variable>& args, Generator* generator) noexcept;
+        static Variable funcFunc(std::vector<VariableView>& args, Generator* generator) noexcept;
+        static Variable funcRaw(std::vector<VariableView>& args, Generator* generator) noexcept;
+        static Variable funcComment(std::vector<VariableView>& args, Generator* generator) noexcept;
 
-        static Variable funcList(std::vector<Variable>& args, Generator* generator) noexcept;
-        static Variable funcDict(std::vector<Variable>& args, Generator* generator) noexcept;
+        static Variable funcList(std::vector<VariableView>& args, Generator* generator) noexcept;
+        static Variable funcDict(std::vector<VariableView>& args, Generator* generator) noexcept;
+
+        static Variable funcInclude(std::vector<VariableView>& args, Generator* generator) noexcept;
+        static Variable funcRange(std::vector<VariableView>& args, Generator* generator) noexcept;
+
+        // Strings are measured and sliced by code points, see UTF8. Arrays, maps, ranges and objects by elements
+        static Variable funcLength(std::vector<VariableView>& args, Generator* generator) noexcept;
+        static Variable funcSlice(std::vector<VariableView>& args, Generator* generator) noexcept;
+
+        // Work on the containers directly, without rendering anything for each element. Arrays and maps that are
+        // returned are scratch containers, see Generator::requestScratchArray
+        static Variable funcJoin(std::vector<VariableView>& args, Generator* generator) noexcept;
+        static Variable funcSort(std::vector<VariableView>& args, Generator* generator) noexcept;
+        static Variable funcReverse(std::vector<VariableView>& args, Generator* generator) noexcept;
+        static Variable funcKeys(std::vector<VariableView>& args, Generator* generator) noexcept;
+        static Variable funcValues(std::vector<VariableView>& args, Generator* generator) noexcept;
+        static Variable funcContains(std::vector<VariableView>& args, Generator* generator) noexcept;
+        static Variable funcFilter(std::vector<VariableView>& args, Generator* generator) noexcept;
 
         /**
          * @brief Given a const reference to a variable, converts it to an array
@@ -80,6 +131,7 @@ namespace UTTE
          * return nullptr. Make sure to check for it.
          */
         static std::vector<std::string>* getArray(const Variable& variable) noexcept;
+        static std::vector<std::string>* getArray(const VariableView& variable) noexcept;
 
         /**
          * @brief Given a const reference to a variable, converts it to a map
@@ -88,8 +140,95 @@ namespace UTTE
          * nullptr will return nullptr. Make sure to check for it.
          */
         static utte_map<std::string, std::string>* getMap(const Variable& variable) noexcept;
+        static utte_map<std::string, std::string>* getMap(const VariableView& variable) noexcept;
+
+        /**
+         * @brief Given a variable, reads the range it encodes
+         * @param variable - The variable in question
+         * @param range - Set to the range, if the variable is one
+         * @return false if the type does not match or the range is malformed
+         */
+        static bool getRange(const VariableView& variable, Range& range) noexcept;
+
+        /**
+         * @brief Given a variable, converts it to a sequence
+         * @param variable - The variable in question
+         * @return A pointer to the sequence. If the type does not match or the address is nullptr will return nullptr
+         */
+        static Sequence* getSequence(const VariableView& variable) noexcept;
+
+        /**
+         * @brief Given a variable, reads the object and type it encodes
+         * @param variable - The variable in question
+         * @param type - Set to the type of the object
+         * @param object - Set to the address of the object
+         * @return false if the type does not match or the encoding is malformed
+         */
+        static bool getObject(const VariableView& variable, const ObjectType*& type, const void*& object) noexcept;
+
+        /**
+         * @brief Encodes an object as "type:object", the addresses of the type and of the object
+         * @param buffer - Has to hold at least 41 characters
+         * @return The number of characters written
+         */
+        static size_t formatObject(const ObjectType& type, const void* object, char* buffer) noexcept;
+
+        /**
+         * @brief Writes an integer to a buffer, for ranges and other functions that generate numbers
+         * @param buffer - Has to hold at least 20 characters
+         * @return The number of characters written
+         */
+        static size_t formatInteger(int64_t value, char* buffer) noexcept;
+
+        /**
+         * @brief Finds a key in a map. Maps that support looking up string views, like UTTE::FlatMap, are searched without
+         * copying the key, others with a copy of it
+         * @param map - The map to search
+         * @param key - The key in question
+         * @return The value of the key, or nullptr if it isn't in the map
+         */
+        static const utte_string* find(const utte_map<utte_string, utte_string>& map, utte_string_view key) noexcept;
 
         // Returns a bool given a boolean value as a string
         static bool getBooleanV(const std::string& str) noexcept;
+        static bool getBooleanV(utte_string_view str) noexcept;
+
+        /**
+         * @brief Selects the function argument that "if", "switch" or "cond" would run, without running it. Shared by
+         * the builtins and the bytecode VM, so that both select branches the same way
+         * @param args - The arguments of the function, including its name
+         * @param index - Set to the index of the selected argument, or to args.size() if the result is an empty string
+         * @return UTTE_PARSE_STATUS_SUCCESS, or the error that the function returns for these arguments
+         */
+        static UTTE_ParseResultStatus selectIf(const std::vector<VariableView>& args, size_t& index) noexcept;
+        static UTTE_ParseResultStatus selectSwitch(const std::vector<VariableView>& args, size_t& index) noexcept;
+        static UTTE_ParseResultStatus selectCond(const std::vector<VariableView>& args, size_t& index) noexcept;
+
+        // Parses the body of a function in a scope nested inside the generator's scope and returns the result
+        static Variable renderBody(utte_string_view body, Generator* generator) noexcept;
+
+        // Returns the index stored in a string, like the one passed to "at". Returns 0 if the string has no index
+        static size_t getIndex(utte_string_view str) noexcept;
+
+        // Reads an index that has to be the whole string, like the ones of ranges and "slice". Returns false for anything
+        // that isn't a non-negative integer, like "-1" or "x", so that it isn't mistaken for the index 0
+        static bool getIndex(utte_string_view str, size_t& index) noexcept;
+
+        /**
+         * @brief Wraps a builtin function, so that it can be called with owned variables, like plugin functions are.
+         * Used for the "function" member of the builtin functions
+         */
+        template<Variable(*F)(std::vector<VariableView>&, Generator*)>
+        static Variable wrap(std::vector<Variable>& args, Generator* generator) noexcept;
+    private:
+        // Reads the address encoded in the value of an array or map
+        static intptr_t getAddress(utte_string_view str) noexcept;
+
+        // Returns the keys or the values of a map or an object as an array, for "keys" and "values"
+        static Variable getEntries(std::vector<VariableView>& args, Generator* generator, bool bKeys) noexcept;
+
+        // Copies the strings between two iterators into a scratch array, counting them against the scratch limit
+        template<typename T>
+        static Variable makeScratchArray(T begin, T end, Generator* generator) noexcept;
     };
 }
\ No newline at end of file
@@ -0,0 +1,186 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace UTTE
+{
+    /**
+     * @brief A map for data that is inserted once and read many times, like string tables. Entries are stored in a
+     * vector in insertion order, which is also the order "for" iterates them in, and are found through an open addressing
+     * hash index, so lookups are O(1). Keys that convert to std::string_view can be looked up without copying them.
+     * Erasing is O(n), since it keeps the order of the remaining entries. Enabled as the utte_map by defining
+     * UTTE_FLAT_MAP, or usable on its own
+     */
+    template<typename K, typename V>
+    class FlatMap
+    {
+    public:
+        typedef K key_type;
+        typedef V mapped_type;
+        typedef std::pair<K, V> value_type;
+        typedef typename std::vector<value_type>::iterator iterator;
+        typedef typename std::vector<value_type>::const_iterator const_iterator;
+
+        FlatMap() noexcept = default;
+
+        FlatMap(std::initializer_list<value_type> values) noexcept
+        {
+            reserve(values.size());
+            for (auto& a : values)
+                insert(a);
+        }
+
+        iterator begin() noexcept { return entries.begin(); }
+        iterator end() noexcept { return entries.end(); }
+        const_iterator begin() const noexcept { return entries.begin(); }
+        const_iterator end() const noexcept { return entries.end(); }
+        const_iterator cbegin() const noexcept { return entries.cbegin(); }
+        const_iterator cend() const noexcept { return entries.cend(); }
+
+        size_t size() const noexcept
+        {
+            return entries.size();
+        }
+
+        bool empty() const noexcept
+        {
+            return entries.empty();
+        }
+
+        // Keeps the memory of the entries and the index, so that a cleared map is refilled without allocating
+        void clear() noexcept
+        {
+            entries.clear();
+            std::fill(index.begin(), index.end(), empty_slot);
+        }
+
+        void reserve(size_t count) noexcept
+        {
+            entries.reserve(count);
+            if (count * 2 > index.size())
+                rehash(count * 2);
+        }
+
+        template<typename T>
+        iterator find(const T& key) noexcept
+        {
+            size_t slot = lookup(key);
+            return slot == npos ? entries.end() : entries.begin() + index[slot];
+        }
+
+        template<typename T>
+        const_iterator find(const T& key) const noexcept
+        {
+            size_t slot = lookup(key);
+            return slot == npos ? entries.end() : entries.begin() + index[slot];
+        }
+
+        template<typename T>
+        bool contains(const T& key) const noexcept
+        {
+            return lookup(key) != npos;
+        }
+
+        // Like std::map, does nothing if the key is already in the map
+        std::pair<iterator, bool> insert(value_type&& value) noexcept
+        {
+            return emplace(std::move(value.first), std::move(value.second));
+        }
+
+        std::pair<iterator, bool> insert(const value_type& value) noexcept
+        {
+            return emplace(value.first, value.second);
+        }
+
+        template<typename T, typename T2>
+        std::pair<iterator, bool> emplace(T&& key, T2&& value) noexcept
+        {
+            size_t slot = lookup(key);
+            if (slot != npos)
+                return { entries.begin() + index[slot], false };
+
+            entries.emplace_back(std::forward<T>(key), std::forward<T2>(value));
+            if (entries.size() * 2 > index.size())
+                rehash(entries.size() * 2);
+            else
+                index[probe(entries.back().first)] = static_cast<uint32_t>(entries.size() - 1);
+            return { entries.end() - 1, true };
+        }
+
+        V& operator[](const K& key) noexcept
+        {
+            return emplace(key, V()).first->second;
+        }
+
+        template<typename T>
+        size_t erase(const T& key) noexcept
+        {
+            size_t slot = lookup(key);
+            if (slot == npos)
+                return 0;
+
+            entries.erase(entries.begin() + index[slot]);
+            rehash(index.size());
+            return 1;
+        }
+    private:
+        static constexpr uint32_t empty_slot = UINT32_MAX;
+        static constexpr size_t npos = SIZE_MAX;
+
+        template<typename T>
+        static size_t hash(const T& key) noexcept
+        {
+            if constexpr (std::is_convertible_v<const T&, std::string_view>)
+                return std::hash<std::string_view>()(std::string_view(key));
+            else
+                return std::hash<T>()(key);
+        }
+
+        // Returns the slot of the key in the index, or npos if it isn't in the map
+        template<typename T>
+        size_t lookup(const T& key) const noexcept
+        {
+            if (index.empty())
+                return npos;
+
+            size_t mask = index.size() - 1;
+            for (size_t slot = hash(key) & mask;; slot = (slot + 1) & mask)
+            {
+                if (index[slot] == empty_slot)
+                    return npos;
+                if (entries[index[slot]].first == key)
+                    return slot;
+            }
+        }
+
+        // Returns the first empty slot for a key that isn't in the map
+        size_t probe(const K& key) const noexcept
+        {
+            size_t mask = index.size() - 1;
+            size_t slot = hash(key) & mask;
+            while (index[slot] != empty_slot)
+                slot = (slot + 1) & mask;
+            return slot;
+        }
+
+        // The index is kept at most half full, and its size is a power of 2
+        void rehash(size_t minimum) noexcept
+        {
+            size_t capacity = 16;
+            while (capacity < minimum)
+                capacity *= 2;
+            index.assign(capacity, empty_slot);
+            for (size_t i = 0; i < entries.size(); i++)
+                index[probe(entries[i].first)] = static_cast<uint32_t>(i);
+        }
+
+        std::vector<value_type> entries;
+        std::vector<uint32_t> index;
+    };
+}
\ No newline at end of file
@@ -1,11 +1,24 @@
 #include "Generator.hpp"
+#include "Memo.hpp"
+#include "Compiler.hpp"
+#include "VM.hpp"
+#include "Precompiled.hpp"
+#include "PartialCache.hpp"
+#include "Snapshot.hpp"
+#include "Specializer.hpp"
+#include "UTF8.hpp"
 #include <fstream>
 
+UTTE::Generator::Generator(UTTE::Generator* parent) noexcept : parent(parent), functions()
+{
+}
+
 UTTE::InitialisationResult UTTE::Generator::loadFromFile(const utte_string& location) noexcept
 {
     std::ifstream in(location);
     if (!in)
         return UTTE_INITIALISATION_RESULT_INVALID_FILE;
+    programOwner.reset();
     in.seekg(0, std::ios::end);
     size_t size = in.tellg();
     data.resize(size);
@@ -13,61 +26,198 @@ UTTE::InitialisationResult UTTE::Generator::loadFromFile(const utte_string& loca
     in.seekg(0);
     in.read(data.data(), static_cast<std::streamsize>(size));
     in.close();
-    return UTTE_INITIALISATION_RESULT_SUCCESS;
+    return checkUTF8();
 }
 
 UTTE::InitialisationResult UTTE::Generator::loadFromString(const utte_string& str) noexcept
 {
     data = str;
-    return UTTE_INITIALISATION_RESULT_SUCCESS;
+    programOwner.reset();
+    return checkUTF8();
+}
+
+UTTE::InitialisationResult UTTE::Generator::loadFromString(utte_string_view str) noexcept
+{
+    data.assign(str.data(), str.size());
+    programOwner.reset();
+    return checkUTF8();
+}
+
+UTTE::InitialisationResult UTTE::Generator::loadFromString(const char* str) noexcept
+{
+    return loadFromString(utte_string_view(str));
 }
 
 UTTE::Function& UTTE::Generator::pushVariable(const UTTE::Variable& var, const utte_string& name) noexcept
 {
-    functions.push_back(Function
-    {
-        .name = name,
-        .function = [var](std::vector<Variable>&, Generator*) -> Variable
-        {
-            return var;
-        },
-    });
-    return functions.back();
+    auto& f = functions.emplace_back(Function{ .name = name, .symbol = SymbolTable::find(name) });
+    f.setValue(var);
+    bUnresolved |= f.symbol == UTTE_SYMBOL_INVALID;
+    return f;
 }
 
 bool UTTE::Generator::setVariable(const char* name, const UTTE::Variable& variable) noexcept
 {
-    for (auto& a : functions)
+    Function* f = findModifiable(name);
+    if (f == nullptr)
+        return false;
+    f->setValue(variable);
+    return true;
+}
+
+bool UTTE::Generator::setFunction(const char* name, const std::function<Func>& event) noexcept
+{
+    Function* f = findModifiable(name);
+    if (f == nullptr)
+        return false;
+    f->function = event;
+    f->asyncFunction = nullptr;
+    f->viewFunction = nullptr;
+    f->bVariable = false;
+
+    // Results cached for the old function are no longer valid
+    if (f->bPure)
+        clearMemo();
+    return true;
+}
+
+UTTE::Function& UTTE::Generator::pushFunction(const UTTE::Function& f) noexcept
+{
+    functions.push_back(f);
+    functions.back().symbol = SymbolTable::intern(f.name);
+
+    // Another pure function with the same name may have been called before, see Function::bPure
+    if (f.bPure)
+        clearMemo();
+    return functions.back();
+}
+
+UTTE::Function* UTTE::Generator::findFunction(UTTE::Symbol symbol) noexcept
+{
+    for (Generator* scope = this; scope != nullptr; scope = scope->parent)
     {
-        if (a.name == name)
-        {
-            a.function = [variable](std::vector<Variable>&, Generator*) -> Variable
-            {
-                return variable;
-            };
-            return true;
-        }
+        if (Function* f = scope->findLocal(symbol))
+            return f;
+
+        // Variables of snapshots are never modified through the result, "findModifiable" shadows them like the ones of
+        // parents
+        if (scope->snapshot != nullptr)
+            if (const Function* f = scope->snapshot->find(symbol))
+                return const_cast<Function*>(f);
     }
-    return false;
+    return nullptr;
 }
 
-bool UTTE::Generator::setFunction(const char* name, const std::function<Func>& event) noexcept
+UTTE::Function* UTTE::Generator::findFunction(utte_string_view name) noexcept
 {
-    for (auto& a : functions)
+    Symbol symbol = SymbolTable::find(name);
+    if (symbol != UTTE_SYMBOL_INVALID)
+        return findFunction(symbol);
+
+    // A name that was never interned can only belong to a variable that was pushed without a symbol. Snapshots intern
+    // the names of their variables
+    for (Generator* scope = this; scope != nullptr; scope = scope->parent)
+        if (scope->bUnresolved)
+            for (auto& a : scope->functions)
+                if (a.symbol == UTTE_SYMBOL_INVALID && a.name == name)
+                    return &a;
+    return nullptr;
+}
+
+void UTTE::Generator::setSnapshot(std::shared_ptr<const UTTE::Snapshot> data) noexcept
+{
+    snapshot = std::move(data);
+}
+
+UTTE::ParseResultStatus UTTE::Generator::specialize(utte_string& residual) noexcept
+{
+    if (programOwner == nullptr)
+    {
+        auto status = compile();
+        if (status != UTTE_PARSE_STATUS_SUCCESS)
+            return status;
+    }
+
+    // Keep the program alive, in case a static function loads a new template while it's being specialized
+    auto owner = programOwner;
+    auto running = program;
+    Specializer::specialize(*this, running, residual);
+    return UTTE_PARSE_STATUS_SUCCESS;
+}
+
+UTTE::Function* UTTE::Generator::findModifiable(const char* name) noexcept
+{
+    Function* f = findFunction(utte_string_view(name));
+    if (f == nullptr)
+        return nullptr;
+
+    // Functions of the parent scope are shadowed instead of modified, so that the change is only visible in this scope
+    if (f < functions.data() || f >= functions.data() + functions.size())
+    {
+        f = &functions.emplace_back(Function{ .name = f->name, .symbol = f->symbol });
+        bUnresolved |= f->symbol == UTTE_SYMBOL_INVALID;
+    }
+    return f;
+}
+
+UTTE::Function* UTTE::Generator::findLocal(UTTE::Symbol symbol) noexcept
+{
+    if (bUnresolved)
+        resolve();
+
+    if (functions.size() >= indexThreshold)
     {
-        if (a.name == name)
+        // Functions were removed, so positions may have changed
+        if (indexed > functions.size())
         {
-            a.function = event;
-            return true;
+            index.clear();
+            indexed = 0;
         }
+
+        for (; indexed < functions.size(); indexed++)
+        {
+            auto& f = functions[indexed];
+            if (f.symbol == UTTE_SYMBOL_INVALID)
+                continue;
+            if (f.symbol >= index.size())
+                index.resize(f.symbol + 1, 0);
+            if (index[f.symbol] == 0)
+                index[f.symbol] = static_cast<uint32_t>(indexed + 1);
+        }
+
+        if (symbol < index.size() && index[symbol] != 0 && functions[index[symbol] - 1].symbol == symbol)
+            return &functions[index[symbol] - 1];
+    }
+
+    // Small scopes are searched linearly. Large ones only get here if the function is missing or was renamed
+    for (size_t i = 0; i < functions.size(); i++)
+    {
+        auto& a = functions[i];
+        if (a.symbol != symbol)
+            continue;
+
+        if (i < indexed && symbol < index.size())
+            index[symbol] = static_cast<uint32_t>(i + 1);
+        return &a;
     }
-    return false;
+    return nullptr;
 }
 
-UTTE::Function& UTTE::Generator::pushFunction(const UTTE::Function& f) noexcept
+void UTTE::Generator::resolve() noexcept
 {
-    functions.push_back(f);
-    return functions.back();
+    auto size = static_cast<uint32_t>(SymbolTable::size());
+    if (size == resolvedSymbols)
+        return;
+    resolvedSymbols = size;
+
+    bUnresolved = false;
+    for (auto& a : functions)
+        if (a.symbol == UTTE_SYMBOL_INVALID && (a.symbol = SymbolTable::find(a.name)) == UTTE_SYMBOL_INVALID)
+            bUnresolved = true;
+
+    // Functions that were just resolved may be before the end of the index
+    index.clear();
+    indexed = 0;
 }
 
 UTTE::Variable UTTE::Generator::makeArray(const std::vector<utte_string>& arr) noexcept
@@ -77,6 +227,11 @@ UTTE::Variable UTTE::Generator::makeArray(const std::vector<utte_string>& arr) n
 
 UTTE::ParseResult UTTE::Generator::parse() noexcept
 {
+    if (parent == nullptr && memo != nullptr && memo->bPerRender)
+        memo->clear();
+    startBudget();
+    UTF8::IndexScope indexScope;
+
     size_t i = data.find_first_of("{{");
 
     for (; i != utte_string::npos; i = data.find("{{", i))
@@ -85,151 +240,598 @@ UTTE::ParseResult UTTE::Generator::parse() noexcept
         ParseResultStatus status = parseFunction(*this, i, true).status;
         if (status != UTTE_PARSE_STATUS_SUCCESS)
             return ParseResult{ .status = status, .result = &data };
+
+        // Everything before "i - 1" is rendered. "i" is one past the end of the result, like after the last character
+        // of an argument, and the template can end right after the result
+        if (!charge(0, 0, i - 1))
+            return ParseResult{ .status = UTTE_PARSE_STATUS_BUDGET_EXCEEDED, .result = &data };
     }
+    if (!charge(0, 0, data.size()))
+        return ParseResult{ .status = UTTE_PARSE_STATUS_BUDGET_EXCEEDED, .result = &data };
     return ParseResult{ .status = UTTE_PARSE_STATUS_SUCCESS, .result = &data };
 }
 
+void UTTE::Generator::reset() noexcept
+{
+    data.clear();
+    output.clear();
+    programOwner.reset();
+    program = {};
+
+    arrays.reset();
+    maps.reset();
+    sequences.reset();
+    objectTypes.reset();
+    snapshot.reset();
+    if (parent == nullptr)
+        resetScratch();
+
+    index.clear();
+    indexed = 0;
+    resolvedSymbols = 0;
+    bUnresolved = false;
+    if (parent != nullptr)
+    {
+        functions.clear();
+        return;
+    }
+
+    // The settings are copied from a default generator as well, so that a reset generator, like one from a
+    // GeneratorPool, renders exactly like a new one
+    static const Generator defaults;
+    scratchLimit = defaults.scratchLimit;
+    executor = nullptr;
+    depth = 0;
+    maxDepth = defaults.maxDepth;
+    utf8Mode = defaults.utf8Mode;
+    budget = defaults.budget;
+    spent = {};
+    bBudgeted = defaults.bBudgeted;
+    steps = 0;
+    memo.reset();
+
+    // Keep the builtins, unless any of them were replaced, in which case they are copied from a default generator
+    bool bIntact = functions.size() >= defaults.functions.size();
+    for (size_t i = 0; bIntact && i < defaults.functions.size(); i++)
+        bIntact = functions[i].symbol == defaults.functions[i].symbol && isBuiltin(functions[i]);
+
+    if (bIntact)
+        functions.erase(functions.begin() + static_cast<std::ptrdiff_t>(defaults.functions.size()), functions.end());
+    else
+        functions = defaults.functions;
+}
+
+UTTE::ParseResultStatus UTTE::Generator::compile() noexcept
+{
+    auto compiled = std::make_shared<Program>();
+    auto status = Compiler::compile(data, *compiled);
+    if (status == UTTE_PARSE_STATUS_SUCCESS)
+    {
+        program = compiled->view();
+        programOwner = std::move(compiled);
+    }
+    return status;
+}
+
+UTTE::ParseResult UTTE::Generator::render() noexcept
+{
+    if (parent == nullptr && memo != nullptr && memo->bPerRender)
+        memo->clear();
+    startBudget();
+    output.clear();
+    if (programOwner == nullptr)
+    {
+        auto status = compile();
+        if (status != UTTE_PARSE_STATUS_SUCCESS)
+            return ParseResult{ .status = status, .result = &output };
+    }
+
+    // Keep the program alive, in case a function loads a new template while it's running
+    auto owner = programOwner;
+    auto running = program;
+    UTF8::IndexScope indexScope;
+    return ParseResult{ .status = VM::run(*this, running, output), .result = &output };
+}
+
+UTTE::Task<UTTE::ParseResult> UTTE::Generator::renderAsync(UTTE::Executor& executor) noexcept
+{
+    if (parent == nullptr && memo != nullptr && memo->bPerRender)
+        memo->clear();
+    startBudget();
+    output.clear();
+    if (programOwner == nullptr)
+    {
+        auto status = compile();
+        if (status != UTTE_PARSE_STATUS_SUCCESS)
+            co_return ParseResult{ .status = status, .result = &output };
+    }
+
+    auto owner = programOwner;
+    auto running = program;
+    auto& r = root();
+    Executor* previous = r.executor;
+    r.executor = &executor;
+
+    VM::Async async{ .executor = &executor };
+    VM::prefetch(*this, running, async);
+
+    // The coroutine may resume on another thread, so the indices are only kept while the program runs on this one
+    ParseResultStatus status;
+    {
+        UTF8::IndexScope indexScope;
+        status = VM::run(*this, running, output, &async);
+    }
+
+    // Every started call is awaited, even after an error, so that no coroutine is destroyed while it waits for I/O
+    for (auto& a : async.prefetched)
+        if (!a.task.done())
+            co_await a.task;
+    for (auto& a : async.deferred)
+        if (!a.task.done())
+            co_await a.task;
+    r.executor = previous;
+
+    if (status != UTTE_PARSE_STATUS_SUCCESS || async.deferred.empty())
+        co_return ParseResult{ .status = status, .result = &output };
+
+    // Put the deferred results in place, in the order they were called in
+    utte_string assembled;
+    size_t last = 0;
+    for (auto& a : async.deferred)
+    {
+        auto& result = a.task.result();
+        if (result.status != UTTE_PARSE_STATUS_SUCCESS)
+            co_return ParseResult{ .status = result.status, .result = &output };
+
+        assembled.append(output, last, a.offset - last);
+        if (!result._internalBoolComment)
+            assembled.append(result.value);
+        last = a.offset;
+    }
+    assembled.append(output, last, utte_string::npos);
+    output.swap(assembled);
+    co_return ParseResult{ .status = UTTE_PARSE_STATUS_SUCCESS, .result = &output };
+}
+
+UTTE::Executor* UTTE::Generator::getExecutor() noexcept
+{
+    return root().executor;
+}
+
+UTTE::InitialisationResult UTTE::Generator::savePrecompiled(const utte_string& location) noexcept
+{
+    if (programOwner == nullptr && compile() != UTTE_PARSE_STATUS_SUCCESS)
+        return UTTE_INITIALISATION_RESULT_INVALID_FILE;
+    return Precompiled::save(program, data, location) ? UTTE_INITIALISATION_RESULT_SUCCESS : UTTE_INITIALISATION_RESULT_INVALID_FILE;
+}
+
+UTTE::InitialisationResult UTTE::Generator::loadFromPrecompiled(const utte_string& location, const utte_string& templateLocation) noexcept
+{
+    auto result = UTTE_INITIALISATION_RESULT_SUCCESS;
+    if (templateLocation.empty())
+    {
+        data.clear();
+        programOwner.reset();
+    }
+    else if ((result = loadFromFile(templateLocation)) == UTTE_INITIALISATION_RESULT_INVALID_FILE)
+        return UTTE_INITIALISATION_RESULT_INVALID_FILE;
+
+    auto precompiled = Precompiled::load(location, templateLocation.empty() ? nullptr : &data);
+    if (precompiled == nullptr)
+        return templateLocation.empty() ? UTTE_INITIALISATION_RESULT_INVALID_FILE : result;
+
+    program = precompiled->view();
+    programOwner = std::move(precompiled);
+    return result;
+}
+
+UTTE::InitialisationResult UTTE::Generator::loadFromCache(const utte_string& path) noexcept
+{
+    auto partial = PartialCache::get(path);
+    if (partial == nullptr)
+        return UTTE_INITIALISATION_RESULT_INVALID_FILE;
+
+    // A template that doesn't compile is compiled again by "render", which returns the error
+    if (partial->status != UTTE_PARSE_STATUS_SUCCESS)
+    {
+        data = partial->source;
+        programOwner.reset();
+        return UTTE_INITIALISATION_RESULT_SUCCESS;
+    }
+
+    data.clear();
+    program = partial->view;
+    programOwner = std::move(partial);
+    return UTTE_INITIALISATION_RESULT_SUCCESS;
+}
+
 std::vector<UTTE::Function>& UTTE::Generator::getFunctionsRegistry() noexcept
 {
+    // The caller may rename or reorder functions, so the index is rebuilt and symbols are resolved on the next lookup
+    index.clear();
+    indexed = 0;
+    resolvedSymbols = 0;
+    bUnresolved = true;
     return functions;
 }
 
 std::vector<utte_string>& UTTE::Generator::requestArrayWithGC() noexcept
 {
-    internalVectorsForList.emplace_back();
-    return internalVectorsForList.back();
+    return arrays.request();
 }
 
 utte_map<utte_string, utte_string>& UTTE::Generator::requestMapWithGC() noexcept
 {
-    internalMapsForDict.emplace_back();
-    return internalMapsForDict.back();
+    return maps.request();
+}
+
+UTTE::Sequence& UTTE::Generator::requestSequenceWithGC() noexcept
+{
+    return sequences.request();
+}
+
+UTTE::ObjectType& UTTE::Generator::requestObjectTypeWithGC() noexcept
+{
+    return objectTypes.request();
+}
+
+std::vector<utte_string>& UTTE::Generator::requestScratchArray() noexcept
+{
+    return root().scratchArrays.request();
+}
+
+utte_map<utte_string, utte_string>& UTTE::Generator::requestScratchMap() noexcept
+{
+    return root().scratchMaps.request();
+}
+
+bool UTTE::Generator::chargeScratch(size_t bytes) noexcept
+{
+    auto& r = root();
+    if (r.scratchLimit != 0 && (bytes > r.scratchLimit || r.scratchBytes > r.scratchLimit - bytes))
+        return false;
+    r.scratchBytes += bytes;
+    return true;
+}
+
+void UTTE::Generator::resetScratch() noexcept
+{
+    auto& r = root();
+    r.scratchArrays.reset();
+    r.scratchMaps.reset();
+    r.scratchBytes = 0;
+}
+
+void UTTE::Generator::setScratchLimit(size_t bytes) noexcept
+{
+    root().scratchLimit = bytes;
+}
+
+void UTTE::Generator::setMemoCapacity(size_t entries, bool bPerRender) noexcept
+{
+    auto& m = root().getMemo();
+    m.setCapacity(entries);
+    m.bPerRender = bPerRender;
+}
+
+void UTTE::Generator::clearMemo() noexcept
+{
+    auto& r = root();
+    if (r.memo != nullptr)
+        r.memo->clear();
+}
+
+UTTE::MemoStats UTTE::Generator::getMemoStats() noexcept
+{
+    auto& r = root();
+    return r.memo != nullptr ? r.memo->getStats() : MemoStats{};
+}
+
+UTTE::MemoCache& UTTE::Generator::getMemo() noexcept
+{
+    if (memo == nullptr)
+        memo = std::make_shared<MemoCache>();
+    return *memo;
+}
+
+void UTTE::Generator::setMaxDepth(size_t depth) noexcept
+{
+    root().maxDepth = depth;
+}
+
+void UTTE::Generator::setUTF8Mode(UTTE::UTF8Mode mode) noexcept
+{
+    utf8Mode = mode;
+}
+
+void UTTE::Generator::setBudget(const UTTE::RenderBudget& limits) noexcept
+{
+    budget = limits;
+    bBudgeted = budget.milliseconds != 0 || budget.expressions != 0 || budget.iterations != 0 || budget.outputBytes != 0;
+}
+
+UTTE::InitialisationResult UTTE::Generator::checkUTF8() noexcept
+{
+    if (utf8Mode == UTTE_UTF8_MODE_NONE)
+        return UTTE_INITIALISATION_RESULT_SUCCESS;
+    if (utf8Mode == UTTE_UTF8_MODE_REPAIR)
+        return UTF8::repair(data) == 0 ? UTTE_INITIALISATION_RESULT_SUCCESS : UTTE_INITIALISATION_RESULT_INVALID_UTF8;
+    return UTF8::validate(utte_string_view(data.data(), data.size())) == data.size() ? UTTE_INITIALISATION_RESULT_SUCCESS : UTTE_INITIALISATION_RESULT_INVALID_UTF8;
+}
+
+bool UTTE::Generator::descend() noexcept
+{
+    auto& r = root();
+    if (r.maxDepth != 0 && r.depth >= r.maxDepth)
+        return false;
+    ++r.depth;
+    return true;
+}
+
+void UTTE::Generator::ascend() noexcept
+{
+    --root().depth;
+}
+
+void UTTE::Generator::startBudget() noexcept
+{
+    if (parent != nullptr || !bBudgeted)
+        return;
+    spent = {};
+    steps = 0;
+    if (budget.milliseconds != 0)
+        deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(budget.milliseconds);
+}
+
+bool UTTE::Generator::charge(size_t expressions, size_t iterations, size_t outputSize) noexcept
+{
+    auto& r = root();
+    if (!r.bBudgeted)
+        return true;
+
+    r.spent.expressions += expressions;
+    r.spent.iterations += iterations;
+    auto& limit = r.budget;
+    if ((limit.expressions != 0 && r.spent.expressions > limit.expressions) || (limit.iterations != 0 && r.spent.iterations > limit.iterations)
+        || (limit.outputBytes != 0 && outputSize > limit.outputBytes))
+        return false;
+
+    // Reading the clock costs more than the rest of the checks together, so it's only read every 64 steps
+    return limit.milliseconds == 0 || (r.steps++ % 64) != 0 || std::chrono::steady_clock::now() < r.deadline;
+}
+
+UTTE::Generator& UTTE::Generator::root() noexcept
+{
+    Generator* result = this;
+    while (result->parent != nullptr)
+        result = result->parent;
+    return *result;
 }
 
 UTTE::ParseResult UTTE::Generator::parseFunction(UTTE::Generator& generator, size_t& i, bool bRoot) noexcept
 {
     auto& data = generator.data;
+    auto& root = generator.root();
+
+    // Nested expressions are parsed in a new frame instead of a recursive call, so that the nesting of a template is only
+    // limited by the max depth, not by the size of the thread's stack. The first frame only holds the text around the
+    // outermost expression, every other frame counts against the max depth. Frames that are still open when returning
+    // are given back
+    std::vector<ParseFrame> frames;
+    struct Unwind
+    {
+        ~Unwind() noexcept
+        {
+            if (!frames.empty())
+                root.depth -= frames.size() - 1;
+        }
 
-    UTTE::ParseResult result{}; // The result to return
-    size_t begin = i; // Get the initial position of i. This is needed so that we can split the strings correctly
+        Generator& root;
+        std::vector<ParseFrame>& frames;
+    } unwind{ root, frames };
 
-    size_t beginCut = begin;
-    bool bWasSpace = true;
-    //bool bPreviousWasSpace = true;
-    //size_t beginCut = begin;
-    std::vector<Variable> args;
+    frames.push_back({ .beginCut = i, .bRoot = bRoot });
+
+    // Arguments cut from the template are stored as offsets, since the template is modified while we parse it. Results
+    // of nested expressions are owned by the frame. Views of both are only created right before calling the function
+    const auto argumentView = [&](const ParseFrame& frame, const ArgumentSlice& slice) -> VariableView
+    {
+        if (slice.result != ArgumentSlice::npos)
+        {
+            auto& result = frame.results[slice.result];
+            return { .value = utte_string_view(result.value.data(), result.value.size()), .type = result.type };
+        }
+        return { .value = utte_string_view(data.data() + slice.begin, slice.size), .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
+    };
 
-    for (; i < data.size(); i++)
+    const auto call = [&](ParseFrame& frame, Function& f) -> void
     {
-        auto& it = data[i];
-        auto& pit = data[i - 1]; // pit = previous iterator
+        std::vector<VariableView> views;
+        views.reserve(frame.args.size());
+        for (auto& a : frame.args)
+            views.push_back(argumentView(frame, a));
 
-        // Start function
-        if ((i - 1) >= 0 && it == '{' && pit == '{')
+        if (!root.charge(1, 0, 0))
         {
-            // This is because we will be at the second bracket, but we want the first one
-            size_t locationBeforeAppend = i - 1;
-
-            // Increment i to exit the brackets, otherwise we will be in an endless loop
-            ++i;
-            // if "i" is equal to the size of our string terminate since we have a malformed statement with no termination
-            if (i == data.size())
-                return { .status = UTTE_PARSE_STATUS_EXPECTED_TERMINATION };
-
-            // Recursively parse the function
-            auto res = parseFunction(generator, i, false);
-            if (result.status != UTTE_PARSE_STATUS_SUCCESS)
-                return result;
-
-            // Replace all data, previously occupied by a function expression. Add 1 to also remove the last bracket
-            // since we are doing "look back" iteration, and we haven't updated the index in the previous recursive call
-            data.replace(locationBeforeAppend, i - locationBeforeAppend + 1, bRoot ? res._internalBuffer.value : "");
-
-            // A comment will produce an empty result, which we don't want. In general, we do accept empty results, just
-            // not ones generated by comments
-            if (!res._internalBuffer._internalBoolComment)
-                args.push_back(res._internalBuffer);
-
-            // This is done so that we don't break special functions. It's also more performant :)
-            i = bRoot ? locationBeforeAppend + res._internalBuffer.value.length() : locationBeforeAppend;
-
-            bWasSpace = true;
-            //beginCut = i + 1;
-            beginCut = (i + 1) < data.size() && (data[i + 1] == ' ' ||
-                                                 data[i + 1] == '\t' ||
-                                                 data[i + 1] == '\v' ||
-                                                 data[i + 1] == '\n') ? i + 1 : i;
-            continue;
-        } // End function
-        else if ((i - 2) >= 0 && it == '}' && pit == '}')
+            frame.result.status = UTTE_PARSE_STATUS_BUDGET_EXCEEDED;
+            return;
+        }
+        frame.result._internalBuffer = f.call(views, &generator);
+        frame.result.status = frame.result._internalBuffer.status;
+    };
+
+    for (;;)
+    {
+        auto& frame = frames.back();
+        bool bNested = false;
+        for (; i < data.size(); i++)
         {
-            // In case a string is like this: {{ func arg1 arg2}} instead of {{ func arg1 arg2 }} we do a final cut
-            if (data[i - 2] != ' ' && data[i - 2] != '\t' && data[i - 2] != '\v' && data[i - 2] != '\n')
-                args.push_back({ .value = data.substr(beginCut, i - 1 - beginCut), .type = UTTE_VARIABLE_TYPE_HINT_NORMAL });
+            auto& it = data[i];
+            auto& pit = data[i - 1]; // pit = previous iterator
 
-            // If it's an empty string return an empty result. If not find the correct function and call it.
-            if (!args.empty())
+            // Start function
+            if ((i - 1) >= 0 && it == '{' && pit == '{')
             {
-                for (auto& a : generator.functions)
+                // This is because we will be at the second bracket, but we want the first one
+                frame.locationBeforeAppend = i - 1;
+
+                // Increment i to exit the brackets, otherwise we will be in an endless loop
+                ++i;
+                // if "i" is equal to the size of our string terminate since we have a malformed statement with no termination
+                if (i == data.size())
+                    return { .status = UTTE_PARSE_STATUS_EXPECTED_TERMINATION };
+
+                // Parse the nested expression in a new frame. Its result is put in place once the frame is done
+                if (!root.descend())
+                    return { .status = UTTE_PARSE_STATUS_DEPTH_EXCEEDED };
+                bNested = true;
+                break;
+            } // End function
+            else if ((i - 2) >= 0 && it == '}' && pit == '}')
+            {
+                // In case a string is like this: {{ func arg1 arg2}} instead of {{ func arg1 arg2 }} we do a final cut
+                if (!isSpace(data[i - 2]))
+                    frame.args.push_back({ .begin = frame.beginCut, .size = i - 1 - frame.beginCut });
+
+                // If it's an empty string return an empty result. If not find the correct function and call it.
+                if (!frame.args.empty())
                 {
-                    if (a.name == args[0].value)
-                    {
-                        result._internalBuffer = a.function(args, &generator);
-                        result.status = result._internalBuffer.status;
-                        return result;
-                    }
+                    Function* f = generator.findFunction(argumentView(frame, frame.args[0]).value);
+                    if (f != nullptr)
+                        call(frame, *f);
                 }
-            }
-            return result;
-        } // Argument and most of the string cutting behaviour here
-        if (!((i + 1) < data.size() && it == '}' && data[i + 1] == '}')
-            && (it == ' ' || it == '\t' || it == '\v' || it == '\n' || ((i + 1) < data.size() && it == '{' && data[i + 1] == '{') || (i + 1) == data.size()))
-        {
-            if (bWasSpace)
-                ++beginCut;
-            else
+                break;
+            } // Argument and most of the string cutting behaviour here
+            if (!((i + 1) < data.size() && it == '}' && data[i + 1] == '}')
+                && (isSpace(it) || ((i + 1) < data.size() && it == '{' && data[i + 1] == '{') || (i + 1) == data.size()))
             {
-                args.push_back({ .value = data.substr(beginCut, i - beginCut), .type = UTTE_VARIABLE_TYPE_HINT_NORMAL });
-                if (args.size() == 1)
+                if (frame.bWasSpace)
+                    ++frame.beginCut;
+                else
                 {
-                    for (auto a : generator.specialFunctions)
+                    frame.args.push_back({ .begin = frame.beginCut, .size = i - frame.beginCut });
+                    if (frame.args.size() == 1)
                     {
-                        // Matched a special function
-                        if (generator.functions[a].name == args[0].value)
+                        Symbol symbol = SymbolTable::find(argumentView(frame, frame.args[0]).value);
+                        for (auto a : generator.specialFunctions)
                         {
-                            // Go up by 1 index so that we don't start from the " "
-                            i = (i + 1) == data.size() ? i : i + 1;
-                            size_t depth = 0; // Expression depth level
-                            size_t initialPos = i;
-                            for (; i < data.size(); i++)
+                            Function* f = nullptr;
+
+                            // Matched a special function
+                            if (a == symbol && (f = generator.findFunction(symbol)) != nullptr)
                             {
-                                if (data[i] == '{' && data[i - 1] == '{')
-                                    ++depth;
-                                else if (data[i] == '}' && data[i - 1] == '}')
+                                // Go up by 1 index so that we don't start from the " "
+                                i = (i + 1) == data.size() ? i : i + 1;
+                                size_t depth = 0; // Expression depth level
+                                size_t initialPos = i;
+                                for (; i < data.size(); i++)
                                 {
-                                    if (depth == 0)
-                                        goto exit_special_fun_inner_block;
-                                    --depth;
-                                    ++i;
+                                    if (data[i] == '{' && data[i - 1] == '{')
+                                        ++depth;
+                                    else if (data[i] == '}' && data[i - 1] == '}')
+                                    {
+                                        if (depth == 0)
+                                            goto exit_special_fun_inner_block;
+                                        --depth;
+                                        ++i;
+                                    }
                                 }
-                            }
 exit_special_fun_inner_block:
-                            args.push_back({ .value = data.substr(initialPos, i - initialPos - 1), .type = UTTE_VARIABLE_TYPE_HINT_NORMAL });
-                            result._internalBuffer = generator.functions[a].function(args, &generator);
-                            result.status = result._internalBuffer.status;
-
-                            return result;
+                                frame.args.push_back({ .begin = initialPos, .size = i - initialPos - 1 });
+                                call(frame, *f);
+                                goto exit_frame;
+                            }
                         }
                     }
                 }
+                frame.bWasSpace = true;
+                frame.beginCut = (i + 1) < data.size() ? i + 1 : i;
             }
-            bWasSpace = true;
-            beginCut = (i + 1) < data.size() ? i + 1 : i;
+            else
+                frame.bWasSpace = false;
         }
+
+        if (bNested)
+        {
+            frames.push_back({ .beginCut = i });
+            continue;
+        }
+exit_frame:
+        auto res = std::move(frames.back().result);
+        frames.pop_back();
+        if (frames.empty())
+            return res;
+        root.ascend();
+
+        auto& parent = frames.back();
+        if (res.status != UTTE_PARSE_STATUS_SUCCESS)
+            return { .status = res.status };
+
+        // Replace all data, previously occupied by a function expression. Add 1 to also remove the last bracket
+        // since we are doing "look back" iteration, and we haven't updated the index in the nested frame
+        if (parent.bRoot)
+            data.replace(parent.locationBeforeAppend, i - parent.locationBeforeAppend + 1, res._internalBuffer.value);
         else
-            bWasSpace = false;
+            data.erase(parent.locationBeforeAppend, i - parent.locationBeforeAppend + 1);
+
+        // This is done so that we don't break special functions. It's also more performant :)
+        i = parent.bRoot ? parent.locationBeforeAppend + res._internalBuffer.value.length() : parent.locationBeforeAppend;
+
+        // A comment will produce an empty result, which we don't want. In general, we do accept empty results, just
+        // not ones generated by comments
+        if (!res._internalBuffer._internalBoolComment)
+        {
+            parent.args.push_back({ .result = parent.results.size() });
+            parent.results.push_back(std::move(res._internalBuffer));
+        }
+
+        // The character right after the expression is skipped by the increment of the loop, so the next argument
+        // has to start after it if it's a space, or at it otherwise
+        parent.bWasSpace = i >= data.size() || isSpace(data[i]);
+        parent.beginCut = parent.bWasSpace ? i + 1 : i;
+        ++i;
     }
-    return result;
+}
+
+bool UTTE::Generator::isSpace(char c) noexcept
+{
+    return c == ' ' || c == '\t' || c == '\v' || c == '\n';
+}
+
+bool UTTE::Generator::isBuiltin(const UTTE::Function& f) noexcept
+{
+    // Indexed by symbol, has to be in the same order as the BuiltinSymbol enum
+    static constexpr ViewFunc* builtins[UTTE_SYMBOL_BUILTIN_COUNT] =
+    {
+        nullptr,
+        CoreFuncs::funcFunc,
+        CoreFuncs::funcRaw,
+        CoreFuncs::funcComment,
+        CoreFuncs::funcIf,
+        CoreFuncs::funcSwitch,
+        CoreFuncs::funcAt,
+        CoreFuncs::funcCond,
+        CoreFuncs::funcFor,
+        CoreFuncs::funcBoolEqual,
+        CoreFuncs::funcBoolNotEqual,
+        CoreFuncs::funcBoolNot,
+        CoreFuncs::funcBoolAnd,
+        CoreFuncs::funcBoolOr,
+        CoreFuncs::funcList,
+        CoreFuncs::funcDict,
+        CoreFuncs::funcInclude,
+        CoreFuncs::funcRange,
+        CoreFuncs::funcLength,
+        CoreFuncs::funcSlice,
+        CoreFuncs::funcJoin,
+        CoreFuncs::funcSort,
+        CoreFuncs::funcReverse,
+        CoreFuncs::funcKeys,
+        CoreFuncs::funcValues,
+        CoreFuncs::funcContains,
+        CoreFuncs::funcFilter,
+    };
+    return f.symbol < UTTE_SYMBOL_BUILTIN_COUNT && f.viewFunction != nullptr && f.viewFunction == builtins[f.symbol];
 }
 
 UTTE::Variable UTTE::Generator::makeMap(const utte_map<utte_string, utte_string>& map) noexcept
@@ -237,7 +839,190 @@ UTTE::Variable UTTE::Generator::makeMap(const utte_map<utte_string, utte_string>
     return { .value = std::to_string(((intptr_t)&map)), .type = UTTE_VARIABLE_TYPE_HINT_MAP };
 }
 
+UTTE::Variable UTTE::Generator::makeRange(int64_t start, int64_t stop, int64_t step) noexcept
+{
+    // Encoded as "start:stop:step". Small ranges fit in the inline buffer of the string, so they don't allocate
+    char buffer[64];
+    size_t size = CoreFuncs::formatInteger(start, buffer);
+    buffer[size++] = ':';
+    size += CoreFuncs::formatInteger(stop, buffer + size);
+    buffer[size++] = ':';
+    size += CoreFuncs::formatInteger(step, buffer + size);
+    return { .value = utte_string(buffer, size), .type = UTTE_VARIABLE_TYPE_HINT_RANGE };
+}
+
+UTTE::Variable UTTE::Generator::makeSequence(const UTTE::Sequence& sequence) noexcept
+{
+    return { .value = std::to_string(((intptr_t)&sequence)), .type = UTTE_VARIABLE_TYPE_HINT_SEQUENCE };
+}
+
+UTTE::Variable UTTE::Generator::makeObject(const UTTE::ObjectType& type, const void* object) noexcept
+{
+    char buffer[41];
+    return { .value = utte_string(buffer, CoreFuncs::formatObject(type, object, buffer)), .type = UTTE_VARIABLE_TYPE_HINT_OBJECT };
+}
+
+void UTTE::Sequence::clear() noexcept
+{
+    begin = nullptr;
+    next = nullptr;
+}
+
+UTTE::ObjectType& UTTE::ObjectType::field(const utte_string& name, const std::function<Accessor>& accessor) noexcept
+{
+    auto it = index.find(name);
+    if (it != index.end())
+        fields[it->second].accessor = accessor;
+    else
+    {
+        index.emplace(name, fields.size());
+        fields.push_back({ .name = name, .accessor = accessor });
+    }
+    return *this;
+}
+
+bool UTTE::ObjectType::get(const void* object, utte_string_view name, UTTE::VariableView& value, utte_string& buffer) const noexcept
+{
+    auto it = index.find(name);
+    if (it == index.end())
+        return false;
+
+    value = fields[it->second].accessor(object, buffer);
+    return true;
+}
+
+UTTE::VariableView UTTE::ObjectType::get(const void* object, size_t i, utte_string& buffer) const noexcept
+{
+    return fields[i].accessor(object, buffer);
+}
+
+const utte_string& UTTE::ObjectType::name(size_t i) const noexcept
+{
+    return fields[i].name;
+}
+
+size_t UTTE::ObjectType::size() const noexcept
+{
+    return fields.size();
+}
+
+UTTE::Sequence UTTE::ObjectType::sequence(const void* objects, size_t count, size_t stride) const noexcept
+{
+    // The position and the encoding of the current object are shared by both callbacks
+    struct State
+    {
+        size_t index = 0;
+        char encoded[41];
+    };
+    auto state = std::make_shared<State>();
+
+    return {
+        .begin = [state]() -> void { state->index = 0; },
+        .next = [state, type = this, objects, count, stride](VariableView& element) -> bool
+        {
+            if (state->index >= count)
+                return false;
+
+            size_t size = CoreFuncs::formatObject(*type, static_cast<const char*>(objects) + state->index++ * stride, state->encoded);
+            element = { .value = utte_string_view(state->encoded, size), .type = UTTE_VARIABLE_TYPE_HINT_OBJECT };
+            return true;
+        },
+    };
+}
+
+void UTTE::ObjectType::clear() noexcept
+{
+    fields.clear();
+    index.clear();
+}
+
 bool UTTE::Variable::operator==(const UTTE::Variable &variable) const noexcept
 {
     return (this->value == variable.value && this->type == variable.type );
 }
+
+bool UTTE::VariableView::operator==(const UTTE::VariableView& variable) const noexcept
+{
+    return (this->value == variable.value && this->type == variable.type);
+}
+
+UTTE::Variable UTTE::VariableView::toVariable() const noexcept
+{
+    return { .value = utte_string(value.data(), value.size()), .type = type, .status = status };
+}
+
+UTTE::Variable UTTE::Function::call(std::vector<VariableView>& args, UTTE::Generator* generator) const noexcept
+{
+    if (bVariable)
+        return variable;
+    if (!bPure || generator == nullptr)
+        return invoke(args, generator);
+
+    // The function may call other pure functions, so the cache is looked up again when inserting
+    auto& memo = generator->root().getMemo();
+    utte_string key;
+    if (auto* result = memo.find(symbol, args, key))
+        return *result;
+
+    auto result = invoke(args, generator);
+    memo.insert(std::move(key), result);
+    return result;
+}
+
+UTTE::Variable UTTE::Function::invoke(std::vector<VariableView>& args, UTTE::Generator* generator) const noexcept
+{
+    if (bVariable)
+        return variable;
+    if (viewFunction != nullptr)
+        return viewFunction(args, generator);
+
+    // Functions that don't take views get their own copy of the arguments
+    std::vector<Variable> variables;
+    variables.reserve(args.size());
+    for (auto& a : args)
+        variables.push_back(a.toVariable());
+    if (!asyncFunction)
+        return function(variables, generator);
+
+    // Outside of renderAsync, async functions are waited for right away, on an inline executor if there's none
+    auto& root = generator->root();
+    InlineExecutor fallback;
+    Executor* previous = root.executor;
+    if (root.executor == nullptr)
+        root.executor = &fallback;
+
+    auto task = asyncFunction(std::move(variables), generator);
+    bool bDone = task.wait(*root.executor);
+    root.executor = previous;
+    return bDone ? std::move(task.result()) : UTTE_ERROR(UTTE_PARSE_STATUS_INVALID_VALUE);
+}
+
+void UTTE::Function::setValue(const UTTE::Variable& value) noexcept
+{
+    variable = value;
+    asyncFunction = nullptr;
+    viewFunction = nullptr;
+    bVariable = true;
+}
+
+void UTTE::Function::setValue(const char* value, size_t size, UTTE::VariableTypeHint type) noexcept
+{
+    variable.value.assign(value, size);
+    variable.type = type;
+    variable.status = UTTE_PARSE_STATUS_SUCCESS;
+    variable._internalBoolComment = false;
+    asyncFunction = nullptr;
+    viewFunction = nullptr;
+    bVariable = true;
+}
+
+void UTTE::Function::setValue(const utte_string& value, UTTE::VariableTypeHint type) noexcept
+{
+    variable.value = value;
+    variable.type = type;
+    variable.status = UTTE_PARSE_STATUS_SUCCESS;
+    variable._internalBoolComment = false;
+    asyncFunction = nullptr;
+    viewFunction = nullptr;
+    bVariable = true;
+}
\ No newline at end of file
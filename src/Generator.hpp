@@ -1,10 +1,17 @@
 #pragma once
+#include <charconv>
+#include <chrono>
 #include <cinttypes>
+#include <type_traits>
 #include <vector>
 #include <map>
 #include <functional>
+#include <memory>
 #include "Common.h"
 #include "CoreFuncs.hpp"
+#include "Program.hpp"
+#include "Arena.hpp"
+#include "Async.hpp"
 #include "C/CGenerator.h"
 
 namespace UTTE
@@ -12,6 +19,12 @@ namespace UTTE
     typedef UTTE_VariableTypeHint VariableTypeHint;
     typedef UTTE_InitialisationResult InitialisationResult;
     typedef UTTE_ParseResultStatus ParseResultStatus;
+    typedef UTTE_MemoStats MemoStats;
+    typedef UTTE_UTF8Mode UTF8Mode;
+    typedef UTTE_RenderBudget RenderBudget;
+
+    class MemoCache;
+    class Snapshot;
 
     struct MLS_PUBLIC_API Variable
     {
@@ -24,6 +37,107 @@ namespace UTTE
         bool _internalBoolComment = false;
     };
 
+    /**
+     * @brief A variable that doesn't own its value. Builtin functions receive their arguments as views into the
+     * template or into the results of nested expressions, so that arguments that are only read are never copied. A
+     * view is only valid for the duration of the function call, call "toVariable" to keep it.
+     */
+    struct MLS_PUBLIC_API VariableView
+    {
+        bool operator==(const VariableView& variable) const noexcept;
+
+        // Returns a copy of the view that owns its value
+        Variable toVariable() const noexcept;
+
+        utte_string_view value{};
+        VariableTypeHint type = UTTE_VARIABLE_TYPE_HINT_NORMAL;
+        ParseResultStatus status = UTTE_PARSE_STATUS_SUCCESS;
+    };
+
+    /**
+     * @brief Produces the elements of a "for" loop one at a time, so that they don't have to be copied into an array
+     * first, and rendering can start before all of them are known. "begin" is called at the start of every loop over
+     * the sequence, then "next" until it returns false. "next" sets the element, which may view memory of the producer,
+     * since the loop copies it before calling "next" again. A sequence can't be iterated by a loop nested in a loop
+     * over itself. Bind it with Generator::makeSequence, which encodes its address, so it has to outlive the render
+     */
+    struct MLS_PUBLIC_API Sequence
+    {
+        // Used by Arena
+        void clear() noexcept;
+
+        std::function<void()> begin;
+        std::function<bool(VariableView&)> next;
+    };
+
+    /**
+     * @brief Describes the fields of a type, so that objects of it can be bound by address with Generator::makeObject
+     * instead of being copied into a map. "at" and "for key val" call the accessor of a field only when they read it.
+     * Accessors return a view of the value. Fields that aren't stored as strings are written to the buffer given to the
+     * accessor, and the view points to it. The type and the objects have to outlive the render
+     */
+    class MLS_PUBLIC_API ObjectType
+    {
+    public:
+        typedef VariableView(Accessor)(const void* object, utte_string& buffer);
+
+        // Adds a field, or replaces the accessor of the field with the same name. Returns the type, so that calls can
+        // be chained
+        ObjectType& field(const utte_string& name, const std::function<Accessor>& accessor) noexcept;
+
+        // Adds a field that reads a member of T. String members are viewed, integer members are formatted
+        template<typename T, typename M>
+        ObjectType& field(const utte_string& name, M T::* member) noexcept
+        {
+            return field(name, [member](const void* object, utte_string& buffer) -> VariableView
+            {
+                const M& value = static_cast<const T*>(object)->*member;
+                if constexpr (std::is_integral_v<M>)
+                {
+                    buffer.resize(24);
+                    buffer.resize(static_cast<size_t>(std::to_chars(buffer.data(), buffer.data() + buffer.size(), value).ptr - buffer.data()));
+                    return { .value = utte_string_view(buffer.data(), buffer.size()) };
+                }
+                else
+                    return { .value = utte_string_view(value.data(), value.size()) };
+            });
+        }
+
+        // Reads a field of an object of this type. Returns false if the type has no field with that name
+        bool get(const void* object, utte_string_view name, VariableView& value, utte_string& buffer) const noexcept;
+
+        // Reads the field at the given index, in the order the fields were added
+        VariableView get(const void* object, size_t index, utte_string& buffer) const noexcept;
+        const utte_string& name(size_t index) const noexcept;
+
+        // The number of fields
+        size_t size() const noexcept;
+
+        // Makes a sequence of "count" objects, the first at "objects" and each "stride" bytes after the previous one, so
+        // that "for" can iterate an array of objects. The sequence has to be bound with Generator::makeSequence
+        Sequence sequence(const void* objects, size_t count, size_t stride) const noexcept;
+
+        template<typename T>
+        Sequence sequence(const std::vector<T>& objects) const noexcept
+        {
+            return sequence(objects.data(), objects.size(), sizeof(T));
+        }
+
+        // Used by Arena
+        void clear() noexcept;
+    private:
+        struct Field
+        {
+            utte_string name;
+            std::function<Accessor> accessor;
+        };
+
+        std::vector<Field> fields;
+
+        // The indices of the fields by name. The transparent comparator finds views without copying them
+        std::map<utte_string, size_t, std::less<>> index;
+    };
+
     struct MLS_PUBLIC_API ParseResult
     {
         ParseResultStatus status = UTTE_PARSE_STATUS_SUCCESS;
@@ -33,11 +147,56 @@ namespace UTTE
     };
 
     using Func = Variable(std::vector<Variable>&, UTTE::Generator*);
+    using ViewFunc = Variable(std::vector<VariableView>&, UTTE::Generator*);
+
+    // A function that can wait for I/O. Arguments are taken by value, since the coroutine may outlive the call
+    using AsyncFunc = Task<Variable>(std::vector<Variable>, UTTE::Generator*);
 
     struct MLS_PUBLIC_API Function
     {
+        // Returns the cached result if the function is pure and was called with the same arguments before, otherwise
+        // calls it with "invoke"
+        Variable call(std::vector<VariableView>& args, Generator* generator) const noexcept;
+
+        // Calls "viewFunction" if it's set, otherwise calls "function" with copies of the arguments
+        Variable invoke(std::vector<VariableView>& args, Generator* generator) const noexcept;
+
         utte_string name;
         std::function<Func> function = [](std::vector<Variable>&, UTTE::Generator*) -> Variable{ return {}; };
+
+        // The interned name. Variables whose name wasn't interned when they were pushed keep UTTE_SYMBOL_INVALID, and are
+        // found by name, until it is. If you rename a function through the functions registry, reset this to
+        // UTTE_SYMBOL_INVALID
+        Symbol symbol = UTTE_SYMBOL_INVALID;
+
+        // Used instead of "function" when set, so that the arguments don't have to be copied. The builtin functions
+        // set this. If you replace "function" through the functions registry, reset this to nullptr
+        ViewFunc* viewFunction = nullptr;
+
+        // Set for variables, whose value is stored in "variable" instead of being returned by "function", so that
+        // reading them doesn't call anything. If you replace "function" through the functions registry, reset this to
+        // false
+        bool bVariable = false;
+        Variable variable{};
+
+        // Used instead of "function" when set. "renderAsync" runs calls to it concurrently, every other way of rendering
+        // waits for each call before continuing. If you replace "function" through the functions registry, reset this
+        std::function<AsyncFunc> asyncFunction = nullptr;
+
+        // Set for functions whose result only depends on their arguments, like formatters, so that results can be
+        // cached, see Generator::setMemoCapacity. Results are cached by name, so a pure function must not shadow
+        // another pure function with the same name
+        bool bPure = false;
+
+        // Set for variables whose value is fixed for as long as a template is used, like the name of a site, and for
+        // functions whose result only depends on their arguments and never changes, so that Generator::specialize can
+        // substitute them ahead of time
+        bool bStatic = false;
+
+        // Turns the function into a variable with the given value. The memory of the previous value is reused
+        void setValue(const Variable& value) noexcept;
+        void setValue(const utte_string& value, VariableTypeHint type) noexcept;
+        void setValue(const char* value, size_t size, VariableTypeHint type) noexcept;
     };
 
     class MLS_PUBLIC_API Generator
@@ -45,11 +204,85 @@ namespace UTTE
     public:
         Generator() = default;
 
+        /**
+         * @brief Creates a generator whose scope is nested inside the scope of the parent. All variables and functions
+         * of the parent are visible without being copied. Variables and functions pushed to this generator shadow the
+         * parent's and are only visible to it. The parent has to outlive the generator
+         * @param parent - The generator whose scope to use
+         */
+        explicit Generator(Generator* parent) noexcept;
+
         InitialisationResult loadFromFile(const utte_string& location) noexcept;
         InitialisationResult loadFromString(const utte_string& str) noexcept;
+        InitialisationResult loadFromString(utte_string_view str) noexcept;
+        InitialisationResult loadFromString(const char* str) noexcept;
 
         ParseResult parse() noexcept;
 
+        /**
+         * @brief Returns the generator to the state it was in after being constructed, without deallocating the builtin
+         * functions or the memory of its buffers. Removes the template, the program, all pushed variables and
+         * functions, all containers requested with GC and the scratch containers. Builtin functions that were replaced
+         * are restored. Cached results of pure functions and the snapshot are removed. The scratch limit, the max depth,
+         * the UTF-8 mode, the budget and the settings of the cache go back to their defaults
+         */
+        void reset() noexcept;
+
+        // Compiles the loaded template to bytecode. This is done by "render" when needed, but it can be called ahead
+        // of time, for example to check for errors. Returns UTTE_PARSE_STATUS_EXPECTED_TERMINATION if an expression is
+        // not terminated
+        ParseResultStatus compile() noexcept;
+
+        /**
+         * @brief Renders the loaded template by running its compiled bytecode, compiling it first if needed. Gives the
+         * same result as "parse", which is kept as the reference implementation. Unlike "parse", the loaded template
+         * is not modified, so it can be rendered again, for example after changing variables, without loading it again
+         * @return The result, which points to a buffer that is reused by the next call to "render"
+         */
+        ParseResult render() noexcept;
+
+        /**
+         * @brief Renders the loaded template like "render", while letting async functions wait for I/O concurrently.
+         * Calls whose arguments are all literals are started before rendering, and calls whose result goes straight to
+         * the output are only awaited after rendering, then put in place in document order. Calls whose result is an
+         * argument of another expression run the executor until they're done, since the render can't continue without
+         * them. Async functions should therefore not depend on the order they run in
+         * @param executor - Resumes the coroutines of async functions, available to them through "getExecutor"
+         * @return The result, which points to a buffer that is reused by the next render
+         */
+        Task<ParseResult> renderAsync(Executor& executor) noexcept;
+
+        // Returns the executor of the render started by "renderAsync", or the executor used to wait for an async
+        // function called by any other render. nullptr outside of a call to an async function
+        Executor* getExecutor() noexcept;
+
+        /**
+         * @brief Saves the compiled template to a precompiled file, compiling it first if needed. Loading the file with
+         * "loadFromPrecompiled" skips compiling the template
+         * @return UTTE_INITIALISATION_RESULT_INVALID_FILE if the template doesn't compile or the file couldn't be written
+         */
+        InitialisationResult savePrecompiled(const utte_string& location) noexcept;
+
+        /**
+         * @brief Loads a template saved with "savePrecompiled". The file is mapped into memory and used as it is
+         * @param location - The location of the precompiled file
+         * @param templateLocation - The location of the template it was made from. The template is loaded like with
+         * "loadFromFile", and if the precompiled file is corrupt, from another version or was made from a different
+         * template, it is ignored and the template is compiled on the first render instead. If empty, only the
+         * precompiled file is loaded, in which case only "render" can be used
+         * @return UTTE_INITIALISATION_RESULT_INVALID_FILE if neither file could be loaded
+         */
+        InitialisationResult loadFromPrecompiled(const utte_string& location, const utte_string& templateLocation) noexcept;
+
+        /**
+         * @brief Loads a template through the PartialCache, like "include" loads partials, so that it's loaded and
+         * compiled once and then shared by every generator that loads it, for servers that render the same templates
+         * for many requests. Like a precompiled file loaded without its template, only "render" can be used
+         * @param path - The path of the template, passed to the loader of the PartialCache
+         * @return UTTE_INITIALISATION_RESULT_INVALID_FILE if the loader couldn't load the template
+         */
+        InitialisationResult loadFromCache(const utte_string& path) noexcept;
+
         Function& pushVariable(const Variable& var, const utte_string& name) noexcept;
         Function& pushFunction(const Function& f) noexcept;
 
@@ -58,6 +291,10 @@ namespace UTTE
 
         static Variable makeArray(const std::vector<utte_string>& arr) noexcept;
         static Variable makeMap(const utte_map<utte_string, utte_string>& map) noexcept;
+        // Makes a range of the integers from "start" up to, but not including, "stop", counting by "step"
+        static Variable makeRange(int64_t start, int64_t stop, int64_t step = 1) noexcept;
+        static Variable makeSequence(const Sequence& sequence) noexcept;
+        static Variable makeObject(const ObjectType& type, const void* object) noexcept;
 
         // Returns a reference to an array that will be garbage-collected when the generator's destructor is called.
         // This is useful for custom functions that want to return arrays without managing their own registry
@@ -65,79 +302,329 @@ namespace UTTE
         // Returns a reference to a map that will be garbage-collected when the generator's destructor is called
         // This is useful for custom functions that want to return arrays without managing their own registry
         utte_map<utte_string, utte_string>& requestMapWithGC() noexcept;
+        // Returns a reference to a sequence that will be garbage-collected when the generator's destructor is called
+        Sequence& requestSequenceWithGC() noexcept;
+        // Returns a reference to an object type that will be garbage-collected when the generator's destructor is called
+        ObjectType& requestObjectTypeWithGC() noexcept;
+
+        // Returns an array that is only needed for the current render, like the ones made by the "list" function. It is
+        // reused after "resetScratch" is called. Nested generators use the scratch containers of the outermost one
+        std::vector<utte_string>& requestScratchArray() noexcept;
+        // Returns a map that is only needed for the current render, like the ones made by the "dict" function
+        utte_map<utte_string, utte_string>& requestScratchMap() noexcept;
+
+        // Counts bytes stored in scratch containers against the limit set with "setScratchLimit". Returns false if the
+        // limit would be exceeded, in which case the function should fail with UTTE_PARSE_STATUS_OUT_OF_MEMORY
+        bool chargeScratch(size_t bytes) noexcept;
+
+        // Makes all scratch containers available for reuse in O(1) and resets the memory counted against the limit.
+        // Call it between renders, once nothing uses the containers of the previous render
+        void resetScratch() noexcept;
+
+        // Sets the number of bytes scratch containers may hold between calls to "resetScratch". 0 means no limit
+        void setScratchLimit(size_t bytes) noexcept;
+
+        /**
+         * @brief Sets how many results of pure functions are cached, see Function::bPure. Nested generators use the
+         * cache of the outermost one. Results are kept between renders until "clearMemo" or "reset" are called
+         * @param entries - The number of cached results, the least recently used result is evicted first. 0 disables
+         * caching. Defaults to 1024
+         * @param bPerRender - Clear the cache whenever "parse" or "render" start, for functions that are only pure
+         * for the duration of a render
+         */
+        void setMemoCapacity(size_t entries, bool bPerRender = false) noexcept;
+
+        // Removes all cached results of pure functions
+        void clearMemo() noexcept;
+
+        // Returns the hits, misses and evictions of the cache of pure functions since it was created or last reset
+        MemoStats getMemoStats() noexcept;
+
+        // Sets how deep expressions may be nested before rendering fails with UTTE_PARSE_STATUS_DEPTH_EXCEEDED. An
+        // expression stays open while the body of its function is rendered, so the expressions in that body are nested
+        // in it. "parse", "render" and compiled templates count the same way. Nested expressions are kept on the heap,
+        // but every body that "parse" renders inside another one, like the body of an "if" in the body of a "for", uses
+        // about 1.5KB of the thread's stack. The default of 128 fits in a 256KB stack. 0 means no limit
+        void setMaxDepth(size_t depth) noexcept;
 
+        // Sets whether "loadFromFile" and "loadFromString" check that the template is valid UTF-8, and whether they
+        // replace invalid bytes. Checking skips ASCII 16 bytes at a time. Bodies of functions are never checked again
+        void setUTF8Mode(UTF8Mode mode) noexcept;
+
+        /**
+         * @brief Limits the time, expressions, loop iterations and output of every render, so that a runaway template,
+         * like a nested loop over a huge map, fails with UTTE_PARSE_STATUS_BUDGET_EXCEEDED instead of tying up the
+         * thread. The budget starts when "parse", "render" or "renderAsync" of the outermost generator start, or when a
+         * Context is created for a compiled template. Nested generators count against the budget of the outermost one.
+         * The clock is read every 64 steps, and a function that doesn't return is not interrupted, so a render may run
+         * slightly past its deadline. After a render runs out of budget, "render" returns the output rendered up to
+         * that point, without the results of async functions that were still deferred, and "parse" leaves the template
+         * partially substituted, like after any other error
+         * @param budget - The limits, 0 means no limit. All limits are off by default
+         */
+        void setBudget(const RenderBudget& budget) noexcept;
+
+        /**
+         * @brief Makes the variables of a snapshot visible to this generator and the ones nested in it. They're looked up
+         * after the functions and variables of this generator, and before the ones of its parent, so variables pushed
+         * for a single render hide the ones of the snapshot. The generator keeps the snapshot alive until another one is
+         * set or the generator is reset. Setting the variables of a snapshot shadows them in this generator instead
+         * @param snapshot - Usually the current snapshot of a SnapshotSlot, loaded at the start of a render. nullptr
+         * removes the snapshot
+         */
+        void setSnapshot(std::shared_ptr<const Snapshot> snapshot) noexcept;
+
+        /**
+         * @brief Partially evaluates the loaded template against the variables and functions marked static, see
+         * Function::bStatic, compiling it first if needed. Static expressions are replaced with their result, branches
+         * of "if", "cond" and "switch" that only depend on static values are pruned, and "for" loops over static arrays,
+         * maps, ranges and objects are unrolled. Load the residual template into a generator that is nested in this
+         * one, so that static arrays and maps that couldn't be substituted are still visible, bind the dynamic variables
+         * and render it as usual. The residual renders the same as the template, as long as the static values don't
+         * change
+         * @param residual - The residual template
+         * @return UTTE_PARSE_STATUS_SUCCESS, or the status of "compile" if the template doesn't compile
+         */
+        ParseResultStatus specialize(utte_string& residual) noexcept;
+
+        // Returns the functions and variables of this generator. For nested generators, this does not include the
+        // functions of the parent. Lookups are indexed by symbol, the index is rebuilt after calling this
         std::vector<Function>& getFunctionsRegistry() noexcept;
+
+        // Returns the function or variable with the given name, first searching this generator, then its parents
+        Function* findFunction(Symbol symbol) noexcept;
+        Function* findFunction(utte_string_view name) noexcept;
     private:
         friend class CoreFuncs;
+        friend class Compiler;
+        friend class VM;
+        friend class Context;
+        friend class Specializer;
+        friend struct Function;
+
+        // An argument of a function expression, see parseFunction
+        struct ArgumentSlice
+        {
+            static constexpr size_t npos = static_cast<size_t>(-1);
+
+            size_t begin = 0;
+            size_t size = 0;
+            // Index into the results of nested expressions, or npos if the argument was cut from the template
+            size_t result = npos;
+        };
+
+        // An expression that is being parsed, see parseFunction
+        struct ParseFrame
+        {
+            size_t beginCut = 0;
+            // The position of the nested expression that is being parsed
+            size_t locationBeforeAppend = 0;
+            bool bWasSpace = true;
+            // Results of nested expressions replace them in the template, instead of being removed
+            bool bRoot = false;
+
+            std::vector<ArgumentSlice> args;
+            std::vector<Variable> results;
+            ParseResult result{};
+        };
 
         static UTTE::ParseResult parseFunction(Generator& generator, size_t& i, bool bRoot = false) noexcept;
+        static bool isSpace(char c) noexcept;
+
+        // Checks if a function is one of the builtin functions, and was not replaced
+        static bool isBuiltin(const Function& f) noexcept;
+
+        // Returns the function with the given name in this scope, shadowing it if it's in a parent scope, so that it can
+        // be modified without affecting the parent. Returns nullptr if there's no such function
+        Function* findModifiable(const char* name) noexcept;
+
+        // Returns the function or variable with the given symbol in this scope only
+        Function* findLocal(Symbol symbol) noexcept;
 
         utte_string data;
+
+        // The compiled template and the buffer it's rendered to. The owner keeps the memory the program points to alive,
+        // which is either a Program or a mapped precompiled file. Both are dropped when a new template is loaded
+        std::shared_ptr<const void> programOwner;
+        ProgramView program;
+        utte_string output;
+
+        // The enclosing scope, used by the bodies of control flow functions. Lookups continue into it
+        Generator* parent = nullptr;
+
+        // Positions of the functions of this scope by symbol, plus 1, or 0 if there's no function with the symbol. Only
+        // used once a scope has enough functions for a linear search to be slower. Covers the first "indexed" functions,
+        // and is checked on every hit, so an outdated entry only makes a lookup fall back to a linear search
+        static constexpr size_t indexThreshold = 32;
+        std::vector<uint32_t> index;
+        size_t indexed = 0;
+
+        // Names of variables aren't interned, since they may come from requests and the symbol table never shrinks.
+        // Functions without a symbol are given one once their name is interned, which is checked whenever the size of
+        // the table changed since "resolvedSymbols". The members are further down, where they fit in padding
+        void resolve() noexcept;
+
         std::vector<Function> functions =
         {
             {
                 .name = "func",
-                .function = UTTE::CoreFuncs::funcFunc,
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcFunc>,
+                .symbol = UTTE_SYMBOL_FUNC,
+                .viewFunction = UTTE::CoreFuncs::funcFunc,
             },
             {
                 .name = "raw",
-                .function = UTTE::CoreFuncs::funcRaw
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcRaw>,
+                .symbol = UTTE_SYMBOL_RAW,
+                .viewFunction = UTTE::CoreFuncs::funcRaw,
             },
             {
                 .name = "comment",
-                .function = UTTE::CoreFuncs::funcComment
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcComment>,
+                .symbol = UTTE_SYMBOL_COMMENT,
+                .viewFunction = UTTE::CoreFuncs::funcComment,
             },
             {
                 .name = "if",
-                .function = UTTE::CoreFuncs::funcIf,
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcIf>,
+                .symbol = UTTE_SYMBOL_IF,
+                .viewFunction = UTTE::CoreFuncs::funcIf,
             },
             {
                 .name = "switch",
-                .function = UTTE::CoreFuncs::funcSwitch,
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcSwitch>,
+                .symbol = UTTE_SYMBOL_SWITCH,
+                .viewFunction = UTTE::CoreFuncs::funcSwitch,
             },
             {
                 .name = "at",
-                .function = UTTE::CoreFuncs::funcAt,
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcAt>,
+                .symbol = UTTE_SYMBOL_AT,
+                .viewFunction = UTTE::CoreFuncs::funcAt,
             },
             {
                 .name = "cond",
-                .function = UTTE::CoreFuncs::funcCond,
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcCond>,
+                .symbol = UTTE_SYMBOL_COND,
+                .viewFunction = UTTE::CoreFuncs::funcCond,
             },
             {
                 .name = "for",
-                .function = UTTE::CoreFuncs::funcFor,
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcFor>,
+                .symbol = UTTE_SYMBOL_FOR,
+                .viewFunction = UTTE::CoreFuncs::funcFor,
             },
             {
                 .name = "==",
-                .function = UTTE::CoreFuncs::funcBoolEqual,
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcBoolEqual>,
+                .symbol = UTTE_SYMBOL_BOOL_EQUAL,
+                .viewFunction = UTTE::CoreFuncs::funcBoolEqual,
             },
             {
                 .name = "!=",
-                .function = UTTE::CoreFuncs::funcBoolNotEqual,
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcBoolNotEqual>,
+                .symbol = UTTE_SYMBOL_BOOL_NOT_EQUAL,
+                .viewFunction = UTTE::CoreFuncs::funcBoolNotEqual,
             },
             {
                 .name = "!",
-                .function = UTTE::CoreFuncs::funcBoolNot,
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcBoolNot>,
+                .symbol = UTTE_SYMBOL_BOOL_NOT,
+                .viewFunction = UTTE::CoreFuncs::funcBoolNot,
             },
             {
                 .name = "&&",
-                .function = UTTE::CoreFuncs::funcBoolAnd,
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcBoolAnd>,
+                .symbol = UTTE_SYMBOL_BOOL_AND,
+                .viewFunction = UTTE::CoreFuncs::funcBoolAnd,
             },
             {
                 .name = "||",
-                .function = UTTE::CoreFuncs::funcBoolOr,
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcBoolOr>,
+                .symbol = UTTE_SYMBOL_BOOL_OR,
+                .viewFunction = UTTE::CoreFuncs::funcBoolOr,
             },
             {
                 .name = "list",
-                .function = UTTE::CoreFuncs::funcList
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcList>,
+                .symbol = UTTE_SYMBOL_LIST,
+                .viewFunction = UTTE::CoreFuncs::funcList,
             },
             {
                 .name = "dict",
-                .function = UTTE::CoreFuncs::funcDict
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcDict>,
+                .symbol = UTTE_SYMBOL_DICT,
+                .viewFunction = UTTE::CoreFuncs::funcDict,
+            },
+            {
+                .name = "include",
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcInclude>,
+                .symbol = UTTE_SYMBOL_INCLUDE,
+                .viewFunction = UTTE::CoreFuncs::funcInclude,
+            },
+            {
+                .name = "range",
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcRange>,
+                .symbol = UTTE_SYMBOL_RANGE,
+                .viewFunction = UTTE::CoreFuncs::funcRange,
+            },
+            {
+                .name = "length",
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcLength>,
+                .symbol = UTTE_SYMBOL_LENGTH,
+                .viewFunction = UTTE::CoreFuncs::funcLength,
+            },
+            {
+                .name = "slice",
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcSlice>,
+                .symbol = UTTE_SYMBOL_SLICE,
+                .viewFunction = UTTE::CoreFuncs::funcSlice,
+            },
+            {
+                .name = "join",
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcJoin>,
+                .symbol = UTTE_SYMBOL_JOIN,
+                .viewFunction = UTTE::CoreFuncs::funcJoin,
+            },
+            {
+                .name = "sort",
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcSort>,
+                .symbol = UTTE_SYMBOL_SORT,
+                .viewFunction = UTTE::CoreFuncs::funcSort,
+            },
+            {
+                .name = "reverse",
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcReverse>,
+                .symbol = UTTE_SYMBOL_REVERSE,
+                .viewFunction = UTTE::CoreFuncs::funcReverse,
+            },
+            {
+                .name = "keys",
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcKeys>,
+                .symbol = UTTE_SYMBOL_KEYS,
+                .viewFunction = UTTE::CoreFuncs::funcKeys,
+            },
+            {
+                .name = "values",
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcValues>,
+                .symbol = UTTE_SYMBOL_VALUES,
+                .viewFunction = UTTE::CoreFuncs::funcValues,
+            },
+            {
+                .name = "contains",
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcContains>,
+                .symbol = UTTE_SYMBOL_CONTAINS,
+                .viewFunction = UTTE::CoreFuncs::funcContains,
+            },
+            {
+                .name = "filter",
+                .function = UTTE::CoreFuncs::wrap<UTTE::CoreFuncs::funcFilter>,
+                .symbol = UTTE_SYMBOL_FILTER,
+                .viewFunction = UTTE::CoreFuncs::funcFilter,
             }
         };
 
-        // This array has pointers to the following functions: func, raw, comment. The common thing about them is that
+        // This array has the symbols of the following functions: func, raw, comment. The common thing about them is that
         // they preserve function expressions and don't execute them. For example a call like this:
         // {{ raw A b c {{ my-func }}
         // new line btw
@@ -149,14 +636,78 @@ namespace UTTE
         //
         // More information on how these functions are parsed can be found in the if-branch, responsible for cutting
         // arguments of function expressions
-        std::vector<size_t> specialFunctions{ 0, 1, 2 };
+        std::vector<Symbol> specialFunctions{ UTTE_SYMBOL_FUNC, UTTE_SYMBOL_RAW, UTTE_SYMBOL_COMMENT };
+
+        // Returns the outermost generator, which owns the scratch containers
+        Generator& root() noexcept;
 
-        // This is a vector containing vectors of strings that will be deallocated on the destruction of this class.
-        // This is here specifically for the "list" function to be able to garbage collect lists.
-        std::vector<std::vector<utte_string>> internalVectorsForList;
+        // Counts a level of nesting against the max depth of the outermost generator. Returns false if the limit is
+        // reached, in which case the caller fails with UTTE_PARSE_STATUS_DEPTH_EXCEEDED
+        bool descend() noexcept;
+        void ascend() noexcept;
 
-        // This is a vector containing dictionaries that will be deallocated on the destruction of this class.
-        // This is here specifically for the "dict" function to be able to garbage collect maps.
-        std::vector<utte_map<utte_string, utte_string>> internalMapsForDict;
+        // Starts the budget of a render, if this is the outermost generator
+        void startBudget() noexcept;
+
+        // Counts expressions and iterations against the budget of the outermost generator, and checks the size of the
+        // text that is being rendered and the deadline. Returns false if any limit is exceeded, in which case the caller
+        // fails with UTTE_PARSE_STATUS_BUDGET_EXCEEDED
+        bool charge(size_t expressions, size_t iterations, size_t outputSize) noexcept;
+
+        // Containers returned by the "request...WithGC" functions, deallocated on the destruction of this class. Arenas
+        // keep their addresses stable, so the pointers encoded in variables stay valid
+        Arena<std::vector<utte_string>> arrays;
+        Arena<utte_map<utte_string, utte_string>> maps;
+        Arena<Sequence> sequences;
+        Arena<ObjectType> objectTypes;
+
+        // Containers made while rendering, for example by the "list" and "dict" functions. These are reused after
+        // "resetScratch" is called
+        Arena<std::vector<utte_string>> scratchArrays;
+        Arena<utte_map<utte_string, utte_string>> scratchMaps;
+        size_t scratchBytes = 0;
+        size_t scratchLimit = 0;
+
+        // The executor of the current async render, owned by the outermost generator
+        Executor* executor = nullptr;
+
+        // The current nesting of expressions and bodies, and its limit, owned by the outermost generator
+        size_t depth = 0;
+        size_t maxDepth = 128;
+
+        UTF8Mode utf8Mode = UTTE_UTF8_MODE_NONE;
+
+        // The budget of every render, what the current render spent of it, and when it runs out. Owned by the
+        // outermost generator
+        RenderBudget budget{};
+        RenderBudget spent{};
+        bool bBudgeted = false;
+
+        // See "resolve"
+        bool bUnresolved = false;
+        uint32_t resolvedSymbols = 0;
+
+        size_t steps = 0;
+        std::chrono::steady_clock::time_point deadline;
+
+        // Checks the loaded template according to "utf8Mode"
+        InitialisationResult checkUTF8() noexcept;
+
+        // Shared, immutable variables, see "setSnapshot"
+        std::shared_ptr<const Snapshot> snapshot;
+
+        // The cached results of pure functions, owned by the outermost generator and created on first use
+        std::shared_ptr<MemoCache> memo;
+        MemoCache& getMemo() noexcept;
     };
+}
+
+template<UTTE::Variable(*F)(std::vector<UTTE::VariableView>&, UTTE::Generator*)>
+UTTE::Variable UTTE::CoreFuncs::wrap(std::vector<Variable>& args, UTTE::Generator* generator) noexcept
+{
+    std::vector<VariableView> views;
+    views.reserve(args.size());
+    for (auto& a : args)
+        views.push_back({ .value = utte_string_view(a.value.data(), a.value.size()), .type = a.type, .status = a.status });
+    return F(views, generator);
 }
\ No newline at end of file
@@ -0,0 +1,47 @@
+#include "GeneratorPool.hpp"
+#include <algorithm>
+
+void UTTE::GeneratorPool::Releaser::operator()(UTTE::Generator* generator) const noexcept
+{
+    pool->release(generator);
+}
+
+UTTE::GeneratorPool::GeneratorPool(size_t maxIdle) noexcept : maxIdle(maxIdle)
+{
+}
+
+UTTE::GeneratorPool::Handle UTTE::GeneratorPool::acquire() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!idle.empty())
+        {
+            Handle result(idle.back().release(), Releaser{ .pool = this });
+            idle.pop_back();
+            return result;
+        }
+    }
+    return Handle(new Generator, Releaser{ .pool = this });
+}
+
+void UTTE::GeneratorPool::release(UTTE::Generator* generator) noexcept
+{
+    if (generator == nullptr)
+        return;
+
+    // Reset outside the lock, it can deallocate a lot of memory
+    std::unique_ptr<Generator> owned(generator);
+    owned->reset();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (idle.size() < maxIdle)
+        idle.push_back(std::move(owned));
+}
+
+void UTTE::GeneratorPool::reserve(size_t count) noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    count = std::min(count, maxIdle);
+    while (idle.size() < count)
+        idle.push_back(std::make_unique<Generator>());
+}
\ No newline at end of file
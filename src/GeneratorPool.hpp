@@ -0,0 +1,40 @@
+#pragma once
+#include "Generator.hpp"
+#include <mutex>
+
+namespace UTTE
+{
+    /**
+     * @brief A thread-safe pool of generators, for programs that render with a new generator every time, like servers
+     * rendering one template per request. Generators are reset when they are returned, so constructing and destroying
+     * the builtin functions is only done when the pool is empty. The pool has to outlive all generators acquired from it
+     */
+    class MLS_PUBLIC_API GeneratorPool
+    {
+    public:
+        // Returns a generator to its pool when the handle is destroyed
+        struct MLS_PUBLIC_API Releaser
+        {
+            void operator()(Generator* generator) const noexcept;
+
+            GeneratorPool* pool = nullptr;
+        };
+        typedef std::unique_ptr<Generator, Releaser> Handle;
+
+        // At most "maxIdle" generators are kept in the pool, any other returned generators are destroyed
+        explicit GeneratorPool(size_t maxIdle = 64) noexcept;
+
+        // Returns a generator in the same state as a newly constructed one, with the default settings
+        Handle acquire() noexcept;
+
+        // Resets a generator and returns it to the pool. Only needed for generators taken out of a handle with "release"
+        void release(Generator* generator) noexcept;
+
+        // Constructs generators ahead of time, until the pool holds "count" of them or is full
+        void reserve(size_t count) noexcept;
+    private:
+        std::mutex mutex;
+        std::vector<std::unique_ptr<Generator>> idle;
+        size_t maxIdle;
+    };
+}
\ No newline at end of file
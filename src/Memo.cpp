@@ -0,0 +1,88 @@
+#include "Memo.hpp"
+
+const UTTE::Variable* UTTE::MemoCache::find(UTTE::Symbol symbol, const std::vector<VariableView>& args, utte_string& key) noexcept
+{
+    key.clear();
+    if (capacity == 0 || symbol == UTTE_SYMBOL_INVALID)
+        return nullptr;
+
+    // The key is the symbol followed by the size and value of every argument, so that arguments can't run into each
+    // other
+    lookup.assign(reinterpret_cast<const char*>(&symbol), sizeof(symbol));
+    for (auto& a : args)
+    {
+        if (a.type != UTTE_VARIABLE_TYPE_HINT_NORMAL)
+            return nullptr;
+
+        uint32_t size = static_cast<uint32_t>(a.value.size());
+        lookup.append(reinterpret_cast<const char*>(&size), sizeof(size));
+        lookup.append(a.value.data(), a.value.size());
+    }
+
+    auto it = index.find(std::string_view(lookup.data(), lookup.size()));
+    if (it == index.end())
+    {
+        ++stats.misses;
+        key = lookup;
+        return nullptr;
+    }
+
+    ++stats.hits;
+    entries.splice(entries.begin(), entries, it->second);
+    return &it->second->result;
+}
+
+void UTTE::MemoCache::insert(utte_string&& key, const UTTE::Variable& result) noexcept
+{
+    if (key.empty() || capacity == 0 || result.status != UTTE_PARSE_STATUS_SUCCESS || result.type != UTTE_VARIABLE_TYPE_HINT_NORMAL)
+        return;
+
+    // A pure function may call itself with the same arguments through a body, in which case the inner call is cached
+    // first
+    if (index.contains(std::string_view(key.data(), key.size())))
+        return;
+
+    if (entries.size() >= capacity)
+        evict();
+
+    entries.push_front({ .key = std::move(key), .result = result });
+    index.emplace(std::string_view(entries.front().key.data(), entries.front().key.size()), entries.begin());
+    stats.size = entries.size();
+}
+
+void UTTE::MemoCache::clear() noexcept
+{
+    index.clear();
+    entries.clear();
+    stats.size = 0;
+}
+
+void UTTE::MemoCache::setCapacity(size_t count) noexcept
+{
+    capacity = count;
+    while (entries.size() > capacity)
+        evict();
+}
+
+size_t UTTE::MemoCache::getCapacity() const noexcept
+{
+    return capacity;
+}
+
+UTTE::MemoStats UTTE::MemoCache::getStats() const noexcept
+{
+    return stats;
+}
+
+void UTTE::MemoCache::resetStats() noexcept
+{
+    stats = { .size = entries.size() };
+}
+
+void UTTE::MemoCache::evict() noexcept
+{
+    index.erase(std::string_view(entries.back().key.data(), entries.back().key.size()));
+    entries.pop_back();
+    ++stats.evictions;
+    stats.size = entries.size();
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#pragma once
+#include "Generator.hpp"
+#include <list>
+#include <string_view>
+#include <unordered_map>
+
+namespace UTTE
+{
+    /**
+     * @brief A bounded LRU cache of the results of pure functions, see Function::bPure. A call is identified by the
+     * symbol of the function and the values of its arguments. Only calls whose arguments and result are normal strings
+     * are cached, since arrays and maps are passed by address, and bodies of functions depend on the scope they're
+     * rendered in. Owned by the outermost generator, so it is not thread-safe
+     */
+    class MLS_PUBLIC_API MemoCache
+    {
+    public:
+        /**
+         * @brief Looks up a call
+         * @param key - Set to the key of the call on a miss, so that the result can be inserted once the function
+         * returns. Left empty if the call can't be cached
+         * @return The cached result, or nullptr on a miss
+         */
+        const Variable* find(Symbol symbol, const std::vector<VariableView>& args, utte_string& key) noexcept;
+
+        // Caches the result of a call that missed, evicting the least recently used result if the cache is full
+        void insert(utte_string&& key, const Variable& result) noexcept;
+
+        // Removes all cached results. The statistics are kept
+        void clear() noexcept;
+
+        // Sets how many results are cached, evicting results if there are more. 0 disables caching
+        void setCapacity(size_t entries) noexcept;
+        size_t getCapacity() const noexcept;
+
+        MemoStats getStats() const noexcept;
+        void resetStats() noexcept;
+
+        // Whether "parse" and "render" clear the cache when they start
+        bool bPerRender = false;
+    private:
+        struct Entry
+        {
+            utte_string key;
+            Variable result;
+        };
+
+        void evict() noexcept;
+
+        // The most recently used entry is first. Nodes of a list don't move, so the index can view their keys
+        std::list<Entry> entries;
+        std::unordered_map<std::string_view, std::list<Entry>::iterator> index;
+
+        // Reused to build the key of every lookup, so that hits don't allocate
+        utte_string lookup;
+
+        size_t capacity = 1024;
+        MemoStats stats{};
+    };
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#include "PartialCache.hpp"
+#include <fstream>
+
+// Where "get" appends the paths requested on this thread, see "record"
+static thread_local std::vector<utte_string>* recording = nullptr;
+
+std::shared_ptr<const UTTE::Partial> UTTE::PartialCache::get(const utte_string& path) noexcept
+{
+    if (recording != nullptr)
+        recording->push_back(path);
+
+    auto& cache = instance();
+    std::function<IncludeLoader> loader;
+    uint64_t generation = 0;
+    {
+        std::shared_lock<std::shared_mutex> lock(cache.mutex);
+        auto it = cache.partials.find(path);
+        if (it != cache.partials.end())
+            return it->second;
+        loader = cache.loader;
+        generation = cache.generation;
+    }
+
+    // The loader may be slow, like a read from disk, so the partial is loaded and compiled without the lock, and
+    // requests for other partials aren't blocked
+    auto partial = std::make_shared<Partial>();
+    if (!loader(path, partial->source))
+        return nullptr;
+    partial->status = Compiler::compile(partial->source, partial->program);
+    partial->view = partial->program.view();
+
+    std::unique_lock<std::shared_mutex> lock(cache.mutex);
+
+    // Another thread may have loaded the partial in the meantime, in which case everyone shares its copy
+    auto it = cache.partials.find(path);
+    if (it != cache.partials.end())
+        return it->second;
+
+    // The cache was cleared or the loader changed while loading, so this copy may be stale and is only used once
+    if (generation == cache.generation)
+        cache.partials.insert({ path, partial });
+    return partial;
+}
+
+void UTTE::PartialCache::setLoader(const std::function<IncludeLoader>& loader) noexcept
+{
+    auto& cache = instance();
+    std::unique_lock<std::shared_mutex> lock(cache.mutex);
+
+    cache.loader = loader;
+    cache.partials.clear();
+    ++cache.generation;
+}
+
+std::function<UTTE::IncludeLoader> UTTE::PartialCache::getLoader() noexcept
+{
+    auto& cache = instance();
+    std::shared_lock<std::shared_mutex> lock(cache.mutex);
+    return cache.loader;
+}
+
+void UTTE::PartialCache::clear() noexcept
+{
+    auto& cache = instance();
+    std::unique_lock<std::shared_mutex> lock(cache.mutex);
+    cache.partials.clear();
+    ++cache.generation;
+}
+
+void UTTE::PartialCache::invalidate(const utte_string& path) noexcept
+{
+    auto& cache = instance();
+    std::unique_lock<std::shared_mutex> lock(cache.mutex);
+    cache.partials.erase(path);
+    ++cache.generation;
+}
+
+void UTTE::PartialCache::record(std::vector<utte_string>* paths) noexcept
+{
+    recording = paths;
+}
+
+bool UTTE::PartialCache::loadFile(const utte_string& path, utte_string& out) noexcept
+{
+    std::ifstream in(path);
+    if (!in)
+        return false;
+    in.seekg(0, std::ios::end);
+    size_t size = in.tellg();
+    out.resize(size);
+
+    in.seekg(0);
+    in.read(out.data(), static_cast<std::streamsize>(size));
+    in.close();
+    return true;
+}
+
+UTTE::PartialCache& UTTE::PartialCache::instance() noexcept
+{
+    static PartialCache cache;
+    return cache;
+}
\ No newline at end of file
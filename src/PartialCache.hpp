@@ -0,0 +1,68 @@
+#pragma once
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <functional>
+#include "Compiler.hpp"
+
+namespace UTTE
+{
+    /**
+     * @brief A loader receives the path given to the "include" function and writes the contents of the partial into
+     * "out". Returns false if the partial could not be found, in which case "include" fails with
+     * UTTE_PARSE_STATUS_INVALID_VALUE
+     */
+    using IncludeLoader = bool(const utte_string& path, utte_string& out);
+
+    // A partial template, loaded and compiled once and shared between all generators in the process
+    struct MLS_PUBLIC_API Partial
+    {
+        utte_string source;
+
+        // The compiled partial, which the VM runs for every include, also when parsing
+        Program program;
+        ProgramView view;
+        ParseResultStatus status = UTTE_PARSE_STATUS_SUCCESS;
+    };
+
+    /**
+     * @brief A process-wide cache of partial templates, used by the "include" function. Every partial is loaded
+     * through the loader once and then shared by all generators, until the cache is cleared or the loader is changed.
+     * All members are thread-safe.
+     */
+    class MLS_PUBLIC_API PartialCache
+    {
+    public:
+        // Returns the partial for the given path, loading it on the first request. Returns nullptr if the loader failed
+        static std::shared_ptr<const Partial> get(const utte_string& path) noexcept;
+
+        // Sets a new loader. This clears the cache, since the old partials may no longer be valid for the new loader
+        static void setLoader(const std::function<IncludeLoader>& loader) noexcept;
+
+        // Returns the current loader, so that it can be set again once a temporary one is no longer needed
+        static std::function<IncludeLoader> getLoader() noexcept;
+
+        // Clears all cached partials. Partials currently in use by a generator stay alive until it is done with them
+        static void clear() noexcept;
+
+        // Removes one partial, so that it's loaded and compiled again on the next request, for example after its file
+        // changed. Like with "clear", generators that use it keep it alive
+        static void invalidate(const utte_string& path) noexcept;
+
+        // Appends the path of every partial requested on the calling thread to "paths", including partials included by
+        // other partials, until it's called with nullptr. Used to find the partials a render depends on
+        static void record(std::vector<utte_string>* paths) noexcept;
+
+        // The default loader, treats the path as a file path
+        static bool loadFile(const utte_string& path, utte_string& out) noexcept;
+    private:
+        static PartialCache& instance() noexcept;
+
+        std::shared_mutex mutex;
+        std::function<IncludeLoader> loader = loadFile;
+        utte_map<utte_string, std::shared_ptr<const Partial>> partials;
+
+        // Changed by every clear, invalidation and new loader, so that partials loaded before one aren't cached
+        uint64_t generation = 0;
+    };
+}
\ No newline at end of file
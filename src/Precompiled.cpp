@@ -0,0 +1,245 @@
+#include "Precompiled.hpp"
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#define UTTE_PRECOMPILED_BYTE_ORDER 0x01020304
+#define UTTE_PRECOMPILED_ALIGN(x) (((x) + 7) & ~static_cast<size_t>(7))
+
+bool UTTE::Precompiled::save(const UTTE::ProgramView& program, utte_string_view source, const utte_string& location) noexcept
+{
+    Header header{};
+    std::memcpy(header.magic, "UTTE", 4);
+    header.version = version;
+    header.byteOrder = UTTE_PRECOMPILED_BYTE_ORDER;
+    header.instructionSize = sizeof(Instruction);
+    header.sourceSize = source.size();
+    header.sourceHash = hash(source.data(), source.size());
+
+    // Lay out the sections one after another
+    size_t offset = UTTE_PRECOMPILED_ALIGN(sizeof(Header));
+    const auto section = [&](uint32_t& sectionOffset, size_t sectionSize) -> void
+    {
+        sectionOffset = static_cast<uint32_t>(offset);
+        offset = UTTE_PRECOMPILED_ALIGN(offset + sectionSize);
+    };
+    section(header.codeOffset, program.codeSize * sizeof(Instruction));
+    section(header.literalsOffset, program.literalCount * sizeof(Literal));
+    section(header.namesOffset, program.symbolCount * sizeof(uint32_t));
+    section(header.stringsOffset, program.stringsSize);
+    header.codeSize = program.codeSize;
+    header.literalCount = program.literalCount;
+    header.nameCount = program.symbolCount;
+    header.stringsSize = program.stringsSize;
+
+    // Instructions are copied field by field, so that their padding is zeroed and the same program always gives the same file
+    std::vector<char> file(offset);
+    for (uint32_t i = 0; i < program.codeSize; i++)
+    {
+        char* instruction = file.data() + header.codeOffset + i * sizeof(Instruction);
+        std::memcpy(instruction + offsetof(Instruction, op), &program.code[i].op, sizeof(Instruction::op));
+        std::memcpy(instruction + offsetof(Instruction, a), &program.code[i].a, sizeof(Instruction::a));
+        std::memcpy(instruction + offsetof(Instruction, b), &program.code[i].b, sizeof(Instruction::b));
+    }
+    std::memcpy(file.data() + header.literalsOffset, program.literals, program.literalCount * sizeof(Literal));
+    std::memcpy(file.data() + header.namesOffset, program.names, program.symbolCount * sizeof(uint32_t));
+    std::memcpy(file.data() + header.stringsOffset, program.strings, program.stringsSize);
+
+    header.checksum = hash(file.data() + sizeof(Header), file.size() - sizeof(Header));
+    std::memcpy(file.data(), &header, sizeof(Header));
+
+    std::ofstream out(location, std::ios::binary | std::ios::trunc);
+    if (!out)
+        return false;
+    out.write(file.data(), static_cast<std::streamsize>(file.size()));
+    return static_cast<bool>(out);
+}
+
+std::shared_ptr<const UTTE::Precompiled> UTTE::Precompiled::load(const utte_string& location, const utte_string* source) noexcept
+{
+    auto result = std::make_shared<Precompiled>();
+#ifdef _WIN32
+    HANDLE file = CreateFileA(location.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    LARGE_INTEGER fileSize{};
+    HANDLE map = nullptr;
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart >= static_cast<LONGLONG>(sizeof(Header)))
+        map = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (map == nullptr)
+        return nullptr;
+
+    // The view keeps the mapping alive, so the handle can be closed right away
+    result->mapping = MapViewOfFile(map, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(map);
+    if (result->mapping == nullptr)
+        return nullptr;
+    result->size = static_cast<size_t>(fileSize.QuadPart);
+#else
+    int fd = open(location.c_str(), O_RDONLY);
+    if (fd < 0)
+        return nullptr;
+
+    struct stat st{};
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(Header)))
+    {
+        close(fd);
+        return nullptr;
+    }
+
+    // The whole file is read right away to check the checksum, so there's no point in faulting the pages in one by one
+    int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+    flags |= MAP_POPULATE;
+#endif
+    void* mapping = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, flags, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED)
+        return nullptr;
+    result->mapping = mapping;
+    result->size = static_cast<size_t>(st.st_size);
+#endif
+
+    const char* data = static_cast<const char*>(result->mapping);
+    Header header{};
+    std::memcpy(&header, data, sizeof(Header));
+
+    if (std::memcmp(header.magic, "UTTE", 4) != 0 || header.version != version || header.byteOrder != UTTE_PRECOMPILED_BYTE_ORDER
+        || header.instructionSize != sizeof(Instruction))
+        return nullptr;
+    if (source != nullptr && (header.sourceSize != source->size() || header.sourceHash != hash(source->data(), source->size())))
+        return nullptr;
+    if (header.checksum != hash(data + sizeof(Header), result->size - sizeof(Header)) || !result->validate(header))
+        return nullptr;
+
+    // Symbols are only valid in the current process, so the names are interned again. This is the only part of the
+    // program that is not used straight from the file
+    result->symbols.reserve(header.nameCount);
+    for (uint32_t i = 0; i < header.nameCount; i++)
+        result->symbols.push_back(SymbolTable::intern(result->program.literal(result->program.names[i])));
+    result->program.symbols = result->symbols.data();
+    return result;
+}
+
+const UTTE::ProgramView& UTTE::Precompiled::view() const noexcept
+{
+    return program;
+}
+
+UTTE::Precompiled::~Precompiled() noexcept
+{
+    if (mapping == nullptr)
+        return;
+#ifdef _WIN32
+    UnmapViewOfFile(mapping);
+#else
+    munmap(mapping, size);
+#endif
+}
+
+uint64_t UTTE::Precompiled::hash(const char* data, size_t size) noexcept
+{
+    // FNV-1a over 8 bytes at a time, followed by the remaining bytes. The checksum is computed on every load, so hashing
+    // byte by byte would be one of the slowest parts of loading
+    uint64_t result = 14695981039346656037ull;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        result ^= word;
+        result *= 1099511628211ull;
+        result ^= result >> 32;
+    }
+    for (; i < size; i++)
+    {
+        result ^= static_cast<unsigned char>(data[i]);
+        result *= 1099511628211ull;
+    }
+    return result;
+}
+
+bool UTTE::Precompiled::validate(const UTTE::Precompiled::Header& header) noexcept
+{
+    const auto inBounds = [&](uint32_t offset, uint64_t sectionSize) -> bool
+    {
+        return offset % 8 == 0 && offset >= sizeof(Header) && offset <= size && sectionSize <= size - offset;
+    };
+    if (!inBounds(header.codeOffset, static_cast<uint64_t>(header.codeSize) * sizeof(Instruction))
+        || !inBounds(header.literalsOffset, static_cast<uint64_t>(header.literalCount) * sizeof(Literal))
+        || !inBounds(header.namesOffset, static_cast<uint64_t>(header.nameCount) * sizeof(uint32_t))
+        || !inBounds(header.stringsOffset, header.stringsSize))
+        return false;
+
+    const char* data = static_cast<const char*>(mapping);
+    program =
+    {
+        .code = reinterpret_cast<const Instruction*>(data + header.codeOffset),
+        .literals = reinterpret_cast<const Literal*>(data + header.literalsOffset),
+        .strings = data + header.stringsOffset,
+        .names = reinterpret_cast<const uint32_t*>(data + header.namesOffset),
+        .codeSize = header.codeSize,
+        .literalCount = header.literalCount,
+        .stringsSize = header.stringsSize,
+        .symbolCount = header.nameCount,
+    };
+
+    for (uint32_t i = 0; i < program.literalCount; i++)
+        if (program.literals[i].offset > program.stringsSize || program.literals[i].size > program.stringsSize - program.literals[i].offset)
+            return false;
+    for (uint32_t i = 0; i < program.symbolCount; i++)
+        if (program.names[i] >= program.literalCount)
+            return false;
+
+    // Every body runs until a RETURN, so the code has to end with one. Every call also needs a frame in the same body
+    if (program.codeSize == 0 || program.code[program.codeSize - 1].op != UTTE_OP_RETURN)
+        return false;
+    size_t frames = 0;
+    for (uint32_t i = 0; i < program.codeSize; i++)
+    {
+        auto& instruction = program.code[i];
+        switch (instruction.op)
+        {
+        case UTTE_OP_TEXT:
+        case UTTE_OP_PUSH:
+            if (instruction.a >= program.literalCount)
+                return false;
+            break;
+        case UTTE_OP_PUSH_BODY:
+            if (instruction.a >= program.literalCount || instruction.b == 0 || instruction.b >= program.codeSize
+                || program.code[instruction.b - 1].op != UTTE_OP_RETURN)
+                return false;
+            break;
+        case UTTE_OP_FRAME:
+            ++frames;
+            break;
+        case UTTE_OP_CALL:
+            if (instruction.a >= program.symbolCount)
+                return false;
+            [[fallthrough]];
+        case UTTE_OP_CALL_DYNAMIC:
+            if (frames == 0)
+                return false;
+            --frames;
+            break;
+        case UTTE_OP_RETURN:
+            if (frames != 0)
+                return false;
+            break;
+        default:
+            return false;
+        }
+    }
+    return true;
+}
\ No newline at end of file
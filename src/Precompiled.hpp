@@ -0,0 +1,81 @@
+#pragma once
+#include "Program.hpp"
+#include <memory>
+
+namespace UTTE
+{
+    /**
+     * @brief A compiled template saved to a file. The file stores the code, literals and names of the called functions
+     * in the layout of a ProgramView, so loading it is a single mmap, followed by checking its checksum and interning
+     * the names of the functions. The file is only valid for builds with the same version of the bytecode and the same
+     * byte order.
+     */
+    class MLS_PUBLIC_API Precompiled
+    {
+    public:
+        /**
+         * @brief Saves a program to a file
+         * @param program - The program to save
+         * @param source - The template the program was compiled from, used to detect stale files when loading
+         * @param location - The location of the file
+         * @return false if the file couldn't be written
+         */
+        static bool save(const ProgramView& program, utte_string_view source, const utte_string& location) noexcept;
+
+        /**
+         * @brief Maps a precompiled file
+         * @param location - The location of the file
+         * @param source - The current contents of the template, or nullptr to skip checking if the file is stale
+         * @return The loaded file, or nullptr if it's missing, corrupt, stale or from another version
+         */
+        static std::shared_ptr<const Precompiled> load(const utte_string& location, const utte_string* source) noexcept;
+
+        // The program stored in the file, valid as long as this object is
+        const ProgramView& view() const noexcept;
+
+        Precompiled() noexcept = default;
+        Precompiled(const Precompiled&) = delete;
+        Precompiled& operator=(const Precompiled&) = delete;
+        ~Precompiled() noexcept;
+    private:
+        // Increment when the layout of the file or the meaning of the bytecode changes
+        static constexpr uint32_t version = 1;
+
+        // Stored at the start of the file. Offsets are from the start of the file and aligned to 8 bytes
+        struct Header
+        {
+            char magic[4];
+            uint32_t version;
+            uint32_t byteOrder;
+            uint32_t instructionSize;
+
+            uint64_t sourceSize;
+            uint64_t sourceHash;
+
+            // The checksum of everything after the header
+            uint64_t checksum;
+
+            uint32_t codeOffset;
+            uint32_t codeSize;
+            uint32_t literalsOffset;
+            uint32_t literalCount;
+            uint32_t stringsOffset;
+            uint32_t stringsSize;
+            uint32_t namesOffset;
+            uint32_t nameCount;
+        };
+
+        // A 64-bit FNV-1a variant that hashes 8 bytes at a time
+        static uint64_t hash(const char* data, size_t size) noexcept;
+
+        // Checks that every offset, size and operand in the file is in range, so that a file with a valid checksum but
+        // bad contents can't make the VM read out of bounds
+        bool validate(const Header& header) noexcept;
+
+        void* mapping = nullptr;
+        size_t size = 0;
+
+        std::vector<Symbol> symbols;
+        ProgramView program;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+#pragma once
+#include "Symbol.hpp"
+
+namespace UTTE
+{
+    /**
+     * @brief The operations of the bytecode VM. Every expression is compiled to a frame, followed by the code that pushes
+     * its arguments and a call, so an expression like {{ at {{ arr }} 0 }} becomes:
+     * FRAME, PUSH "at", FRAME, PUSH "arr", CALL arr, PUSH "0", CALL at
+     * @enum UTTE_OP_TEXT - Appends the literal "a" to the output
+     * @enum UTTE_OP_FRAME - Starts the arguments of a new expression
+     * @enum UTTE_OP_PUSH - Pushes the literal "a" as an argument
+     * @enum UTTE_OP_PUSH_BODY - Pushes the literal "a" as an argument. The literal is the body of a "func" expression,
+     * which is compiled to the code starting at "b". Control flow functions run that code instead of parsing the body
+     * @enum UTTE_OP_CALL - Calls the function with the symbol at index "a" of the program's symbol table, with the
+     * arguments of the current frame. If "b" has UTTE_CALL_FLAG_EMIT set, the result is appended to the output,
+     * otherwise it's pushed as an argument
+     * @enum UTTE_OP_CALL_DYNAMIC - Like UTTE_OP_CALL, but the name of the function is the first argument, since it is
+     * the result of an expression. Expressions without arguments are compiled to this as well
+     * @enum UTTE_OP_RETURN - Ends the program or the body of a function
+     */
+    enum OpCode : uint8_t
+    {
+        UTTE_OP_TEXT,
+        UTTE_OP_FRAME,
+        UTTE_OP_PUSH,
+        UTTE_OP_PUSH_BODY,
+        UTTE_OP_CALL,
+        UTTE_OP_CALL_DYNAMIC,
+        UTTE_OP_RETURN,
+        UTTE_OP_COUNT,
+    };
+
+    enum CallFlags : uint32_t
+    {
+        UTTE_CALL_FLAG_EMIT = 1,
+    };
+
+    struct MLS_PUBLIC_API Instruction
+    {
+        OpCode op;
+        uint32_t a;
+        uint32_t b;
+    };
+
+    struct MLS_PUBLIC_API Literal
+    {
+        uint32_t offset;
+        uint32_t size;
+    };
+
+    /**
+     * @brief A read-only view of a compiled template. The VM only runs views, so a program can live either in a Program
+     * or in a mapped precompiled file
+     */
+    struct MLS_PUBLIC_API ProgramView
+    {
+        utte_string_view literal(uint32_t index) const noexcept
+        {
+            return { strings + literals[index].offset, literals[index].size };
+        }
+
+        const Instruction* code = nullptr;
+        const Literal* literals = nullptr;
+        const char* strings = nullptr;
+
+        // Indexed by the "a" operand of UTTE_OP_CALL, along with the literals of the names of the symbols
+        const Symbol* symbols = nullptr;
+        const uint32_t* names = nullptr;
+
+        uint32_t codeSize = 0;
+        uint32_t literalCount = 0;
+        uint32_t stringsSize = 0;
+        uint32_t symbolCount = 0;
+    };
+
+    /**
+     * @brief A template compiled to bytecode. The code of the template starts at index 0, followed by the bodies of
+     * all "func" expressions. All literals are stored in a single string
+     */
+    struct MLS_PUBLIC_API Program
+    {
+        utte_string_view literal(uint32_t index) const noexcept
+        {
+            return { strings.data() + literals[index].offset, literals[index].size };
+        }
+
+        // The view stays valid until the program is modified
+        ProgramView view() const noexcept
+        {
+            return
+            {
+                .code = code.data(),
+                .literals = literals.data(),
+                .strings = strings.data(),
+                .symbols = symbols.data(),
+                .names = names.data(),
+                .codeSize = static_cast<uint32_t>(code.size()),
+                .literalCount = static_cast<uint32_t>(literals.size()),
+                .stringsSize = static_cast<uint32_t>(strings.size()),
+                .symbolCount = static_cast<uint32_t>(symbols.size()),
+            };
+        }
+
+        std::vector<Instruction> code;
+        std::vector<Literal> literals;
+        utte_string strings;
+
+        // The functions called by the program. Symbols are only valid in the current process, so the literals with
+        // their names are kept as well
+        std::vector<Symbol> symbols;
+        std::vector<uint32_t> names;
+    };
+}
\ No newline at end of file
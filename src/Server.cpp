@@ -0,0 +1,723 @@
+#include "Server.hpp"
+#include "PartialCache.hpp"
+#include <bit>
+#include <chrono>
+#include <filesystem>
+#ifdef __linux__
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <sys/socket.h>
+    #include <sys/un.h>
+    #include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+// How long a worker waits for the rest of a request that started to arrive before it closes the connection
+static constexpr time_t requestTimeoutSeconds = 5;
+static constexpr uint32_t maxIdSize = 4096;
+
+// The histogram has exact buckets below 8 microseconds, and 8 buckets for every power of 2 above
+static size_t bucket(uint64_t microseconds) noexcept
+{
+    if (microseconds < 8)
+        return microseconds;
+    size_t exponent = 63 - std::countl_zero(microseconds);
+    return (exponent - 2) * 8 + ((microseconds >> (exponent - 3)) & 7);
+}
+
+// The largest latency that is counted in a bucket
+static uint64_t bucketLimit(size_t index) noexcept
+{
+    if (index < 8)
+        return index;
+    size_t exponent = index / 8 + 2;
+    uint64_t first = (8 + index % 8) << (exponent - 3);
+    return first + (uint64_t(1) << (exponent - 3)) - 1;
+}
+
+// The id of a template has to stay inside the directory of the templates
+static bool isValidId(const utte_string& id) noexcept
+{
+    if (id.empty() || id.find('\0') != utte_string::npos)
+        return false;
+    fs::path path(id);
+    if (path.is_absolute() || path.has_root_name())
+        return false;
+    for (const auto& a : path)
+        if (a == "..")
+            return false;
+    return true;
+}
+
+static void skipSpace(utte_string_view& json) noexcept
+{
+    while (!json.empty() && (json[0] == ' ' || json[0] == '\t' || json[0] == '\n' || json[0] == '\r'))
+        json.remove_prefix(1);
+}
+
+static bool readHex(utte_string_view& json, uint32_t& out) noexcept
+{
+    if (json.size() < 4)
+        return false;
+    out = 0;
+    for (size_t i = 0; i < 4; i++)
+    {
+        char c = json[i];
+        uint32_t digit = c >= '0' && c <= '9' ? c - '0' : c >= 'a' && c <= 'f' ? c - 'a' + 10 : c >= 'A' && c <= 'F' ? c - 'A' + 10 : 16;
+        if (digit == 16)
+            return false;
+        out = out * 16 + digit;
+    }
+    json.remove_prefix(4);
+    return true;
+}
+
+static void appendUTF8(uint32_t codepoint, utte_string& out) noexcept
+{
+    if (codepoint < 0x80)
+        out += static_cast<char>(codepoint);
+    else if (codepoint < 0x800)
+    {
+        out += static_cast<char>(0xC0 | (codepoint >> 6));
+        out += static_cast<char>(0x80 | (codepoint & 0x3F));
+    }
+    else if (codepoint < 0x10000)
+    {
+        out += static_cast<char>(0xE0 | (codepoint >> 12));
+        out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (codepoint & 0x3F));
+    }
+    else
+    {
+        out += static_cast<char>(0xF0 | (codepoint >> 18));
+        out += static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (codepoint & 0x3F));
+    }
+}
+
+// Reads a JSON string, starting at its opening quote
+static bool readJSONString(utte_string_view& json, utte_string& out) noexcept
+{
+    if (json.empty() || json[0] != '"')
+        return false;
+    json.remove_prefix(1);
+    out.clear();
+    while (!json.empty())
+    {
+        // Copy everything up to the next quote or escape at once
+        size_t end = json.find_first_of("\"\\");
+        if (end == utte_string_view::npos)
+            return false;
+        out.append(json.data(), end);
+        char c = json[end];
+        json.remove_prefix(end + 1);
+        if (c == '"')
+            return true;
+
+        if (json.empty())
+            return false;
+        c = json[0];
+        json.remove_prefix(1);
+        switch (c)
+        {
+        case '"': out += '"'; break;
+        case '\\': out += '\\'; break;
+        case '/': out += '/'; break;
+        case 'b': out += '\b'; break;
+        case 'f': out += '\f'; break;
+        case 'n': out += '\n'; break;
+        case 'r': out += '\r'; break;
+        case 't': out += '\t'; break;
+        case 'u':
+        {
+            uint32_t codepoint = 0;
+            if (!readHex(json, codepoint) || (codepoint >= 0xDC00 && codepoint <= 0xDFFF))
+                return false;
+
+            // Characters outside the basic plane are escaped as a pair of surrogates
+            if (codepoint >= 0xD800 && codepoint <= 0xDBFF)
+            {
+                uint32_t low = 0;
+                if (json.size() < 2 || json[0] != '\\' || json[1] != 'u')
+                    return false;
+                json.remove_prefix(2);
+                if (!readHex(json, low) || low < 0xDC00 || low > 0xDFFF)
+                    return false;
+                codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+            }
+            appendUTF8(codepoint, out);
+            break;
+        }
+        default:
+            return false;
+        }
+    }
+    return false;
+}
+
+// Reads a string, number, boolean or null as its text
+static bool readJSONScalar(utte_string_view& json, utte_string& out) noexcept
+{
+    if (json.empty())
+        return false;
+    if (json[0] == '"')
+        return readJSONString(json, out);
+
+    for (utte_string_view literal : { "true", "false" })
+    {
+        if (json.starts_with(literal))
+        {
+            out = literal;
+            json.remove_prefix(literal.size());
+            return true;
+        }
+    }
+    if (json.starts_with("null"))
+    {
+        out.clear();
+        json.remove_prefix(4);
+        return true;
+    }
+
+    size_t end = 0;
+    bool bDigit = false;
+    while (end < json.size() && (isdigit(static_cast<unsigned char>(json[end])) || json[end] == '-' || json[end] == '+' || json[end] == '.' || json[end] == 'e' || json[end] == 'E'))
+        bDigit |= isdigit(static_cast<unsigned char>(json[end++])) != 0;
+    if (!bDigit)
+        return false;
+    out.assign(json.data(), end);
+    json.remove_prefix(end);
+    return true;
+}
+
+// Reads the elements of an array or the entries of an object, after its opening bracket, up to and including its
+// closing bracket. "element" is called after every element, with the key of the entry for objects
+template<typename T>
+static bool readJSONContainer(utte_string_view& json, char close, bool bObject, T&& element) noexcept
+{
+    utte_string key;
+    skipSpace(json);
+    if (!json.empty() && json[0] == close)
+    {
+        json.remove_prefix(1);
+        return true;
+    }
+    while (true)
+    {
+        skipSpace(json);
+        if (bObject)
+        {
+            if (!readJSONString(json, key))
+                return false;
+            skipSpace(json);
+            if (json.empty() || json[0] != ':')
+                return false;
+            json.remove_prefix(1);
+            skipSpace(json);
+        }
+        if (!element(key, json))
+            return false;
+
+        skipSpace(json);
+        if (json.empty())
+            return false;
+        char c = json[0];
+        json.remove_prefix(1);
+        if (c == close)
+            return true;
+        if (c != ',')
+            return false;
+    }
+}
+
+#ifdef __linux__
+bool UTTE::ServerSocket::read(int connection, void* data, size_t size) noexcept
+{
+    auto* it = static_cast<char*>(data);
+    while (size != 0)
+    {
+        auto n = ::read(connection, it, size);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        it += n;
+        size -= n;
+    }
+    return true;
+}
+
+bool UTTE::ServerSocket::write(int connection, const void* data, size_t size) noexcept
+{
+    const auto* it = static_cast<const char*>(data);
+    while (size != 0)
+    {
+        // A peer that went away must not kill the process with SIGPIPE
+        auto n = ::send(connection, it, size, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        it += n;
+        size -= n;
+    }
+    return true;
+}
+#else
+bool UTTE::ServerSocket::read(int, void*, size_t) noexcept
+{
+    return false;
+}
+
+bool UTTE::ServerSocket::write(int, const void*, size_t) noexcept
+{
+    return false;
+}
+#endif
+
+UTTE::Server::Server(const ServerOptions& serverOptions) noexcept
+    : options(serverOptions), threads(serverOptions.threads), generators(threads.size())
+{
+    if (!options.manifest.empty())
+        bManifest = manifest.load(options.manifest);
+    table = std::make_shared<const SnapshotTable>(SnapshotTable{ .bManifest = bManifest });
+
+    previousLoader = PartialCache::getLoader();
+    PartialCache::setLoader([templates = fs::path(options.templates)](const utte_string& path, utte_string& out) -> bool
+    {
+        return PartialCache::loadFile(fs::path(path).is_absolute() ? path : (templates / path).string(), out);
+    });
+#ifdef __linux__
+    if (pipe2(wake, O_CLOEXEC | O_NONBLOCK) != 0)
+        wake[0] = wake[1] = -1;
+#endif
+}
+
+UTTE::Server::~Server() noexcept
+{
+#ifdef __linux__
+    for (int a : wake)
+        if (a != -1)
+            close(a);
+#endif
+    // Renders that are still running use the loader of the server
+    threads.wait();
+    PartialCache::setLoader(previousLoader);
+}
+
+bool UTTE::Server::run(const std::function<Callback>& callback) noexcept
+{
+#ifdef __linux__
+    if ((!options.manifest.empty() && !bManifest) || wake[0] == -1)
+        return false;
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (options.socket.empty() || options.socket.size() >= sizeof(address.sun_path))
+        return false;
+    memcpy(address.sun_path, options.socket.c_str(), options.socket.size() + 1);
+
+    int listener = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listener == -1)
+        return false;
+    unlink(options.socket.c_str());
+    if (bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(listener, SOMAXCONN) != 0)
+    {
+        close(listener);
+        return false;
+    }
+
+    std::vector<int> idle;
+    std::vector<pollfd> polled;
+    while (!bStop.load(std::memory_order_acquire))
+    {
+        polled.clear();
+        polled.push_back(pollfd{ .fd = listener, .events = POLLIN });
+        polled.push_back(pollfd{ .fd = wake[0], .events = POLLIN });
+        for (int a : idle)
+            polled.push_back(pollfd{ .fd = a, .events = POLLIN });
+        if (poll(polled.data(), polled.size(), -1) < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+
+        // Connections with a request are handed to a worker, and are not polled again until it's handled
+        idle.clear();
+        for (size_t i = 2; i < polled.size(); i++)
+        {
+            int connection = polled[i].fd;
+            if (polled[i].revents == 0)
+                idle.push_back(connection);
+            else if ((polled[i].revents & POLLIN) == 0)
+                close(connection);
+            else
+            {
+                threads.submit([this, connection, &callback]() -> void
+                {
+                    if (!serve(connection, callback))
+                    {
+                        close(connection);
+                        return;
+                    }
+                    {
+                        std::lock_guard<std::mutex> lock(returnedMutex);
+                        returned.push_back(connection);
+                    }
+                    char c = 0;
+                    [[maybe_unused]] auto n = ::write(wake[1], &c, 1);
+                });
+            }
+        }
+
+        if (polled[1].revents != 0)
+        {
+            char drain[256];
+            while (::read(wake[0], drain, sizeof(drain)) > 0);
+
+            std::lock_guard<std::mutex> lock(returnedMutex);
+            idle.insert(idle.end(), returned.begin(), returned.end());
+            returned.clear();
+        }
+
+        if (polled[0].revents & POLLIN)
+        {
+            int connection = accept4(listener, nullptr, nullptr, SOCK_CLOEXEC);
+            if (connection != -1)
+            {
+                // A client that stops in the middle of a request would otherwise hold a worker forever
+                timeval timeout{ .tv_sec = requestTimeoutSeconds, .tv_usec = 0 };
+                setsockopt(connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+                setsockopt(connection, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+                idle.push_back(connection);
+            }
+        }
+    }
+
+    threads.wait();
+    for (int a : idle)
+        close(a);
+    for (int a : returned)
+        close(a);
+    returned.clear();
+    close(listener);
+    unlink(options.socket.c_str());
+    return true;
+#else
+    (void)callback;
+    return false;
+#endif
+}
+
+void UTTE::Server::stop() noexcept
+{
+    bStop.store(true, std::memory_order_release);
+#ifdef __linux__
+    // Only async-signal-safe calls here
+    char c = 0;
+    if (wake[1] != -1)
+    {
+        [[maybe_unused]] auto n = ::write(wake[1], &c, 1);
+    }
+#endif
+}
+
+bool UTTE::Server::reload() noexcept
+{
+    BuildManifest loaded;
+    if (!options.manifest.empty() && !loaded.load(options.manifest))
+        return false;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        manifest = std::move(loaded);
+        bManifest = !options.manifest.empty();
+
+        auto current = std::atomic_load(&table);
+        auto updated = std::make_shared<SnapshotTable>(*current);
+        updated->bManifest = bManifest;
+        for (auto& a : updated->slots)
+        {
+            auto created = std::make_shared<Snapshot>();
+            manifest.bind(a.first, *created);
+            a.second->publish(std::move(created));
+        }
+        std::atomic_store(&table, std::shared_ptr<const SnapshotTable>(std::move(updated)));
+    }
+    PartialCache::clear();
+    return true;
+}
+
+UTTE::ServerStats UTTE::Server::stats() const noexcept
+{
+    ServerStats result{};
+    result.requests = requests.load(std::memory_order_relaxed);
+    result.failures = failures.load(std::memory_order_relaxed);
+    result.maxMicroseconds = maxMicroseconds.load(std::memory_order_relaxed);
+    if (result.requests != 0)
+        result.meanMicroseconds = totalMicroseconds.load(std::memory_order_relaxed) / result.requests;
+
+    // Requests may be recorded while the histogram is read, so the percentiles are taken of what was read
+    uint64_t counts[histogramSize];
+    uint64_t total = 0;
+    for (size_t i = 0; i < histogramSize; i++)
+        total += counts[i] = histogram[i].load(std::memory_order_relaxed);
+
+    uint64_t* percentiles[] = { &result.p50Microseconds, &result.p90Microseconds, &result.p99Microseconds };
+    uint64_t targets[] = { (total * 50 + 99) / 100, (total * 90 + 99) / 100, (total * 99 + 99) / 100 };
+    uint64_t seen = 0;
+    size_t next = 0;
+    for (size_t i = 0; i < histogramSize && next < 3 && total != 0; i++)
+    {
+        seen += counts[i];
+        for (; next < 3 && seen >= targets[next]; next++)
+            *percentiles[next] = std::min(bucketLimit(i), result.maxMicroseconds);
+    }
+    return result;
+}
+
+bool UTTE::Server::serve(int connection, const std::function<Callback>& callback) noexcept
+{
+    auto begin = std::chrono::steady_clock::now();
+    ServerRequestHeader header{};
+    if (!ServerSocket::read(connection, &header, sizeof(header)) || header.magic != ServerRequestHeader{}.magic
+        || header.idSize > maxIdSize || header.contextSize > options.maxContextBytes)
+        return false;
+
+    ServerRequestResult result{};
+    result.id.resize(header.idSize);
+    utte_string context(header.contextSize, '\0');
+    if (!ServerSocket::read(connection, result.id.data(), result.id.size()) || !ServerSocket::read(connection, context.data(), context.size()))
+        return false;
+
+    utte_string output;
+    switch (header.type)
+    {
+    case UTTE_SERVER_REQUEST_RENDER:
+        result.status = render(result.id, static_cast<ServerContextFormat>(header.format), context, output);
+        break;
+    case UTTE_SERVER_REQUEST_STATS:
+    {
+        auto current = stats();
+        output = "requests " + std::to_string(current.requests) + "\nfailures " + std::to_string(current.failures)
+            + "\nmean_us " + std::to_string(current.meanMicroseconds) + "\np50_us " + std::to_string(current.p50Microseconds)
+            + "\np90_us " + std::to_string(current.p90Microseconds) + "\np99_us " + std::to_string(current.p99Microseconds)
+            + "\nmax_us " + std::to_string(current.maxMicroseconds) + "\n";
+        break;
+    }
+    case UTTE_SERVER_REQUEST_RELOAD:
+        result.status = reload() ? UTTE_PARSE_STATUS_SUCCESS : UTTE_PARSE_STATUS_INVALID_VALUE;
+        break;
+    default:
+        return false;
+    }
+    result.type = static_cast<ServerRequestType>(header.type);
+    result.bytes = output.size();
+
+    // The output is complete before it's sent, since renders don't produce it incrementally, but chunks let clients
+    // handle it before all of it arrived
+    bool bSent = true;
+    size_t chunkBytes = std::clamp<size_t>(options.chunkBytes, 1, UINT32_MAX);
+    for (size_t i = 0; bSent && i < output.size(); i += chunkBytes)
+    {
+        auto size = static_cast<uint32_t>(std::min(chunkBytes, output.size() - i));
+        bSent = ServerSocket::write(connection, &size, sizeof(size)) && ServerSocket::write(connection, output.data() + i, size);
+    }
+
+    uint32_t end = 0;
+    result.microseconds = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+    ServerResponseTrailer trailer{ .status = static_cast<uint32_t>(result.status), .microseconds = result.microseconds };
+
+    // Recorded before the client can send its next request, so that the statistics it asks for include this one
+    record(result);
+    bSent = bSent && ServerSocket::write(connection, &end, sizeof(end)) && ServerSocket::write(connection, &trailer, sizeof(trailer));
+    if (callback)
+        callback(result);
+    return bSent;
+}
+
+UTTE::ParseResultStatus UTTE::Server::render(const utte_string& id, ServerContextFormat format, utte_string_view context, utte_string& output) noexcept
+{
+    if (!isValidId(id))
+        return UTTE_PARSE_STATUS_INVALID_VALUE;
+
+    auto generator = generators.acquire();
+    if (generator->loadFromCache(id) != UTTE_INITIALISATION_RESULT_SUCCESS)
+        return UTTE_PARSE_STATUS_INVALID_VALUE;
+
+    // Only templates that exist get a snapshot, so requests for random ids don't grow the map
+    generator->setBudget(options.budget);
+    generator->setSnapshot(snapshot(id));
+    if (format == UTTE_SERVER_CONTEXT_BINARY ? !bindBinary(context, *generator) : format == UTTE_SERVER_CONTEXT_JSON ? !bindJSON(context, *generator) : true)
+        return UTTE_PARSE_STATUS_INVALID_VALUE;
+
+    auto rendered = generator->render();
+    output = *rendered.result;
+    return rendered.status;
+}
+
+std::shared_ptr<const UTTE::Snapshot> UTTE::Server::snapshot(const utte_string& id) noexcept
+{
+    const auto find = [&id](const SnapshotTable& current) -> const SnapshotSlot*
+    {
+        auto it = current.slots.find(id);
+        return it == current.slots.end() ? nullptr : it->second.get();
+    };
+
+    auto current = std::atomic_load(&table);
+    if (!current->bManifest)
+        return nullptr;
+    if (auto* slot = find(*current))
+        return slot->load();
+
+    // Another thread may have added it before the lock was taken
+    std::lock_guard<std::mutex> lock(mutex);
+    current = std::atomic_load(&table);
+    if (!current->bManifest)
+        return nullptr;
+    if (auto* slot = find(*current))
+        return slot->load();
+
+    auto created = std::make_shared<Snapshot>();
+    manifest.bind(id, *created);
+    auto slot = std::make_shared<SnapshotSlot>();
+    slot->publish(std::move(created));
+
+    auto updated = std::make_shared<SnapshotTable>(*current);
+    updated->slots.emplace(id, slot);
+    std::atomic_store(&table, std::shared_ptr<const SnapshotTable>(std::move(updated)));
+    return slot->load();
+}
+
+bool UTTE::Server::bindBinary(utte_string_view context, Generator& generator) noexcept
+{
+    const auto readSize = [&context](uint32_t& size) -> bool
+    {
+        if (context.size() < sizeof(size))
+            return false;
+        memcpy(&size, context.data(), sizeof(size));
+        context.remove_prefix(sizeof(size));
+        return true;
+    };
+    const auto readString = [&](utte_string_view& out) -> bool
+    {
+        uint32_t size = 0;
+        if (!readSize(size) || context.size() < size)
+            return false;
+        out = context.substr(0, size);
+        context.remove_prefix(size);
+        return true;
+    };
+
+    utte_string_view name;
+    utte_string_view value;
+    while (!context.empty())
+    {
+        auto kind = static_cast<uint8_t>(context[0]);
+        context.remove_prefix(1);
+        if (!readString(name) || name.empty())
+            return false;
+
+        if (kind == 0)
+        {
+            if (!readString(value))
+                return false;
+            generator.pushVariable(Variable{ .value = utte_string(value) }, utte_string(name));
+            continue;
+        }
+
+        uint32_t count = 0;
+        if ((kind != 1 && kind != 2) || !readSize(count))
+            return false;
+
+        // Every string takes at least its size, so a count beyond that is malformed and isn't reserved
+        if (count > context.size() / sizeof(uint32_t) / kind)
+            return false;
+        if (kind == 1)
+        {
+            auto& array = generator.requestArrayWithGC();
+            array.reserve(count);
+            for (uint32_t i = 0; i < count; i++)
+            {
+                if (!readString(value))
+                    return false;
+                array.emplace_back(value);
+            }
+            generator.pushVariable(Generator::makeArray(array), utte_string(name));
+        }
+        else
+        {
+            auto& map = generator.requestMapWithGC();
+            for (uint32_t i = 0; i < count; i++)
+            {
+                utte_string_view key;
+                if (!readString(key) || !readString(value))
+                    return false;
+                map[utte_string(key)] = value;
+            }
+            generator.pushVariable(Generator::makeMap(map), utte_string(name));
+        }
+    }
+    return true;
+}
+
+bool UTTE::Server::bindJSON(utte_string_view context, Generator& generator) noexcept
+{
+    skipSpace(context);
+    if (context.empty() || context[0] != '{')
+        return false;
+    context.remove_prefix(1);
+
+    utte_string value;
+    bool bValid = readJSONContainer(context, '}', true, [&](const utte_string& name, utte_string_view& json) -> bool
+    {
+        if (name.empty() || json.empty())
+            return false;
+        if (json[0] == '[')
+        {
+            json.remove_prefix(1);
+            auto& array = generator.requestArrayWithGC();
+            if (!readJSONContainer(json, ']', false, [&](const utte_string&, utte_string_view& element) -> bool
+            {
+                return readJSONScalar(element, array.emplace_back());
+            }))
+                return false;
+            generator.pushVariable(Generator::makeArray(array), name);
+            return true;
+        }
+        if (json[0] == '{')
+        {
+            json.remove_prefix(1);
+            auto& map = generator.requestMapWithGC();
+            if (!readJSONContainer(json, '}', true, [&](const utte_string& key, utte_string_view& element) -> bool
+            {
+                return readJSONScalar(element, map[key]);
+            }))
+                return false;
+            generator.pushVariable(Generator::makeMap(map), name);
+            return true;
+        }
+        if (!readJSONScalar(json, value))
+            return false;
+        generator.pushVariable(Variable{ .value = value }, name);
+        return true;
+    });
+    skipSpace(context);
+    return bValid && context.empty();
+}
+
+void UTTE::Server::record(const ServerRequestResult& result) noexcept
+{
+    requests.fetch_add(1, std::memory_order_relaxed);
+    if (result.status != UTTE_PARSE_STATUS_SUCCESS)
+        failures.fetch_add(1, std::memory_order_relaxed);
+    totalMicroseconds.fetch_add(result.microseconds, std::memory_order_relaxed);
+    histogram[bucket(result.microseconds)].fetch_add(1, std::memory_order_relaxed);
+
+    uint64_t current = maxMicroseconds.load(std::memory_order_relaxed);
+    while (current < result.microseconds && !maxMicroseconds.compare_exchange_weak(current, result.microseconds, std::memory_order_relaxed));
+}
\ No newline at end of file
@@ -0,0 +1,222 @@
+#pragma once
+#include "Build.hpp"
+#include "GeneratorPool.hpp"
+#include "PartialCache.hpp"
+#include "Snapshot.hpp"
+#include "ThreadPool.hpp"
+#include <atomic>
+#include <mutex>
+
+namespace UTTE
+{
+    /**
+     * @brief The messages of the protocol spoken over the socket of a Server. Both sides are on the same machine, so
+     * integers are sent in its byte order. A request is a ServerRequestHeader, followed by the id of the template and
+     * the context. The response is any number of chunks of output, each one a 32-bit size followed by that many bytes,
+     * then a chunk of size 0 and a ServerResponseTrailer. Any number of requests can be sent over a connection, one
+     * after the other
+     */
+    enum ServerRequestType : uint32_t
+    {
+        // Renders the template with the given id, with the variables of the context bound to it
+        UTTE_SERVER_REQUEST_RENDER = 0,
+        // Returns the ServerStats of the server as text, one "name value" pair per line
+        UTTE_SERVER_REQUEST_STATS = 1,
+        // Loads the manifest again and drops all compiled templates, so that they're loaded again when they're used
+        UTTE_SERVER_REQUEST_RELOAD = 2,
+    };
+
+    enum ServerContextFormat : uint32_t
+    {
+        /**
+         * @brief Entries that each start with a byte for their kind, 0 for a variable, 1 for an array and 2 for a map,
+         * and the name of the variable. Variables are followed by their value, arrays by a 32-bit count and their
+         * elements, and maps by a 32-bit count and their keys and values, one after the other. Names, values, elements,
+         * keys and values are all a 32-bit size followed by that many bytes. See RequestContext
+         */
+        UTTE_SERVER_CONTEXT_BINARY = 0,
+        /**
+         * @brief A JSON object. Strings are bound as variables, and numbers, true and false as their text, and null as an
+         * empty string. Arrays are bound as arrays and objects as maps, as long as they only hold strings, numbers,
+         * booleans and null
+         */
+        UTTE_SERVER_CONTEXT_JSON = 1,
+    };
+
+    struct ServerRequestHeader
+    {
+        uint32_t magic = 0x45545455;
+        uint32_t type = UTTE_SERVER_REQUEST_RENDER;
+        uint32_t format = UTTE_SERVER_CONTEXT_BINARY;
+        uint32_t idSize = 0;
+        uint64_t contextSize = 0;
+    };
+
+    struct ServerResponseTrailer
+    {
+        uint32_t status = UTTE_PARSE_STATUS_SUCCESS;
+        uint32_t reserved = 0;
+
+        // The time the server took to handle the request, from reading its header to sending its output
+        uint64_t microseconds = 0;
+    };
+
+    // Reads and writes of whole messages on a socket, shared by Server and Client
+    struct MLS_PUBLIC_API ServerSocket
+    {
+        // Read or write exactly "size" bytes, retrying when interrupted. Return false if the connection was closed,
+        // failed or timed out
+        static bool read(int connection, void* data, size_t size) noexcept;
+        static bool write(int connection, const void* data, size_t size) noexcept;
+    };
+
+    struct MLS_PUBLIC_API ServerOptions
+    {
+        // The location of the Unix domain socket. A file that is already there is replaced
+        utte_string socket;
+
+        // The directory that the ids of templates, and the paths given to "include" in them, are relative to
+        utte_string templates;
+
+        // The location of a manifest with variables that are bound to every request, empty if there is none. See
+        // BuildManifest, the sections of pages are named after the ids of templates
+        utte_string manifest;
+
+        // The number of threads to render on, 0 means one per hardware thread
+        size_t threads = 0;
+
+        // The budget of every render, see Generator::setBudget
+        RenderBudget budget{};
+
+        // Requests whose context is larger than this are refused, and their connection is closed
+        size_t maxContextBytes = 64 * 1024 * 1024;
+
+        // The size of the chunks the output is sent in
+        size_t chunkBytes = 64 * 1024;
+    };
+
+    struct MLS_PUBLIC_API ServerRequestResult
+    {
+        ServerRequestType type = UTTE_SERVER_REQUEST_RENDER;
+
+        // The id of the template, for renders
+        utte_string id;
+        ParseResultStatus status = UTTE_PARSE_STATUS_SUCCESS;
+
+        // The time it took to read the context, render and send the output
+        uint64_t microseconds = 0;
+        size_t bytes = 0;
+    };
+
+    struct MLS_PUBLIC_API ServerStats
+    {
+        uint64_t requests = 0;
+        uint64_t failures = 0;
+
+        // Latencies of all requests so far. Percentiles are read from a histogram, so they're rounded up by at most an
+        // eighth
+        uint64_t meanMicroseconds = 0;
+        uint64_t p50Microseconds = 0;
+        uint64_t p90Microseconds = 0;
+        uint64_t p99Microseconds = 0;
+        uint64_t maxMicroseconds = 0;
+    };
+
+    /**
+     * @brief Renders templates for other processes, like build scripts, that would otherwise start a new process and
+     * load, compile and bind everything for every group of pages. Listens on a Unix domain socket and keeps the
+     * compiled templates, in the PartialCache, and the variables of the manifest, in one snapshot per template, for as
+     * long as it runs. Idle connections are polled on the thread that calls "run", and every request that arrives is
+     * handled on a ThreadPool with a generator from a GeneratorPool, so clients are served at the same time. See
+     * ServerRequestType for the protocol and Client for a client. Only available on Linux.
+     *
+     * The PartialCache is process-wide, so a server replaces its loader with one that finds partials in the directory
+     * of the templates, and sets the previous loader again when it's destroyed. Don't run two servers, or render
+     * templates that include partials from elsewhere, in the same process while a server exists
+     */
+    class MLS_PUBLIC_API Server
+    {
+    public:
+        // Called after every request, on the thread that handled it, so it may be called by several threads at once
+        typedef void(Callback)(const ServerRequestResult& result);
+
+        // Loads the manifest, if there is one, and replaces the loader of the PartialCache, so that templates are
+        // loaded from the directory of the templates
+        explicit Server(const ServerOptions& options) noexcept;
+        ~Server() noexcept;
+
+        Server(const Server&) = delete;
+        Server& operator=(const Server&) = delete;
+
+        /**
+         * @brief Listens on the socket and handles requests until "stop" is called. Waits for the requests that are
+         * being handled before returning, and removes the socket
+         * @return false if the socket couldn't be created or the manifest couldn't be loaded
+         */
+        bool run(const std::function<Callback>& callback) noexcept;
+
+        // Makes "run" return. Can be called from any thread and from signal handlers
+        void stop() noexcept;
+
+        // Loads the manifest again and publishes new snapshots of it, and drops all compiled templates. Requests that
+        // are being handled keep the old ones. Returns false if the manifest couldn't be loaded, in which case the old
+        // one is kept
+        bool reload() noexcept;
+
+        ServerStats stats() const noexcept;
+    private:
+        // Reads and handles one request. Returns false if the connection has to be closed
+        bool serve(int connection, const std::function<Callback>& callback) noexcept;
+
+        // Renders a template into "output" and returns the status
+        ParseResultStatus render(const utte_string& id, ServerContextFormat format, utte_string_view context, utte_string& output) noexcept;
+
+        // Returns the snapshot of the manifest for a template, nullptr if there's no manifest
+        std::shared_ptr<const Snapshot> snapshot(const utte_string& id) noexcept;
+
+        // Bind the variables of a context to a generator. Return false if the context is malformed
+        static bool bindBinary(utte_string_view context, Generator& generator) noexcept;
+        static bool bindJSON(utte_string_view context, Generator& generator) noexcept;
+
+        // Counts a request in the statistics
+        void record(const ServerRequestResult& result) noexcept;
+
+        ServerOptions options;
+
+        // The loader of the PartialCache before the server replaced it
+        std::function<IncludeLoader> previousLoader;
+        ThreadPool threads;
+        GeneratorPool generators;
+
+        // The slots of the snapshots of the manifest, one for every template that was rendered, by id
+        struct SnapshotTable
+        {
+            bool bManifest = false;
+            utte_map<utte_string, std::shared_ptr<SnapshotSlot>> slots = {};
+        };
+
+        // The manifest and the table of snapshots. Requests load the table with std::atomic_load, without locking. The
+        // first request for a template and "reload" publish a copy of it with std::atomic_store under the mutex, so
+        // that they don't lose each other's changes. Copies share their slots, so "reload" publishes new snapshots to
+        // requests that loaded an older table too
+        std::mutex mutex;
+        BuildManifest manifest;
+        bool bManifest = false;
+        std::shared_ptr<const SnapshotTable> table;
+
+        // The connections that were handled and are polled again, and a pipe that wakes up "run" when one is added or
+        // "stop" is called
+        std::mutex returnedMutex;
+        std::vector<int> returned;
+        int wake[2] = { -1, -1 };
+        std::atomic<bool> bStop = false;
+
+        // The latencies of all requests, in buckets of an eighth of a power of 2 microseconds
+        static constexpr size_t histogramSize = 64 * 8;
+        std::atomic<uint64_t> histogram[histogramSize] = {};
+        std::atomic<uint64_t> requests = 0;
+        std::atomic<uint64_t> failures = 0;
+        std::atomic<uint64_t> totalMicroseconds = 0;
+        std::atomic<uint64_t> maxMicroseconds = 0;
+    };
+}
\ No newline at end of file
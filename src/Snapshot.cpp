@@ -0,0 +1,51 @@
+#include "Snapshot.hpp"
+
+void UTTE::Snapshot::pushVariable(const UTTE::Variable& var, const utte_string& name) noexcept
+{
+    auto& f = variables.emplace_back(Function{ .name = name, .symbol = SymbolTable::intern(name) });
+    f.setValue(var);
+}
+
+std::vector<utte_string>& UTTE::Snapshot::requestArrayWithGC() noexcept
+{
+    return arrays.request();
+}
+
+utte_map<utte_string, utte_string>& UTTE::Snapshot::requestMapWithGC() noexcept
+{
+    return maps.request();
+}
+
+const UTTE::Function* UTTE::Snapshot::find(UTTE::Symbol symbol) const noexcept
+{
+    return symbol < index.size() && index[symbol] != 0 ? &variables[index[symbol] - 1] : nullptr;
+}
+
+void UTTE::Snapshot::freeze() noexcept
+{
+    index.clear();
+    for (size_t i = 0; i < variables.size(); i++)
+    {
+        auto symbol = variables[i].symbol;
+        if (symbol >= index.size())
+            index.resize(symbol + 1, 0);
+        if (index[symbol] == 0)
+            index[symbol] = static_cast<uint32_t>(i + 1);
+    }
+}
+
+std::shared_ptr<const UTTE::Snapshot> UTTE::SnapshotSlot::load() const noexcept
+{
+    return std::atomic_load(&current);
+}
+
+void UTTE::SnapshotSlot::publish(std::shared_ptr<UTTE::Snapshot> snapshot) noexcept
+{
+    // The index is built before the snapshot is visible, so readers never write to it
+    if (snapshot != nullptr)
+        snapshot->freeze();
+
+    // The previous snapshot is released once it's swapped out, outside of the atomic operation, since freeing it may
+    // take a while
+    auto previous = std::atomic_exchange(&current, std::shared_ptr<const Snapshot>(std::move(snapshot)));
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#pragma once
+#include "Generator.hpp"
+#include <memory>
+
+namespace UTTE
+{
+    /**
+     * @brief Variables, arrays and maps that any number of generators read at the same time, for data that is refreshed
+     * while renders are in flight, like the configuration of a site or a table of prices. A snapshot is built on one
+     * thread and published through a SnapshotSlot, after which it's never modified. Generators see its variables after
+     * their own, see Generator::setSnapshot
+     */
+    class MLS_PUBLIC_API Snapshot
+    {
+    public:
+        // Adds a variable. Only call this before the snapshot is published
+        void pushVariable(const Variable& var, const utte_string& name) noexcept;
+
+        // Returns a reference to an array that is deallocated with the snapshot, to bind with Generator::makeArray
+        std::vector<utte_string>& requestArrayWithGC() noexcept;
+        // Returns a reference to a map that is deallocated with the snapshot, to bind with Generator::makeMap
+        utte_map<utte_string, utte_string>& requestMapWithGC() noexcept;
+
+        // Returns the first variable with the given symbol, or nullptr. Only reads the snapshot, so any number of
+        // threads can call it once the snapshot is published
+        const Function* find(Symbol symbol) const noexcept;
+    private:
+        friend class SnapshotSlot;
+
+        // Indexes the variables by symbol. Called when the snapshot is published
+        void freeze() noexcept;
+
+        std::vector<Function> variables;
+
+        // Positions of the variables by symbol, plus 1, or 0 if there's no variable with the symbol
+        std::vector<uint32_t> index;
+
+        Arena<std::vector<utte_string>> arrays;
+        Arena<utte_map<utte_string, utte_string>> maps;
+    };
+
+    /**
+     * @brief Holds the current snapshot of some data. Loading it copies a shared pointer and publishing one swaps it,
+     * both with the atomic operations of std::shared_ptr, so renders never wait for a snapshot to be built or freed. A
+     * snapshot that was replaced stays alive until the last generator that loaded it drops it, when another one is set
+     * or the generator is reset, so a render never sees its data change or get freed. All members are thread-safe
+     */
+    class MLS_PUBLIC_API SnapshotSlot
+    {
+    public:
+        // Returns the current snapshot, nullptr if none was published
+        std::shared_ptr<const Snapshot> load() const noexcept;
+
+        // Makes the snapshot the current one. It must not be modified afterwards
+        void publish(std::shared_ptr<Snapshot> snapshot) noexcept;
+    private:
+        // Only accessed through std::atomic_load and std::atomic_exchange
+        std::shared_ptr<const Snapshot> current;
+    };
+}
\ No newline at end of file
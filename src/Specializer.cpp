@@ -0,0 +1,481 @@
+#include "Specializer.hpp"
+#include <algorithm>
+
+void UTTE::Specializer::specialize(UTTE::Generator& generator, const UTTE::ProgramView& program, utte_string& residual) noexcept
+{
+    State state{ .program = program, .maxDepth = generator.root().maxDepth };
+
+    // Putting a pruned branch in place can only fail if it ends with a bracket that pairs with the text after it, in
+    // which case branches are wrapped instead. The text of the template itself is never cut differently then
+    for (;;)
+    {
+        std::vector<Segment> segments;
+        residual.clear();
+        block(state, generator, 0, segments);
+        if (join(segments, false, residual) || !state.bInline)
+            return;
+        state.bInline = false;
+    }
+}
+
+bool UTTE::Specializer::block(State& state, UTTE::Generator& scope, uint32_t pc, std::vector<Segment>& segments) noexcept
+{
+    if (state.maxDepth != 0 && state.depth >= state.maxDepth)
+        return false;
+
+    ++state.depth;
+    bool bSuccess = true;
+    for (auto* instruction = &state.program.code[pc]; instruction->op != UTTE_OP_RETURN; instruction = &state.program.code[pc])
+    {
+        if (instruction->op == UTTE_OP_TEXT)
+        {
+            auto text = state.program.literal(instruction->a);
+            segments.push_back({ .text = utte_string(text.data(), text.size()), .bLiteral = true });
+            ++pc;
+            continue;
+        }
+
+        Value value;
+        if (!expression(state, scope, pc, value))
+        {
+            bSuccess = false;
+            break;
+        }
+        if (value.bNone)
+            continue;
+        if (value.bSegments && state.bInline)
+        {
+            segments.insert(segments.end(), std::make_move_iterator(value.segments.begin()), std::make_move_iterator(value.segments.end()));
+            continue;
+        }
+        if (value.bSegments && !collapse(state, value))
+        {
+            bSuccess = false;
+            break;
+        }
+
+        // Bodies render as their text. Arrays and other containers render as their address, so they're left as the
+        // expression they came from
+        if (value.bBody || (value.bStatic && value.variable.type == UTTE_VARIABLE_TYPE_HINT_NORMAL))
+        {
+            auto text = value.bBody ? utte_string(value.text.data(), value.text.size()) : std::move(value.variable.value);
+            segments.push_back({ .text = std::move(text), .original = state.unrolling == 0 ? std::move(value.original) : utte_string() });
+        }
+        else if (!value.bStatic)
+            segments.push_back({ .text = std::move(value.residual), .bText = false });
+        else if (state.unrolling == 0)
+            segments.push_back({ .text = std::move(value.original), .bText = false });
+        else
+        {
+            bSuccess = false;
+            break;
+        }
+    }
+    --state.depth;
+    return bSuccess;
+}
+
+bool UTTE::Specializer::expression(State& state, UTTE::Generator& scope, uint32_t& pc, Value& result) noexcept
+{
+    std::vector<Value> args;
+    for (++pc;;)
+    {
+        auto& instruction = state.program.code[pc];
+        if (instruction.op == UTTE_OP_FRAME)
+        {
+            Value value;
+            if (!expression(state, scope, pc, value) || (value.bSegments && !collapse(state, value)))
+                return false;
+            if (!value.bNone)
+                args.push_back(std::move(value));
+            continue;
+        }
+        ++pc;
+        if (instruction.op == UTTE_OP_CALL || instruction.op == UTTE_OP_CALL_DYNAMIC)
+            break;
+
+        // Literals are known, except for bodies, which are only known once it's known what they're passed to
+        auto literal = state.program.literal(instruction.a);
+        Value value{ .bBody = instruction.op == UTTE_OP_PUSH_BODY, .body = instruction.b, .text = literal, .bLiteral = true };
+        value.bStatic = !value.bBody;
+        value.variable.value.assign(literal.data(), literal.size());
+        if (!quote(literal, false, value.original))
+            value.original.assign(literal.data(), literal.size());
+        args.push_back(std::move(value));
+    }
+
+    // The expression as it was written. The body of "func", "raw" and "comment" is cut up to the brackets that end it
+    if (!args.empty() && args[0].bLiteral && isSpecial(args[0].text))
+    {
+        result.original = "{{ ";
+        result.original.append(args[0].text.data(), args[0].text.size());
+        if (args.size() > 1)
+        {
+            result.original += ' ';
+            result.original.append(args[1].text.data(), args[1].text.size());
+        }
+        result.original += "}}";
+    }
+    else
+    {
+        result.original = "{{";
+        for (auto& a : args)
+        {
+            result.original += ' ';
+            result.original += a.original;
+        }
+        result.original += " }}";
+    }
+    return call(state, scope, args, result);
+}
+
+bool UTTE::Specializer::call(State& state, UTTE::Generator& scope, std::vector<Value>& args, Value& result) noexcept
+{
+    // Like when parsing, an expression without arguments renders nothing
+    if (args.empty())
+    {
+        result.bStatic = true;
+        return true;
+    }
+    if (!args[0].bStatic)
+        return residualize(state, scope, nullptr, args, result);
+
+    // Functions that aren't bound yet may be bound when the residual is rendered
+    Symbol symbol = SymbolTable::find(args[0].variable.value);
+    const Function* f = scope.findFunction(utte_string_view(args[0].variable.value));
+    if (f == nullptr)
+        return residualize(state, scope, nullptr, args, result);
+
+    if (f->bVariable)
+    {
+        if (!f->bStatic || f->variable.status != UTTE_PARSE_STATUS_SUCCESS)
+            return residualize(state, scope, f, args, result);
+
+        result.bStatic = true;
+        result.bNone = f->variable._internalBoolComment;
+        result.variable = f->variable;
+        return true;
+    }
+
+    bool bBuiltin = Generator::isBuiltin(*f);
+    if (bBuiltin && symbol == UTTE_SYMBOL_FUNC && args.size() == 2 && args[1].bBody)
+    {
+        result.bBody = true;
+        result.body = args[1].body;
+        result.text = args[1].text;
+        return true;
+    }
+
+    std::vector<VariableView> views;
+    if (bBuiltin && (symbol == UTTE_SYMBOL_IF || symbol == UTTE_SYMBOL_SWITCH || symbol == UTTE_SYMBOL_COND))
+    {
+        // Errors are left for the render to report
+        size_t index = 0;
+        if (!view(args, views))
+            return residualize(state, scope, f, args, result);
+        auto status = symbol == UTTE_SYMBOL_IF ? CoreFuncs::selectIf(views, index)
+                    : symbol == UTTE_SYMBOL_SWITCH ? CoreFuncs::selectSwitch(views, index)
+                    : CoreFuncs::selectCond(views, index);
+        if (status != UTTE_PARSE_STATUS_SUCCESS || (index != args.size() && !args[index].bBody))
+            return residualize(state, scope, f, args, result);
+
+        result.bStatic = index == args.size();
+        if (result.bStatic)
+            return true;
+
+        // Only the branch that is taken is kept
+        Generator body(&scope);
+        result.bSegments = true;
+        if (block(state, body, args[index].body, result.segments))
+            return true;
+
+        result.bSegments = false;
+        result.segments.clear();
+        return state.unrolling == 0 && residualize(state, scope, f, args, result);
+    }
+
+    if (bBuiltin && symbol == UTTE_SYMBOL_FOR)
+    {
+        if (unroll(state, scope, args, result))
+            return true;
+
+        result.bSegments = false;
+        result.segments.clear();
+        return residualize(state, scope, f, args, result);
+    }
+
+    // Builtins only depend on their arguments, except for "include", whose partial may change before the residual is
+    // rendered, and "filter", which also depends on its predicate
+    bool bEvaluate = bBuiltin ? symbol != UTTE_SYMBOL_INCLUDE : f->bStatic && !f->asyncFunction;
+    if (bBuiltin && symbol == UTTE_SYMBOL_FILTER)
+    {
+        auto* predicate = args.size() > 2 && args[2].bStatic ? scope.findFunction(utte_string_view(args[2].variable.value)) : nullptr;
+        bEvaluate = predicate != nullptr && (Generator::isBuiltin(*predicate) || (predicate->bStatic && !predicate->asyncFunction));
+    }
+    if (bEvaluate && view(args, views))
+    {
+        auto value = f->call(views, &scope);
+        if (value.status == UTTE_PARSE_STATUS_SUCCESS)
+        {
+            result.bStatic = true;
+            result.bNone = value._internalBoolComment;
+            result.variable = std::move(value);
+            return true;
+        }
+    }
+    return residualize(state, scope, f, args, result);
+}
+
+bool UTTE::Specializer::residualize(State& state, UTTE::Generator& scope, const UTTE::Function* f, std::vector<Value>& args, Value& result) noexcept
+{
+    // Replaced "func", "raw" and "comment" functions still get their body cut like the builtins. Partials are rendered
+    // with the variables of the scope they're included in, which are gone once a loop is unrolled
+    bool bBuiltin = f != nullptr && Generator::isBuiltin(*f);
+    if (bBuiltin && f->symbol == UTTE_SYMBOL_INCLUDE && state.unrolling != 0)
+        return false;
+    if (args[0].bLiteral && isSpecial(args[0].text))
+    {
+        if (state.unrolling != 0)
+            return false;
+        result.residual = result.original;
+        return true;
+    }
+
+    // Bodies are only specialized if it's known how the function renders them. "for" renders them with its variables,
+    // which hide static variables with the same names
+    Generator body(&scope);
+    bool bBodies = bBuiltin && (f->symbol == UTTE_SYMBOL_IF || f->symbol == UTTE_SYMBOL_SWITCH || f->symbol == UTTE_SYMBOL_COND);
+    if (bBuiltin && f->symbol == UTTE_SYMBOL_FOR && (args.size() == 4 || args.size() == 5))
+    {
+        bBodies = true;
+        for (size_t i = 1; i < args.size() - 2 && bBodies; i++)
+        {
+            bBodies = args[i].bStatic;
+            if (bBodies)
+                body.pushVariable({}, args[i].variable.value);
+        }
+    }
+
+    result.residual = "{{";
+    for (size_t i = 0; i < args.size(); i++)
+    {
+        auto& arg = args[i];
+        utte_string encoded;
+        std::vector<Segment> segments;
+        if (arg.bBody && bBodies && block(state, body, arg.body, segments) && join(segments, true, encoded))
+            encoded.insert(0, "{{ func ").append("}}");
+        else if (!arg.bBody && !arg.bStatic)
+            encoded = std::move(arg.residual);
+        else if (arg.bBody || arg.variable.type != UTTE_VARIABLE_TYPE_HINT_NORMAL || !quote(arg.variable.value, i == 0, encoded))
+        {
+            // The expression as it was written may use the variables of a loop that is being unrolled
+            if (state.unrolling != 0)
+                return false;
+            encoded = arg.original;
+        }
+        result.residual += ' ';
+        result.residual += encoded;
+    }
+    result.residual += " }}";
+    return true;
+}
+
+bool UTTE::Specializer::unroll(State& state, UTTE::Generator& scope, std::vector<Value>& args, Value& result) noexcept
+{
+    // Same checks as CoreFuncs::funcFor. Sequences produce their elements while they're iterated, so they're never
+    // unrolled. Loops that would fail are left for the render to report
+    if (args.size() < 4 || args.size() > 5 || !args.back().bBody)
+        return false;
+    for (size_t i = 1; i < args.size() - 1; i++)
+        if (!args[i].bStatic)
+            return false;
+
+    auto& collection = args[args.size() - 2].variable;
+    VariableView view{ .value = utte_string_view(collection.value.data(), collection.value.size()), .type = collection.type };
+    uint32_t body = args.back().body;
+
+    // The variables of the loop are static within its body. Reserve first, so that pushing the second variable doesn't
+    // invalidate the reference to the first one
+    Generator loop(&scope);
+    loop.functions.reserve(2);
+    auto& key = loop.pushVariable({}, args[1].variable.value);
+    auto& val = args.size() == 5 ? loop.pushVariable({}, args[2].variable.value) : key;
+    key.bStatic = true;
+    val.bStatic = true;
+
+    result.bSegments = true;
+    ++state.unrolling;
+    bool bSuccess = true;
+    if (args.size() == 4 && view.type == UTTE_VARIABLE_TYPE_HINT_RANGE)
+    {
+        Range range;
+        bSuccess = CoreFuncs::getRange(view, range);
+
+        char buffer[20];
+        for (size_t i = 0; bSuccess && i < range.size(); i++)
+        {
+            key.setValue(buffer, CoreFuncs::formatInteger(range.at(i), buffer), UTTE_VARIABLE_TYPE_HINT_NORMAL);
+            bSuccess = block(state, loop, body, result.segments);
+        }
+    }
+    else if (args.size() == 4)
+    {
+        auto* array = CoreFuncs::getArray(view);
+        bSuccess = array != nullptr;
+        for (size_t i = 0; bSuccess && i < array->size(); i++)
+        {
+            key.setValue((*array)[i], UTTE_VARIABLE_TYPE_HINT_NORMAL);
+            bSuccess = block(state, loop, body, result.segments);
+        }
+    }
+    else if (view.type == UTTE_VARIABLE_TYPE_HINT_OBJECT)
+    {
+        const ObjectType* type;
+        const void* object;
+        bSuccess = CoreFuncs::getObject(view, type, object);
+
+        utte_string buffer;
+        for (size_t i = 0; bSuccess && i < type->size(); i++)
+        {
+            auto value = type->get(object, i, buffer);
+            key.setValue(type->name(i), UTTE_VARIABLE_TYPE_HINT_NORMAL);
+            val.setValue(value.value.data(), value.value.size(), value.type);
+            bSuccess = block(state, loop, body, result.segments);
+        }
+    }
+    else
+    {
+        auto* map = CoreFuncs::getMap(view);
+        bSuccess = map != nullptr;
+        if (bSuccess)
+        {
+            for (auto& a : *map)
+            {
+                key.setValue(a.first, UTTE_VARIABLE_TYPE_HINT_NORMAL);
+                val.setValue(a.second, UTTE_VARIABLE_TYPE_HINT_NORMAL);
+                bSuccess = block(state, loop, body, result.segments);
+                if (!bSuccess)
+                    break;
+            }
+        }
+    }
+    --state.unrolling;
+    return bSuccess;
+}
+
+bool UTTE::Specializer::view(const std::vector<Value>& args, std::vector<UTTE::VariableView>& views) noexcept
+{
+    views.clear();
+    for (auto& a : args)
+    {
+        if (a.bBody)
+            views.push_back({ .value = a.text, .type = UTTE_VARIABLE_TYPE_HINT_FUNCTION });
+        else if (a.bStatic)
+            views.push_back({ .value = utte_string_view(a.variable.value.data(), a.variable.value.size()), .type = a.variable.type });
+        else
+            return false;
+    }
+    return true;
+}
+
+bool UTTE::Specializer::collapse(State& state, Value& value) noexcept
+{
+    value.bSegments = false;
+    if (std::all_of(value.segments.begin(), value.segments.end(), [](const Segment& a) -> bool { return a.bText; }))
+    {
+        value.bStatic = true;
+        value.variable = {};
+        for (auto& a : value.segments)
+            value.variable.value += a.text;
+        value.segments.clear();
+        return true;
+    }
+
+    // Wrapped in an "if" that is always true, so that the residual is still a single argument
+    utte_string body;
+    if (join(value.segments, true, body))
+        value.residual = "{{ if 1 {{ func " + body + "}} {{ func }} }}";
+    else if (state.unrolling == 0)
+        value.residual = value.original;
+    else
+        return false;
+    value.segments.clear();
+    return true;
+}
+
+bool UTTE::Specializer::join(std::vector<Segment>& segments, bool bBody, utte_string& out) noexcept
+{
+    const auto replace = [](Segment& segment) -> bool
+    {
+        if (!segment.bText || segment.bLiteral || segment.original.empty())
+            return false;
+        segment.text = std::move(segment.original);
+        segment.bText = false;
+        return true;
+    };
+
+    // Brackets in static values would start expressions, or end the body they're in
+    std::erase_if(segments, [](const Segment& a) -> bool { return a.bText && a.text.empty(); });
+    for (auto& a : segments)
+    {
+        bool bBrackets = a.text.find("{{") != utte_string::npos || (bBody && a.text.find("}}") != utte_string::npos);
+        if (a.bText && !a.bLiteral && bBrackets && !replace(a))
+            return false;
+    }
+
+    // Brackets at the end of a segment can pair with the ones at the start of the next one. A body ends at the first
+    // pair of closing brackets that isn't matched, except right after a nested expression, which skips the bracket
+    // after its own
+    for (size_t i = 0; i < segments.size();)
+    {
+        auto& a = segments[i];
+        bool bConflict;
+        if (i + 1 < segments.size())
+        {
+            auto& b = segments[i + 1];
+            bConflict = (a.text.back() == '{' && b.text.front() == '{') || (bBody && a.bText && a.text.back() == '}' && b.text.front() == '}');
+        }
+        else
+            bConflict = bBody && a.bText && a.text.back() == '}';
+
+        if (!bConflict)
+        {
+            ++i;
+            continue;
+        }
+        if (!replace(a) && (i + 1 == segments.size() || !replace(segments[i + 1])))
+            return false;
+
+        // The expression that replaced the text may conflict with the segment before it
+        i = i == 0 ? 0 : i - 1;
+    }
+
+    out.clear();
+    for (auto& a : segments)
+        out += a.text;
+    return true;
+}
+
+bool UTTE::Specializer::quote(utte_string_view value, bool bName, utte_string& out) noexcept
+{
+    bool bBrackets = value.find("{{") != utte_string_view::npos || value.find("}}") != utte_string_view::npos;
+    if (!value.empty() && !bBrackets && std::none_of(value.begin(), value.end(), Generator::isSpace) && !(bName && isSpecial(value)))
+    {
+        out.assign(value.data(), value.size());
+        return true;
+    }
+
+    // "raw" returns everything after the space that follows its name, up to the brackets that end it
+    if (bBrackets || (!value.empty() && value.back() == '}'))
+        return false;
+    out = "{{ raw ";
+    out.append(value.data(), value.size());
+    out += "}}";
+    return true;
+}
+
+bool UTTE::Specializer::isSpecial(utte_string_view name) noexcept
+{
+    Symbol symbol = SymbolTable::find(name);
+    return symbol == UTTE_SYMBOL_FUNC || symbol == UTTE_SYMBOL_RAW || symbol == UTTE_SYMBOL_COMMENT;
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+#pragma once
+#include "Generator.hpp"
+#include "Program.hpp"
+
+namespace UTTE
+{
+    /**
+     * @brief Partially evaluates compiled templates against the variables and functions that are marked static, see
+     * Function::bStatic. Expressions that only depend on static values and builtins are replaced with their result,
+     * the branches of "if", "cond" and "switch" that aren't taken are pruned, and "for" loops over static arrays, maps,
+     * ranges and objects are unrolled. Every other expression is kept with its static arguments substituted, so the
+     * residual template renders the same as the original once the dynamic variables are bound. Works on the bytecode,
+     * so arguments are cut exactly like the Compiler cuts them. A value that can't be written back as text, like an
+     * array, or a string that would change how the residual is parsed, is left as the expression it came from
+     */
+    class MLS_PUBLIC_API Specializer
+    {
+    public:
+        /**
+         * @brief Specializes a compiled template
+         * @param generator - The generator whose static variables and functions are substituted
+         * @param program - The compiled template
+         * @param residual - The residual template. Any previous contents are discarded
+         */
+        static void specialize(Generator& generator, const ProgramView& program, utte_string& residual) noexcept;
+    private:
+        struct State
+        {
+            const ProgramView& program;
+
+            // The number of loops whose bodies are being unrolled. Expressions can't be left as they were in these
+            // bodies, since they may use the variables of the loops, so if any of them has to, the loop isn't unrolled
+            size_t unrolling = 0;
+
+            // Whether the residual of pruned branches and unrolled loops is put in place in the template, instead of
+            // being wrapped in an "if". Only turned off if putting them in place would change how the template is cut
+            bool bInline = true;
+
+            // How deep bodies are nested, bodies deeper than the max depth of the generator are left as they were
+            size_t depth = 0;
+            size_t maxDepth = 0;
+        };
+
+        // A piece of a residual template, see join
+        struct Segment
+        {
+            utte_string text;
+
+            // Set for text, as opposed to an expression
+            bool bText = true;
+            // Set for the text of the template itself, which is never replaced
+            bool bLiteral = false;
+
+            // The expression a static value came from, which replaces it if it can't be put in place as it is. Empty if
+            // the expression can't be used instead
+            utte_string original;
+        };
+
+        // The result of an expression, or an argument of one
+        struct Value
+        {
+            // Set if the value is known
+            bool bStatic = false;
+            Variable variable{};
+
+            // Set for the bodies of "func" expressions, whose code starts at "body". How they're specialized depends on
+            // the function they're passed to
+            bool bBody = false;
+            uint32_t body = 0;
+            utte_string_view text;
+
+            // Set for literals cut from the template, as opposed to the results of expressions
+            bool bLiteral = false;
+
+            // Set for comments, which don't produce a value
+            bool bNone = false;
+
+            // Set for pruned branches and unrolled loops, which render to these segments
+            bool bSegments = false;
+            std::vector<Segment> segments;
+
+            // The expression as it was written, and the residual expression if the value isn't known
+            utte_string original;
+            utte_string residual;
+        };
+
+        // Specializes the code of a template or a body, up to its UTTE_OP_RETURN. Returns false if an expression had to
+        // be left as it was while unrolling a loop, or if the body is nested too deep
+        static bool block(State& state, Generator& scope, uint32_t pc, std::vector<Segment>& segments) noexcept;
+
+        // Specializes the expression whose UTTE_OP_FRAME is at "pc", and moves "pc" past its call
+        static bool expression(State& state, Generator& scope, uint32_t& pc, Value& result) noexcept;
+
+        // Evaluates a call whose arguments were specialized, or makes its residual
+        static bool call(State& state, Generator& scope, std::vector<Value>& args, Value& result) noexcept;
+        static bool residualize(State& state, Generator& scope, const Function* f, std::vector<Value>& args, Value& result) noexcept;
+
+        // Unrolls a "for" loop over a static collection into the segments of "result". Returns false if it can't be
+        static bool unroll(State& state, Generator& scope, std::vector<Value>& args, Value& result) noexcept;
+
+        // Makes views of the arguments of a call, with bodies as functions. Returns false if any argument isn't known
+        static bool view(const std::vector<Value>& args, std::vector<VariableView>& views) noexcept;
+
+        // Turns the segments of a pruned branch or an unrolled loop that is an argument of another expression into a
+        // value
+        static bool collapse(State& state, Value& value) noexcept;
+
+        // Joins segments into the text of a template, or of the body of a function if "bBody" is set. Static values that
+        // would change how the text is cut are replaced with their original expression. Returns false if that's not
+        // possible
+        static bool join(std::vector<Segment>& segments, bool bBody, utte_string& out) noexcept;
+
+        // Writes a value as a single argument, either as a literal or as a "raw" expression
+        static bool quote(utte_string_view value, bool bName, utte_string& out) noexcept;
+
+        // Checks if a name is one of the functions whose argument is cut as a body, see Generator::specialFunctions
+        static bool isSpecial(utte_string_view name) noexcept;
+    };
+}
\ No newline at end of file
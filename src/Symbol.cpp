@@ -0,0 +1,126 @@
+#include "Symbol.hpp"
+#include <functional>
+
+UTTE::Symbol UTTE::SymbolTable::intern(std::string_view name) noexcept
+{
+    auto& table = instance();
+    uint64_t hash = std::hash<std::string_view>{}(name);
+    Symbol symbol = table.lookup(name, hash);
+    if (symbol != UTTE_SYMBOL_INVALID)
+        return symbol;
+
+    std::lock_guard<std::mutex> lock(table.mutex);
+
+    // Another thread may have interned the name while we were waiting for the lock
+    symbol = table.lookup(name, hash);
+    return symbol != UTTE_SYMBOL_INVALID ? symbol : table.insert(name, hash);
+}
+
+UTTE::Symbol UTTE::SymbolTable::intern(const utte_string& name) noexcept
+{
+    return intern(std::string_view(name.data(), name.size()));
+}
+
+UTTE::Symbol UTTE::SymbolTable::find(std::string_view name) noexcept
+{
+    return instance().lookup(name, std::hash<std::string_view>{}(name));
+}
+
+UTTE::Symbol UTTE::SymbolTable::find(const utte_string& name) noexcept
+{
+    return find(std::string_view(name.data(), name.size()));
+}
+
+const utte_string& UTTE::SymbolTable::name(UTTE::Symbol symbol) noexcept
+{
+    auto& table = instance();
+    if (symbol >= table.count.load(std::memory_order_acquire))
+        symbol = UTTE_SYMBOL_INVALID;
+    return table.chunks[symbol >> chunkBits].load(std::memory_order_acquire)[symbol & (chunkSize - 1)];
+}
+
+size_t UTTE::SymbolTable::size() noexcept
+{
+    return instance().count.load(std::memory_order_acquire);
+}
+
+UTTE::Symbol UTTE::SymbolTable::lookup(std::string_view name, uint64_t hash) const noexcept
+{
+    const Index* current = index.load(std::memory_order_acquire);
+    uint64_t tag = hash >> 32;
+    for (size_t i = hash & current->mask;; i = (i + 1) & current->mask)
+    {
+        uint64_t slot = current->slots[i].load(std::memory_order_acquire);
+        if (slot == 0)
+            return UTTE_SYMBOL_INVALID;
+        if ((slot >> 32) != tag)
+            continue;
+
+        // The name was written before the slot was published
+        auto symbol = static_cast<Symbol>(slot);
+        if (chunks[symbol >> chunkBits].load(std::memory_order_acquire)[symbol & (chunkSize - 1)] == name)
+            return symbol;
+    }
+}
+
+UTTE::Symbol UTTE::SymbolTable::insert(std::string_view name, uint64_t hash) noexcept
+{
+    size_t symbol = count.load(std::memory_order_relaxed);
+    if (symbol >= maxChunks * chunkSize)
+        return UTTE_SYMBOL_INVALID;
+
+    if ((symbol & (chunkSize - 1)) == 0)
+    {
+        ownedChunks.push_back(std::make_unique<utte_string[]>(chunkSize));
+        chunks[symbol >> chunkBits].store(ownedChunks.back().get(), std::memory_order_release);
+    }
+    chunks[symbol >> chunkBits].load(std::memory_order_relaxed)[symbol & (chunkSize - 1)].assign(name.data(), name.size());
+
+    // The invalid symbol is never looked up, so it's not indexed
+    if (symbol != UTTE_SYMBOL_INVALID)
+    {
+        // Readers may still be probing the old index, so the new one is filled before it's published. A reader that
+        // misses a name because it's only in the new one was racing with "intern" anyway
+        const Index* current = index.load(std::memory_order_relaxed);
+        if (current == nullptr || symbol * 2 > current->mask)
+        {
+            auto grown = std::make_unique<Index>();
+            size_t capacity = current == nullptr ? 256 : (current->mask + 1) * 2;
+            grown->mask = capacity - 1;
+            grown->slots = std::make_unique<std::atomic<uint64_t>[]>(capacity);
+            for (size_t i = 1; i < symbol; i++)
+                place(*grown, std::hash<std::string_view>{}(chunks[i >> chunkBits].load(std::memory_order_relaxed)[i & (chunkSize - 1)]), static_cast<Symbol>(i));
+
+            current = ownedIndices.emplace_back(std::move(grown)).get();
+            index.store(current, std::memory_order_release);
+        }
+        place(*current, hash, static_cast<Symbol>(symbol));
+    }
+    count.store(symbol + 1, std::memory_order_release);
+    return static_cast<Symbol>(symbol);
+}
+
+void UTTE::SymbolTable::place(const Index& index, uint64_t hash, UTTE::Symbol symbol) noexcept
+{
+    size_t i = hash & index.mask;
+    while (index.slots[i].load(std::memory_order_relaxed) != 0)
+        i = (i + 1) & index.mask;
+    index.slots[i].store((hash >> 32 << 32) | symbol, std::memory_order_release);
+}
+
+UTTE::SymbolTable::SymbolTable() noexcept
+    : chunks(std::make_unique<std::atomic<utte_string*>[]>(maxChunks))
+{
+    // The order here has to match the BuiltinSymbol enum. The invalid symbol is mapped to an empty string, which is
+    // never looked up, since empty arguments are never cut
+    for (std::string_view a : { "", "func", "raw", "comment", "if", "switch", "at", "cond", "for", "==", "!=", "!", "&&",
+                                "||", "list", "dict", "include", "range", "length", "slice", "join", "sort", "reverse",
+                                "keys", "values", "contains", "filter" })
+        insert(a, std::hash<std::string_view>{}(a));
+}
+
+UTTE::SymbolTable& UTTE::SymbolTable::instance() noexcept
+{
+    static SymbolTable table;
+    return table;
+}
\ No newline at end of file
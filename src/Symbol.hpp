@@ -0,0 +1,107 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include "CoreFuncs.hpp"
+
+namespace UTTE
+{
+    /**
+     * @brief A symbol is a small integer that identifies an interned name. Two names are equal if and only if their
+     * symbols are equal, so lookups and comparisons can be done on integers instead of strings. Symbols are
+     * process-wide and stay valid until the process exits.
+     */
+    typedef uint32_t Symbol;
+
+    // Symbols of the builtin functions. These are interned when the symbol table is created, so they are constants
+    enum BuiltinSymbol : Symbol
+    {
+        UTTE_SYMBOL_INVALID = 0,
+        UTTE_SYMBOL_FUNC,
+        UTTE_SYMBOL_RAW,
+        UTTE_SYMBOL_COMMENT,
+        UTTE_SYMBOL_IF,
+        UTTE_SYMBOL_SWITCH,
+        UTTE_SYMBOL_AT,
+        UTTE_SYMBOL_COND,
+        UTTE_SYMBOL_FOR,
+        UTTE_SYMBOL_BOOL_EQUAL,
+        UTTE_SYMBOL_BOOL_NOT_EQUAL,
+        UTTE_SYMBOL_BOOL_NOT,
+        UTTE_SYMBOL_BOOL_AND,
+        UTTE_SYMBOL_BOOL_OR,
+        UTTE_SYMBOL_LIST,
+        UTTE_SYMBOL_DICT,
+        UTTE_SYMBOL_INCLUDE,
+        UTTE_SYMBOL_RANGE,
+        UTTE_SYMBOL_LENGTH,
+        UTTE_SYMBOL_SLICE,
+        UTTE_SYMBOL_JOIN,
+        UTTE_SYMBOL_SORT,
+        UTTE_SYMBOL_REVERSE,
+        UTTE_SYMBOL_KEYS,
+        UTTE_SYMBOL_VALUES,
+        UTTE_SYMBOL_CONTAINS,
+        UTTE_SYMBOL_FILTER,
+        UTTE_SYMBOL_BUILTIN_COUNT,
+    };
+
+    /**
+     * @brief A process-wide, thread-safe table of interned names. Lookups don't take a lock, since they're made by every
+     * dynamic call on every thread: names are appended to chunks that never move, and the hash index is replaced by a
+     * larger copy when it fills up, so readers only ever see complete entries. Only "intern" takes a lock, and only for
+     * names that are new
+     */
+    class MLS_PUBLIC_API SymbolTable
+    {
+    public:
+        // Returns the symbol for the given name, adding the name to the table if it is not interned yet. Names are never
+        // removed, so only names that are part of templates or registered functions should be interned
+        static Symbol intern(std::string_view name) noexcept;
+        static Symbol intern(const utte_string& name) noexcept;
+
+        // Returns the symbol for the given name, or UTTE_SYMBOL_INVALID if the name was never interned
+        static Symbol find(std::string_view name) noexcept;
+        static Symbol find(const utte_string& name) noexcept;
+
+        // Returns the name of a symbol. The reference stays valid until the process exits
+        static const utte_string& name(Symbol symbol) noexcept;
+
+        // The number of symbols, including UTTE_SYMBOL_INVALID. It only grows, so names that weren't interned when it
+        // was read may have been since it changed
+        static size_t size() noexcept;
+    private:
+        // An open addressed hash index, at most half full. Every slot holds the upper half of the hash of a name and its
+        // symbol, or 0 if it's empty
+        struct Index
+        {
+            size_t mask = 0;
+            std::unique_ptr<std::atomic<uint64_t>[]> slots;
+        };
+
+        static constexpr size_t chunkBits = 12;
+        static constexpr size_t chunkSize = size_t(1) << chunkBits;
+        static constexpr size_t maxChunks = 4096;
+
+        SymbolTable() noexcept;
+        static SymbolTable& instance() noexcept;
+
+        Symbol lookup(std::string_view name, uint64_t hash) const noexcept;
+
+        // Appends a name that isn't in the table yet. Called with the lock held
+        Symbol insert(std::string_view name, uint64_t hash) noexcept;
+        static void place(const Index& index, uint64_t hash, Symbol symbol) noexcept;
+
+        std::mutex mutex;
+
+        // The names, in chunks that are published once they're allocated. Only the first "count" names are complete
+        std::unique_ptr<std::atomic<utte_string*>[]> chunks;
+        std::vector<std::unique_ptr<utte_string[]>> ownedChunks;
+        std::atomic<size_t> count = 0;
+
+        // Replaced indices are kept, since readers may still be probing them
+        std::atomic<const Index*> index = nullptr;
+        std::vector<std::unique_ptr<Index>> ownedIndices;
+    };
+}
\ No newline at end of file
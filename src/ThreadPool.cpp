@@ -0,0 +1,120 @@
+#include "ThreadPool.hpp"
+
+// The pool and index of the worker running on the current thread, used to submit tasks to its own queue
+static thread_local const UTTE::ThreadPool* currentPool = nullptr;
+static thread_local size_t currentWorker = 0;
+
+UTTE::ThreadPool::ThreadPool(size_t threads) noexcept
+{
+    if (threads == 0)
+        threads = std::thread::hardware_concurrency();
+    if (threads == 0)
+        threads = 1;
+
+    workers.reserve(threads);
+    for (size_t i = 0; i < threads; i++)
+        workers.push_back(std::make_unique<Worker>());
+
+    // Start the threads only once every worker exists, since they steal from each other
+    for (size_t i = 0; i < threads; i++)
+        workers[i]->thread = std::thread(&ThreadPool::work, this, i);
+}
+
+UTTE::ThreadPool::~ThreadPool() noexcept
+{
+    wait();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        bStop = true;
+    }
+    workAvailable.notify_all();
+
+    for (auto& a : workers)
+        a->thread.join();
+}
+
+void UTTE::ThreadPool::submit(std::function<void()> task) noexcept
+{
+    // Count the task first, so that the counters never drop below 0 when a worker takes it right away
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++queued;
+        ++pending;
+    }
+
+    size_t index = currentPool == this ? currentWorker : next.fetch_add(1, std::memory_order_relaxed) % workers.size();
+    {
+        std::lock_guard<std::mutex> lock(workers[index]->mutex);
+        workers[index]->tasks.push_back(std::move(task));
+    }
+    workAvailable.notify_one();
+}
+
+void UTTE::ThreadPool::wait() noexcept
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    allDone.wait(lock, [this]() -> bool { return pending == 0; });
+}
+
+size_t UTTE::ThreadPool::size() const noexcept
+{
+    return workers.size();
+}
+
+bool UTTE::ThreadPool::take(size_t index, std::function<void()>& task) noexcept
+{
+    {
+        auto& worker = *workers[index];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (!worker.tasks.empty())
+        {
+            task = std::move(worker.tasks.back());
+            worker.tasks.pop_back();
+            return true;
+        }
+    }
+
+    for (size_t i = 1; i < workers.size(); i++)
+    {
+        auto& victim = *workers[(index + i) % workers.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty())
+        {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void UTTE::ThreadPool::work(size_t index) noexcept
+{
+    currentPool = this;
+    currentWorker = index;
+
+    std::function<void()> task;
+    while (true)
+    {
+        if (take(index, task))
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                --queued;
+            }
+            task();
+            task = nullptr;
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--pending == 0)
+                allDone.notify_all();
+            continue;
+        }
+
+        // A task that is counted as queued but wasn't found is being taken by another worker right now, so look again
+        std::unique_lock<std::mutex> lock(mutex);
+        workAvailable.wait(lock, [this]() -> bool { return queued != 0 || bStop; });
+        if (bStop && queued == 0)
+            return;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Common.h"
+
+namespace UTTE
+{
+    /**
+     * @brief A work-stealing thread pool. Every worker has its own queue, takes tasks from the back of it, and when it
+     * runs out, steals from the front of the queues of the other workers, so uneven tasks, like pages of very different
+     * sizes, keep all workers busy. Tasks submitted by a worker go to its own queue, other tasks are spread between the
+     * workers. All members are thread-safe
+     */
+    class MLS_PUBLIC_API ThreadPool
+    {
+    public:
+        // Starts "threads" workers, or one per hardware thread if it's 0
+        explicit ThreadPool(size_t threads = 0) noexcept;
+
+        // Waits for all submitted tasks, then stops the workers
+        ~ThreadPool() noexcept;
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        void submit(std::function<void()> task) noexcept;
+
+        // Waits until all submitted tasks are done, including tasks submitted by other tasks in the meantime
+        void wait() noexcept;
+
+        // The number of workers
+        size_t size() const noexcept;
+    private:
+        struct Worker
+        {
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+            std::thread thread;
+        };
+
+        // Takes a task from the back of the worker's queue, or steals one from the front of another queue
+        bool take(size_t index, std::function<void()>& task) noexcept;
+        void work(size_t index) noexcept;
+
+        std::vector<std::unique_ptr<Worker>> workers;
+
+        // Guards the counters below, so that workers can't miss a wakeup
+        std::mutex mutex;
+        std::condition_variable workAvailable;
+        std::condition_variable allDone;
+        size_t queued = 0;
+        size_t pending = 0;
+        bool bStop = false;
+
+        // The worker that the next task submitted from outside the pool goes to
+        std::atomic<size_t> next = 0;
+    };
+}
\ No newline at end of file
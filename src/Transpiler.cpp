@@ -0,0 +1,136 @@
+#include "Transpiler.hpp"
+#include <algorithm>
+
+void UTTE::Transpiler::transpile(const UTTE::Program& program, utte_string_view name, utte_string& out) noexcept
+{
+    // Every body starts at index 0 or at the target of a PUSH_BODY instruction, and runs up to its RETURN instruction
+    std::vector<uint32_t> bodies{ 0 };
+    for (auto& a : program.code)
+        if (a.op == UTTE_OP_PUSH_BODY)
+            bodies.push_back(a.b);
+
+    const auto bodyName = [&](uint32_t start) -> utte_string
+    {
+        return "body" + std::to_string(std::find(bodies.begin(), bodies.end(), start) - bodies.begin());
+    };
+
+    out += "// Generated by utte-compile, do not edit\n"
+           "#include \"Context.hpp\"\n"
+           "#include <mutex>\n\n";
+
+    out += "namespace ";
+    out.append(name.data(), name.size());
+    out += "\n{\n"
+           "    UTTE::ParseResultStatus render(UTTE::Context& context, utte_string& sink) noexcept;\n"
+           "}\n\n"
+           "namespace\n{\n";
+
+    // The literal pool of the program, with a terminator, since the array can't be empty
+    utte_string bytes(program.strings.data(), program.strings.size());
+    bytes += '\0';
+
+    out += "    const char literals[] =\n    {";
+    for (size_t i = 0; i < bytes.size(); i++)
+    {
+        out += i % 16 == 0 ? "\n        " : " ";
+        out += std::to_string(static_cast<int>(static_cast<signed char>(bytes[i])));
+        out += ",";
+    }
+    out += "\n    };\n\n";
+
+    out += "    // Symbols of the called functions, interned on the first render\n"
+           "    UTTE::Symbol symbols[" + std::to_string(std::max<size_t>(program.names.size(), 1)) + "];\n"
+           "    std::once_flag symbolsFlag;\n\n"
+           "    void resolveSymbols() noexcept\n    {\n";
+    for (size_t i = 0; i < program.names.size(); i++)
+    {
+        out += "        symbols[" + std::to_string(i) + "] = UTTE::SymbolTable::intern(";
+        literal(program, program.names[i], out);
+        out += ");\n";
+    }
+    out += "    }\n";
+
+    if (bodies.size() > 1)
+        out += "\n";
+    for (size_t i = 1; i < bodies.size(); i++)
+        out += "    UTTE::ParseResultStatus body" + std::to_string(i) + "(UTTE::Context& context, utte_string& sink) noexcept;\n";
+
+    for (size_t i = 0; i < bodies.size(); i++)
+    {
+        if (i == 0)
+        {
+            out += "}\n\nUTTE::ParseResultStatus ";
+            out.append(name.data(), name.size());
+            out += "::render(UTTE::Context& context, utte_string& sink) noexcept\n{\n"
+                   "    std::call_once(symbolsFlag, resolveSymbols);\n";
+        }
+        else
+        {
+            // Bodies that only hold text don't use the context, and empty bodies don't use the sink either. Their names
+            // are left out, so that the generated code builds without warnings
+            bool bContext = false;
+            bool bSink = false;
+            for (auto* it = program.code.data() + bodies[i]; it->op != UTTE_OP_RETURN; it++)
+            {
+                bContext |= it->op != UTTE_OP_TEXT;
+                bSink |= it->op == UTTE_OP_TEXT || it->op == UTTE_OP_CALL || it->op == UTTE_OP_CALL_DYNAMIC;
+            }
+
+            if (i == 1)
+                out += "namespace\n{\n";
+            out += "    UTTE::ParseResultStatus body" + std::to_string(i) + "(UTTE::Context&" + (bContext ? " context" : "")
+                + ", utte_string&" + (bSink ? " sink" : "") + ") noexcept\n    {\n";
+        }
+        const char* indent = i == 0 ? "    " : "        ";
+
+        for (auto* it = program.code.data() + bodies[i]; it->op != UTTE_OP_RETURN; it++)
+        {
+            out += indent;
+            switch (it->op)
+            {
+            case UTTE_OP_TEXT:
+                out += "sink.append(";
+                literal(program, it->a, out);
+                out += ");\n";
+                break;
+            case UTTE_OP_FRAME:
+                out += "context.frame();\n";
+                break;
+            case UTTE_OP_PUSH:
+                out += "context.push(";
+                literal(program, it->a, out);
+                out += ");\n";
+                break;
+            case UTTE_OP_PUSH_BODY:
+                out += "context.push(";
+                literal(program, it->a, out);
+                out += ", " + bodyName(it->b) + ");\n";
+                break;
+            case UTTE_OP_CALL:
+            case UTTE_OP_CALL_DYNAMIC:
+            {
+                utte_string symbol = it->op == UTTE_OP_CALL ? "symbols[" + std::to_string(it->a) + "]" : "UTTE::UTTE_SYMBOL_INVALID";
+                out += "if (auto status = context.call(" + symbol + ", " + ((it->b & UTTE_CALL_FLAG_EMIT) ? "true" : "false")
+                    + ", sink); status != UTTE_PARSE_STATUS_SUCCESS)\n";
+                out += indent;
+                out += "    return status;\n";
+                break;
+            }
+            default:
+                break;
+            }
+        }
+        out += indent;
+        out += i == 0 ? "return context.end(sink);\n" : "return UTTE_PARSE_STATUS_SUCCESS;\n";
+        out += i == 0 ? "}\n" : "    }\n";
+        if (i == 0 && bodies.size() > 1)
+            out += "\n";
+    }
+    if (bodies.size() > 1)
+        out += "}\n";
+}
+
+void UTTE::Transpiler::literal(const UTTE::Program& program, uint32_t index, utte_string& out) noexcept
+{
+    out += "utte_string_view(literals + " + std::to_string(program.literals[index].offset) + ", " + std::to_string(program.literals[index].size) + ")";
+}
\ No newline at end of file
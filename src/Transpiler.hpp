@@ -0,0 +1,31 @@
+#pragma once
+#include "Compiler.hpp"
+
+namespace UTTE
+{
+    /**
+     * @brief Turns compiled templates into C++ source code, used by utte-compile. The generated file defines
+     * "UTTE::ParseResultStatus <name>::render(UTTE::Context& context, utte_string& sink)", which renders the same result
+     * as Generator::parse with the variables and functions of the context's generator. Literals are stored in a static
+     * byte array, names of functions are interned once on the first render, and every "func" body is its own function.
+     * Calls still go through the Context runtime, see its notes on what that costs.
+     *
+     * Control flow is not generated as C++ statements, and names are not resolved to slots. "if", "for" and every other
+     * name can be shadowed by a variable or replaced by a plugin at any point of a render, so the function an expression
+     * calls is only known once it's called. The builtin control flow functions run the compiled bodies directly instead.
+     * utte-check builds a corpus of templates compiled with this and checks that they render like Generator::parse
+     */
+    class MLS_PUBLIC_API Transpiler
+    {
+    public:
+        /**
+         * @brief Generates the C++ source code of a compiled template
+         * @param program - The compiled template
+         * @param name - The namespace the render function is put in, has to be a valid C++ identifier
+         * @param out - The generated code is appended to this string
+         */
+        static void transpile(const Program& program, utte_string_view name, utte_string& out) noexcept;
+    private:
+        static void literal(const Program& program, uint32_t index, utte_string& out) noexcept;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,249 @@
+#include "UTF8.hpp"
+#include <bit>
+#include <cstring>
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define UTTE_UTF8_SSE2
+#endif
+
+// Strings shorter than this are always counted from the start, since building a sparse index costs more than that
+static constexpr size_t indexThreshold = 256;
+static constexpr size_t indexStride = 64;
+
+// The number of words that "fingerprint" reads, spread over the whole string
+static constexpr size_t fingerprintWords = 32;
+
+// The indices of the strings that were indexed last, on this thread. An entry keeps a copy of its string and is only
+// used for a string with the same contents, since the memory of a string is often reused for another one of the same
+// size, like the value of a loop variable. The fingerprint rules out most other strings without comparing all of them
+struct SparseIndex
+{
+    utte_string contents;
+    uint64_t fingerprint = 0;
+
+    // The offset of every "indexStride"th code point
+    std::vector<size_t> marks;
+};
+static thread_local SparseIndex indices[4];
+static thread_local size_t nextIndex = 0;
+
+// The number of IndexScopes on this thread
+static thread_local size_t scopes = 0;
+
+static uint64_t load(const unsigned char* data) noexcept
+{
+    uint64_t word;
+    std::memcpy(&word, data, sizeof(word));
+    return word;
+}
+
+// Hashes "fingerprintWords" words at even distances, from the first to the last one, so that most strings of the same
+// size are told apart without reading all of them. Strings that only differ between the sampled words have the same
+// fingerprint, so it's only used to skip entries. Only called for strings of at least "indexThreshold" bytes
+static uint64_t fingerprint(utte_string_view str) noexcept
+{
+    auto* data = reinterpret_cast<const unsigned char*>(str.data());
+    size_t last = str.size() - sizeof(uint64_t);
+    uint64_t result = str.size();
+    for (size_t i = 0; i < fingerprintWords; i++)
+    {
+        result ^= load(data + last * i / (fingerprintWords - 1));
+        result *= 0x9E3779B97F4A7C15ull;
+        result ^= result >> 32;
+    }
+    return result;
+}
+
+// Returns the number of bytes in a word that start a code point, which are all bytes that are not 10xxxxxx
+static size_t countLeads(uint64_t word) noexcept
+{
+    return 8 - static_cast<size_t>(std::popcount(word & ~(word << 1) & 0x8080808080808080ull));
+}
+
+static bool isLead(unsigned char c) noexcept
+{
+    return (c & 0xC0) != 0x80;
+}
+
+// Returns the length of the valid multibyte sequence at "data", or 0 if it's invalid. Follows table 3-7 of the Unicode
+// standard
+static size_t sequenceLength(const unsigned char* data, size_t size) noexcept
+{
+    unsigned char c = data[0];
+    unsigned char low = 0x80;
+    unsigned char high = 0xBF;
+    size_t length;
+    if (c >= 0xC2 && c <= 0xDF)
+        length = 2;
+    else if (c >= 0xE0 && c <= 0xEF)
+    {
+        length = 3;
+        if (c == 0xE0)
+            low = 0xA0;
+        else if (c == 0xED)
+            high = 0x9F;
+    }
+    else if (c >= 0xF0 && c <= 0xF4)
+    {
+        length = 4;
+        if (c == 0xF0)
+            low = 0x90;
+        else if (c == 0xF4)
+            high = 0x8F;
+    }
+    else
+        return 0;
+
+    if (size < length || data[1] < low || data[1] > high)
+        return 0;
+    for (size_t i = 2; i < length; i++)
+        if ((data[i] & 0xC0) != 0x80)
+            return 0;
+    return length;
+}
+
+size_t UTTE::UTF8::validate(utte_string_view str) noexcept
+{
+    auto* data = reinterpret_cast<const unsigned char*>(str.data());
+    size_t size = str.size();
+    size_t i = 0;
+    while (i < size)
+    {
+#ifdef UTTE_UTF8_SSE2
+        while (i + 16 <= size && _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i))) == 0)
+            i += 16;
+#endif
+        while (i + 8 <= size && (load(data + i) & 0x8080808080808080ull) == 0)
+            i += 8;
+        while (i < size && data[i] < 0x80)
+            ++i;
+        if (i == size)
+            break;
+
+        size_t length = sequenceLength(data + i, size - i);
+        if (length == 0)
+            return i;
+        i += length;
+    }
+    return size;
+}
+
+size_t UTTE::UTF8::repair(utte_string& str) noexcept
+{
+    utte_string_view view(str.data(), str.size());
+    size_t i = validate(view);
+    if (i == str.size())
+        return 0;
+
+    utte_string result;
+    result.reserve(str.size() + 16);
+    result.append(str, 0, i);
+
+    size_t replaced = 0;
+    while (i < view.size())
+    {
+        result.append("\xEF\xBF\xBD");
+        ++replaced;
+        ++i;
+
+        size_t valid = validate(view.substr(i));
+        result.append(view.data() + i, valid);
+        i += valid;
+    }
+    str = std::move(result);
+    return replaced;
+}
+
+size_t UTTE::UTF8::length(utte_string_view str) noexcept
+{
+    auto* data = reinterpret_cast<const unsigned char*>(str.data());
+    size_t result = 0;
+    size_t i = 0;
+    for (; i + 8 <= str.size(); i += 8)
+        result += countLeads(load(data + i));
+    for (; i < str.size(); i++)
+        result += isLead(data[i]);
+    return result;
+}
+
+size_t UTTE::UTF8::offset(utte_string_view str, size_t index) noexcept
+{
+    return (str.size() < indexThreshold || index < indexStride) ? advance(str, 0, index) : offsetIndexed(str, index);
+}
+
+utte_string_view UTTE::UTF8::slice(utte_string_view str, size_t begin, size_t end) noexcept
+{
+    size_t first = offset(str, begin);
+    size_t last = end <= begin ? first : advance(str, first, end - begin);
+    return str.substr(first, last - first);
+}
+
+size_t UTTE::UTF8::advance(utte_string_view str, size_t from, size_t count) noexcept
+{
+    auto* data = reinterpret_cast<const unsigned char*>(str.data());
+    size_t i = from;
+
+    // Skip whole words while the code point is past them
+    for (; i + 8 <= str.size(); i += 8)
+    {
+        size_t leads = countLeads(load(data + i));
+        if (leads > count)
+            break;
+        count -= leads;
+    }
+
+    for (; i < str.size(); i++)
+    {
+        if (!isLead(data[i]))
+            continue;
+        if (count == 0)
+            return i;
+        --count;
+    }
+    return str.size();
+}
+
+size_t UTTE::UTF8::offsetIndexed(utte_string_view str, size_t index) noexcept
+{
+    uint64_t hash = fingerprint(str);
+    SparseIndex* entry = nullptr;
+    for (auto& a : indices)
+    {
+        if (a.fingerprint == hash && a.contents.size() == str.size() && std::memcmp(a.contents.data(), str.data(), str.size()) == 0)
+        {
+            entry = &a;
+            break;
+        }
+    }
+
+    if (entry == nullptr)
+    {
+        entry = &indices[nextIndex++ % std::size(indices)];
+        entry->contents.assign(str.data(), str.size());
+        entry->fingerprint = hash;
+        entry->marks.clear();
+        for (size_t i = advance(str, 0, 0); i < str.size(); i = advance(str, i, indexStride))
+            entry->marks.push_back(i);
+    }
+
+    size_t mark = index / indexStride;
+    return mark < entry->marks.size() ? advance(str, entry->marks[mark], index % indexStride) : str.size();
+}
+
+void UTTE::UTF8::releaseIndices() noexcept
+{
+    for (auto& a : indices)
+        a = SparseIndex{};
+    nextIndex = 0;
+}
+
+UTTE::UTF8::IndexScope::IndexScope() noexcept
+{
+    ++scopes;
+}
+
+UTTE::UTF8::IndexScope::~IndexScope() noexcept
+{
+    if (--scopes == 0)
+        releaseIndices();
+}
\ No newline at end of file
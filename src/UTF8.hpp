@@ -0,0 +1,55 @@
+#pragma once
+#include "CoreFuncs.hpp"
+
+namespace UTTE
+{
+    /**
+     * @brief Validation, repair and code point indexing of UTF-8 strings. Validation skips ASCII 16 bytes at a time with
+     * SSE2, or 8 bytes at a time elsewhere, and checks multibyte sequences one by one. Indexing counts the bytes that
+     * start a code point 8 at a time, and long strings that are indexed repeatedly get a sparse index of every 64th code
+     * point, so that "at" in a loop doesn't decode the string from the start on every call. Indices are kept per thread
+     * for as long as an IndexScope exists on it, every render holds one
+     */
+    class MLS_PUBLIC_API UTF8
+    {
+    public:
+        // Releases the sparse indices built on the calling thread when the outermost scope on it is destroyed, so that
+        // they don't outlive the render that built them. Without a scope, an index only lasts until the next lookup of
+        // another string
+        struct MLS_PUBLIC_API IndexScope
+        {
+            IndexScope() noexcept;
+            ~IndexScope() noexcept;
+
+            IndexScope(const IndexScope&) = delete;
+            IndexScope& operator=(const IndexScope&) = delete;
+        };
+
+        // Returns the offset of the first byte that is not part of a valid sequence, or the size of the string if all of
+        // it is valid. Overlong encodings, surrogates and code points above U+10FFFF are invalid
+        static size_t validate(utte_string_view str) noexcept;
+
+        // Replaces every invalid byte with U+FFFD. Returns the number of bytes replaced
+        static size_t repair(utte_string& str) noexcept;
+
+        // Returns the number of code points. Code points are counted by the bytes that start them, so stray
+        // continuation bytes of invalid strings are counted with the code point before them
+        static size_t length(utte_string_view str) noexcept;
+
+        // Returns the offset of the byte that starts the code point at the given index, or the size of the string if
+        // the index is past the last code point
+        static size_t offset(utte_string_view str, size_t index) noexcept;
+
+        // Returns the code points from "begin" up to, but not including, "end"
+        static utte_string_view slice(utte_string_view str, size_t begin, size_t end) noexcept;
+    private:
+        // Returns the offset of the "count"th code point after the one starting at "from"
+        static size_t advance(utte_string_view str, size_t from, size_t count) noexcept;
+
+        // Returns the offset of the code point at the given index, using and building the sparse index of the string
+        static size_t offsetIndexed(utte_string_view str, size_t index) noexcept;
+
+        // Frees the sparse indices of the calling thread
+        static void releaseIndices() noexcept;
+    };
+}
\ No newline at end of file
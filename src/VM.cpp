@@ -0,0 +1,602 @@
+#include "VM.hpp"
+
+// Computed goto makes every instruction jump straight to the next one, instead of going through a single switch
+#if defined(__GNUC__) || defined(__clang__)
+    #define UTTE_VM_COMPUTED_GOTO
+#endif
+
+// A computed goto doesn't destroy the objects it jumps out of, so instructions that have locals with destructors go
+// through UTTE_VM_NEXT, which does
+#ifdef UTTE_VM_COMPUTED_GOTO
+    #define UTTE_VM_CASE(x) label_##x:
+    #define UTTE_VM_DISPATCH() instruction = pc++; goto *dispatch[instruction->op]
+    #define UTTE_VM_NEXT() goto next
+#else
+    #define UTTE_VM_CASE(x) case x:
+    #define UTTE_VM_DISPATCH() continue
+    #define UTTE_VM_NEXT() continue
+#endif
+
+UTTE::ParseResultStatus UTTE::VM::run(UTTE::Generator& generator, const UTTE::ProgramView& program, utte_string& output) noexcept
+{
+    return run(generator, program, output, nullptr);
+}
+
+void UTTE::VM::prefetch(UTTE::Generator& generator, const UTTE::ProgramView& program, UTTE::VM::Async& async) noexcept
+{
+    // The start of the arguments of every open expression, and whether they're all literals so far
+    struct Expression
+    {
+        size_t begin;
+        bool bLiteral;
+    };
+    std::vector<Expression> expressions;
+    std::vector<Variable> arguments;
+
+    for (const Instruction* pc = program.code; pc->op != UTTE_OP_RETURN; pc++)
+    {
+        switch (pc->op)
+        {
+        case UTTE_OP_FRAME:
+            expressions.push_back({ .begin = arguments.size(), .bLiteral = true });
+            break;
+        case UTTE_OP_PUSH:
+        case UTTE_OP_PUSH_BODY:
+        {
+            auto literal = program.literal(pc->a);
+            arguments.push_back({ .value = utte_string(literal.data(), literal.size()) });
+            break;
+        }
+        case UTTE_OP_CALL:
+        case UTTE_OP_CALL_DYNAMIC:
+        {
+            auto expression = expressions.back();
+            expressions.pop_back();
+
+            Function* f = pc->op == UTTE_OP_CALL && expression.bLiteral ? generator.findFunction(program.symbols[pc->a]) : nullptr;
+            if (f != nullptr && !f->bVariable && f->asyncFunction)
+            {
+                std::vector<Variable> args(std::make_move_iterator(arguments.begin() + static_cast<std::ptrdiff_t>(expression.begin)),
+                                           std::make_move_iterator(arguments.end()));
+                async.prefetched.push_back({ .call = pc, .function = f, .task = f->asyncFunction(std::move(args), &generator) });
+            }
+            arguments.resize(expression.begin);
+
+            // The result is an argument of the enclosing expression, which is only known once the program runs
+            if (!expressions.empty())
+                expressions.back().bLiteral = false;
+            break;
+        }
+        default:
+            break;
+        }
+    }
+}
+
+UTTE::ParseResultStatus UTTE::VM::run(UTTE::Generator& generator, const UTTE::ProgramView& program, utte_string& output, UTTE::VM::Async* async) noexcept
+{
+    size_t nextPrefetched = 0;
+
+    std::vector<Value> stack;
+    std::vector<size_t> arguments; // The height of the stack at the start of every expression that is being evaluated
+    std::vector<Frame> frames;
+    std::vector<VariableView> views;
+
+    // Loop scopes are reused between loops, so that nested loops don't create a new scope on every iteration
+    std::vector<std::unique_ptr<Generator>> scopes;
+
+    const ProgramView* current = &program;
+    const Instruction* pc = program.code;
+    const Instruction* instruction = nullptr;
+    Generator* scope = &generator;
+    utte_string* out = &output;
+
+    // Budgets are owned by the outermost generator. Without one, the only cost of the checks is testing the flag
+    Generator& root = generator.root();
+    const bool bBudgeted = root.bBudgeted;
+
+    // Like when parsing, every open expression counts against the max depth of the outermost generator, including the
+    // ones whose body is running, so that functions that parse a body continue from the same depth. Frames live on the
+    // heap, so the limit only guards against runaway nesting, like a partial that includes itself. Expressions that are
+    // still open when returning are given back
+    const size_t maxDepth = root.maxDepth;
+    struct Unwind
+    {
+        ~Unwind() noexcept
+        {
+            root.depth = depth;
+        }
+
+        Generator& root;
+        size_t depth;
+    } unwind{ root, root.depth };
+    const auto iterate = [&]() -> bool
+    {
+        return !bBudgeted || root.charge(0, 1, out->size());
+    };
+
+    // Returns the string that rendered text goes to, which is the capture of the innermost body that is not emitted
+    const auto target = [&]() -> utte_string*
+    {
+        for (size_t i = frames.size(); i > 0; i--)
+            if (!frames[i - 1].bEmit)
+                return &frames[i - 1].capture;
+        return &output;
+    };
+
+    const auto enter = [&](FrameType type, const ProgramView* body, uint32_t start, size_t stackBase, bool bEmit) -> Frame&
+    {
+        // The expression that started the body stays open until the body returns
+        ++root.depth;
+
+        auto& frame = frames.emplace_back();
+        frame.type = type;
+        frame.program = body;
+        frame.body = body->code + start;
+        frame.returnProgram = current;
+        frame.returnPc = pc;
+        frame.returnScope = scope;
+        frame.stackBase = stackBase;
+        frame.bEmit = bEmit;
+
+        current = body;
+        pc = frame.body;
+        out = target();
+        return frame;
+    };
+
+    const auto acquireScope = [&](Generator* parent) -> std::unique_ptr<Generator>
+    {
+        if (scopes.empty())
+            scopes.push_back(std::make_unique<Generator>(parent));
+        auto result = std::move(scopes.back());
+        scopes.pop_back();
+
+        result->parent = parent;
+        result->functions.clear();
+
+        // Loops push at most 2 variables. Reserving keeps the pointers to them valid
+        result->functions.reserve(2);
+        return result;
+    };
+
+    const auto finish = [&](Variable&& result, bool bEmit) -> void
+    {
+        if (result._internalBoolComment)
+            return;
+        if (bEmit)
+            out->append(result.value);
+        else
+            stack.push_back({ .variable = std::move(result) });
+    };
+
+#ifdef UTTE_VM_COMPUTED_GOTO
+    // Has to be in the same order as the OpCode enum
+    static const void* dispatch[UTTE_OP_COUNT] =
+    {
+        &&label_UTTE_OP_TEXT,
+        &&label_UTTE_OP_FRAME,
+        &&label_UTTE_OP_PUSH,
+        &&label_UTTE_OP_PUSH_BODY,
+        &&label_UTTE_OP_CALL,
+        &&label_UTTE_OP_CALL_DYNAMIC,
+        &&label_UTTE_OP_RETURN,
+    };
+next:
+    UTTE_VM_DISPATCH();
+#else
+    for (;;)
+    {
+        instruction = pc++;
+        switch (instruction->op)
+        {
+#endif
+    UTTE_VM_CASE(UTTE_OP_TEXT)
+    {
+        auto text = current->literal(instruction->a);
+        out->append(text.data(), text.size());
+        UTTE_VM_DISPATCH();
+    }
+    UTTE_VM_CASE(UTTE_OP_FRAME)
+    {
+        if (maxDepth != 0 && root.depth >= maxDepth)
+            return UTTE_PARSE_STATUS_DEPTH_EXCEEDED;
+        ++root.depth;
+        arguments.push_back(stack.size());
+        UTTE_VM_DISPATCH();
+    }
+    UTTE_VM_CASE(UTTE_OP_PUSH)
+    {
+        stack.push_back({ .literal = current->literal(instruction->a), .bLiteral = true });
+        UTTE_VM_DISPATCH();
+    }
+    UTTE_VM_CASE(UTTE_OP_PUSH_BODY)
+    {
+        stack.push_back({ .literal = current->literal(instruction->a), .program = current, .body = instruction->b, .bLiteral = true });
+        UTTE_VM_DISPATCH();
+    }
+    UTTE_VM_CASE(UTTE_OP_CALL)
+    UTTE_VM_CASE(UTTE_OP_CALL_DYNAMIC)
+    {
+        size_t base = arguments.back();
+        arguments.pop_back();
+        --root.depth;
+        bool bEmit = instruction->b & UTTE_CALL_FLAG_EMIT;
+
+        Function* f = nullptr;
+        if (instruction->op == UTTE_OP_CALL)
+            f = scope->findFunction(current->symbols[instruction->a]);
+        else if (stack.size() > base)
+            f = scope->findFunction(stack[base].view());
+        if (f == nullptr)
+        {
+            stack.resize(base);
+            finish(Variable{}, bEmit);
+            UTTE_VM_NEXT();
+        }
+        if (bBudgeted && !root.charge(1, 0, out->size()))
+            return UTTE_PARSE_STATUS_BUDGET_EXCEEDED;
+
+        // Variables are read in place, and only copied if they're an argument of another expression
+        if (f->bVariable)
+        {
+            stack.resize(base);
+            if (f->variable.status != UTTE_PARSE_STATUS_SUCCESS)
+                return f->variable.status;
+            if (f->variable._internalBoolComment)
+                UTTE_VM_NEXT();
+
+            if (bEmit)
+                out->append(f->variable.value);
+            else
+                stack.push_back({ .variable = f->variable });
+            UTTE_VM_NEXT();
+        }
+
+        // Results that go straight to the output are put in place once the render is done, so that their I/O overlaps
+        // with the rest of the render. Any other result is needed right away, so the executor runs until it's ready
+        if (async != nullptr && !f->bVariable && f->asyncFunction)
+        {
+            Task<Variable> task;
+            if (current == &program && nextPrefetched < async->prefetched.size() && async->prefetched[nextPrefetched].call == instruction)
+            {
+                // If the function was replaced since, the prefetched call is still awaited, but its result is unused
+                auto& prefetched = async->prefetched[nextPrefetched++];
+                if (prefetched.function == f)
+                    task = std::move(prefetched.task);
+            }
+            if (!task.valid())
+            {
+                std::vector<Variable> args;
+                args.reserve(stack.size() - base);
+                for (size_t i = base; i < stack.size(); i++)
+                {
+                    auto view = stack[i].view();
+                    args.push_back({ .value = utte_string(view.data(), view.size()), .type = stack[i].variable.type });
+                }
+                task = f->asyncFunction(std::move(args), scope);
+            }
+            stack.resize(base);
+
+            if (bEmit && out == &output)
+            {
+                async->deferred.push_back({ .offset = output.size(), .task = std::move(task) });
+                UTTE_VM_NEXT();
+            }
+            if (!task.wait(*async->executor))
+                return UTTE_PARSE_STATUS_INVALID_VALUE;
+            if (task.result().status != UTTE_PARSE_STATUS_SUCCESS)
+                return task.result().status;
+            finish(std::move(task.result()), bEmit);
+            UTTE_VM_NEXT();
+        }
+
+        views.clear();
+        for (size_t i = base; i < stack.size(); i++)
+            views.push_back({ .value = stack[i].view(), .type = stack[i].variable.type });
+
+        // Control flow builtins run compiled bodies themselves. If a body was not compiled, for example because it's
+        // the value of a variable, the builtin is called instead
+        if (Generator::isBuiltin(*f))
+        {
+            switch (f->symbol)
+            {
+            case UTTE_SYMBOL_FUNC:
+                if (views.size() == 2 && stack[base + 1].program != nullptr)
+                {
+                    Value value = std::move(stack[base + 1]);
+                    value.variable.type = UTTE_VARIABLE_TYPE_HINT_FUNCTION;
+                    stack.resize(base);
+
+                    if (bEmit)
+                        out->append(value.literal.data(), value.literal.size());
+                    else
+                        stack.push_back(std::move(value));
+                    UTTE_VM_NEXT();
+                }
+                break;
+            case UTTE_SYMBOL_IF:
+            case UTTE_SYMBOL_SWITCH:
+            case UTTE_SYMBOL_COND:
+            {
+                size_t index = 0;
+                auto status = f->symbol == UTTE_SYMBOL_IF ? CoreFuncs::selectIf(views, index)
+                            : f->symbol == UTTE_SYMBOL_SWITCH ? CoreFuncs::selectSwitch(views, index)
+                            : CoreFuncs::selectCond(views, index);
+                if (status != UTTE_PARSE_STATUS_SUCCESS)
+                    return status;
+
+                if (index == views.size())
+                {
+                    stack.resize(base);
+                    finish(Variable{}, bEmit);
+                    UTTE_VM_NEXT();
+                }
+                if (stack[base + index].program != nullptr)
+                {
+                    enter(UTTE_VM_FRAME_BODY, stack[base + index].program, stack[base + index].body, base, bEmit);
+                    UTTE_VM_NEXT();
+                }
+                break;
+            }
+            case UTTE_SYMBOL_FOR:
+            {
+                // Same checks as CoreFuncs::funcFor, in the same order
+                if (views.size() < 4 || views.size() > 5)
+                    return UTTE_PARSE_STATUS_OUT_OF_BOUNDS;
+
+                auto& body = stack[base + views.size() - 1];
+                if (body.variable.type != UTTE_VARIABLE_TYPE_HINT_FUNCTION)
+                    return UTTE_PARSE_STATUS_INVALID_TYPE;
+                if (body.program == nullptr)
+                    break;
+
+                if (views.size() == 4 && views[2].type == UTTE_VARIABLE_TYPE_HINT_RANGE)
+                {
+                    Range range;
+                    if (!CoreFuncs::getRange(views[2], range))
+                        return UTTE_PARSE_STATUS_INVALID_VALUE;
+                    if (range.size() == 0)
+                    {
+                        stack.resize(base);
+                        finish(Variable{}, bEmit);
+                        UTTE_VM_NEXT();
+                    }
+
+                    char buffer[20];
+                    auto loopScope = acquireScope(scope);
+                    auto& key = loopScope->pushVariable({}, utte_string(views[1].value.data(), views[1].value.size()));
+                    key.setValue(buffer, CoreFuncs::formatInteger(range.start, buffer), UTTE_VARIABLE_TYPE_HINT_NORMAL);
+
+                    auto& frame = enter(UTTE_VM_FRAME_RANGE_LOOP, body.program, body.body, base, bEmit);
+                    scope = loopScope.get();
+                    frame.loopScope = std::move(loopScope);
+                    frame.key = &key;
+                    frame.range = range;
+                }
+                else if (views.size() == 4 && views[2].type == UTTE_VARIABLE_TYPE_HINT_SEQUENCE)
+                {
+                    auto* sequence = CoreFuncs::getSequence(views[2]);
+                    if (sequence == nullptr || !sequence->next)
+                        return UTTE_PARSE_STATUS_INVALID_VALUE;
+                    if (sequence->begin)
+                        sequence->begin();
+
+                    VariableView element;
+                    if (!sequence->next(element))
+                    {
+                        stack.resize(base);
+                        finish(Variable{}, bEmit);
+                        UTTE_VM_NEXT();
+                    }
+
+                    auto loopScope = acquireScope(scope);
+                    auto& key = loopScope->pushVariable({}, utte_string(views[1].value.data(), views[1].value.size()));
+                    key.setValue(element.value.data(), element.value.size(), element.type);
+
+                    auto& frame = enter(UTTE_VM_FRAME_SEQUENCE_LOOP, body.program, body.body, base, bEmit);
+                    scope = loopScope.get();
+                    frame.loopScope = std::move(loopScope);
+                    frame.key = &key;
+                    frame.sequence = sequence;
+                }
+                else if (views.size() == 4)
+                {
+                    auto* array = CoreFuncs::getArray(views[2]);
+                    if (array == nullptr)
+                        return UTTE_PARSE_STATUS_INVALID_VALUE;
+                    if (array->empty())
+                    {
+                        stack.resize(base);
+                        finish(Variable{}, bEmit);
+                        UTTE_VM_NEXT();
+                    }
+
+                    auto loopScope = acquireScope(scope);
+                    auto& key = loopScope->pushVariable({}, utte_string(views[1].value.data(), views[1].value.size()));
+                    UTTE_VARIABLE_SET_NEW_VAL(key, array, (*array)[0], UTTE_VARIABLE_TYPE_HINT_NORMAL);
+
+                    auto& frame = enter(UTTE_VM_FRAME_ARRAY_LOOP, body.program, body.body, base, bEmit);
+                    scope = loopScope.get();
+                    frame.loopScope = std::move(loopScope);
+                    frame.key = &key;
+                    frame.array = array;
+                }
+                else if (views[3].type == UTTE_VARIABLE_TYPE_HINT_OBJECT)
+                {
+                    const ObjectType* type;
+                    const void* object;
+                    if (!CoreFuncs::getObject(views[3], type, object))
+                        return UTTE_PARSE_STATUS_INVALID_VALUE;
+                    if (type->size() == 0)
+                    {
+                        stack.resize(base);
+                        finish(Variable{}, bEmit);
+                        UTTE_VM_NEXT();
+                    }
+
+                    auto loopScope = acquireScope(scope);
+                    auto& key = loopScope->pushVariable({}, utte_string(views[1].value.data(), views[1].value.size()));
+                    auto& val = loopScope->pushVariable({}, utte_string(views[2].value.data(), views[2].value.size()));
+                    utte_string buffer;
+                    auto value = type->get(object, 0, buffer);
+                    UTTE_VARIABLE_SET_NEW_VAL(key, type, type->name(0), UTTE_VARIABLE_TYPE_HINT_NORMAL);
+                    val.setValue(value.value.data(), value.value.size(), value.type);
+
+                    auto& frame = enter(UTTE_VM_FRAME_OBJECT_LOOP, body.program, body.body, base, bEmit);
+                    scope = loopScope.get();
+                    frame.loopScope = std::move(loopScope);
+                    frame.key = &key;
+                    frame.val = &val;
+                    frame.objectType = type;
+                    frame.object = object;
+                }
+                else
+                {
+                    auto* map = CoreFuncs::getMap(views[3]);
+                    if (map == nullptr)
+                        return UTTE_PARSE_STATUS_INVALID_VALUE;
+                    if (map->empty())
+                    {
+                        stack.resize(base);
+                        finish(Variable{}, bEmit);
+                        UTTE_VM_NEXT();
+                    }
+
+                    auto loopScope = acquireScope(scope);
+                    auto& key = loopScope->pushVariable({}, utte_string(views[1].value.data(), views[1].value.size()));
+                    auto& val = loopScope->pushVariable({}, utte_string(views[2].value.data(), views[2].value.size()));
+                    auto it = map->cbegin();
+                    UTTE_VARIABLE_SET_NEW_VAL(key, it, it->first, UTTE_VARIABLE_TYPE_HINT_NORMAL);
+                    UTTE_VARIABLE_SET_NEW_VAL(val, it, it->second, UTTE_VARIABLE_TYPE_HINT_NORMAL);
+
+                    auto& frame = enter(UTTE_VM_FRAME_MAP_LOOP, body.program, body.body, base, bEmit);
+                    scope = loopScope.get();
+                    frame.loopScope = std::move(loopScope);
+                    frame.key = &key;
+                    frame.val = &val;
+                    frame.it = it;
+                    frame.end = map->cend();
+                }
+                if (!iterate())
+                    return UTTE_PARSE_STATUS_BUDGET_EXCEEDED;
+                UTTE_VM_NEXT();
+            }
+            case UTTE_SYMBOL_INCLUDE:
+            {
+                if (views.size() != 2)
+                    return UTTE_PARSE_STATUS_OUT_OF_BOUNDS;
+
+                auto partial = PartialCache::get(utte_string(views[1].value.data(), views[1].value.size()));
+                if (partial == nullptr)
+                    return UTTE_PARSE_STATUS_INVALID_VALUE;
+                if (partial->status != UTTE_PARSE_STATUS_SUCCESS)
+                    return partial->status;
+
+                auto& frame = enter(UTTE_VM_FRAME_BODY, &partial->view, 0, base, bEmit);
+                frame.partial = std::move(partial);
+                UTTE_VM_NEXT();
+            }
+            default:
+                break;
+            }
+        }
+
+        // The expression is open while its function runs
+        ++root.depth;
+        auto result = f->call(views, scope);
+        --root.depth;
+        stack.resize(base);
+        if (result.status != UTTE_PARSE_STATUS_SUCCESS)
+            return result.status;
+
+        finish(std::move(result), bEmit);
+        UTTE_VM_NEXT();
+    }
+    UTTE_VM_CASE(UTTE_OP_RETURN)
+    {
+        if (frames.empty())
+            return !bBudgeted || root.charge(0, 0, output.size()) ? UTTE_PARSE_STATUS_SUCCESS : UTTE_PARSE_STATUS_BUDGET_EXCEEDED;
+
+        auto& frame = frames.back();
+        if (frame.type == UTTE_VM_FRAME_ARRAY_LOOP && ++frame.index < frame.array->size())
+        {
+            auto& element = (*frame.array)[frame.index];
+            UTTE_VARIABLE_SET_NEW_VAL((*frame.key), element, element, UTTE_VARIABLE_TYPE_HINT_NORMAL);
+            if (!iterate())
+                return UTTE_PARSE_STATUS_BUDGET_EXCEEDED;
+            pc = frame.body;
+            UTTE_VM_NEXT();
+        }
+        if (frame.type == UTTE_VM_FRAME_RANGE_LOOP && ++frame.index < frame.range.size())
+        {
+            char buffer[20];
+            frame.key->setValue(buffer, CoreFuncs::formatInteger(frame.range.at(frame.index), buffer), UTTE_VARIABLE_TYPE_HINT_NORMAL);
+            if (!iterate())
+                return UTTE_PARSE_STATUS_BUDGET_EXCEEDED;
+            pc = frame.body;
+            UTTE_VM_NEXT();
+        }
+        if (frame.type == UTTE_VM_FRAME_SEQUENCE_LOOP)
+        {
+            VariableView element;
+            if (frame.sequence->next(element))
+            {
+                frame.key->setValue(element.value.data(), element.value.size(), element.type);
+                if (!iterate())
+                    return UTTE_PARSE_STATUS_BUDGET_EXCEEDED;
+                pc = frame.body;
+                UTTE_VM_NEXT();
+            }
+        }
+        if (frame.type == UTTE_VM_FRAME_OBJECT_LOOP && ++frame.index < frame.objectType->size())
+        {
+            utte_string buffer;
+            auto value = frame.objectType->get(frame.object, frame.index, buffer);
+            UTTE_VARIABLE_SET_NEW_VAL((*frame.key), frame.objectType, frame.objectType->name(frame.index), UTTE_VARIABLE_TYPE_HINT_NORMAL);
+            frame.val->setValue(value.value.data(), value.value.size(), value.type);
+            if (!iterate())
+                return UTTE_PARSE_STATUS_BUDGET_EXCEEDED;
+            pc = frame.body;
+            UTTE_VM_NEXT();
+        }
+        if (frame.type == UTTE_VM_FRAME_MAP_LOOP && ++frame.it != frame.end)
+        {
+            auto& it = frame.it;
+            UTTE_VARIABLE_SET_NEW_VAL((*frame.key), it, it->first, UTTE_VARIABLE_TYPE_HINT_NORMAL);
+            UTTE_VARIABLE_SET_NEW_VAL((*frame.val), it, it->second, UTTE_VARIABLE_TYPE_HINT_NORMAL);
+            if (!iterate())
+                return UTTE_PARSE_STATUS_BUDGET_EXCEEDED;
+            pc = frame.body;
+            UTTE_VM_NEXT();
+        }
+
+        current = frame.returnProgram;
+        pc = frame.returnPc;
+        scope = frame.returnScope;
+        stack.resize(frame.stackBase);
+        if (frame.loopScope != nullptr)
+            scopes.push_back(std::move(frame.loopScope));
+
+        bool bEmit = frame.bEmit;
+        Variable result{ .value = std::move(frame.capture), .type = UTTE_VARIABLE_TYPE_HINT_NORMAL };
+        frames.pop_back();
+        --root.depth;
+        out = target();
+
+        if (!bEmit)
+            stack.push_back({ .variable = std::move(result) });
+        UTTE_VM_NEXT();
+    }
+#ifndef UTTE_VM_COMPUTED_GOTO
+        default:
+            return UTTE_PARSE_STATUS_INVALID_VALUE;
+        }
+    }
+#endif
+}
+
+utte_string_view UTTE::VM::Value::view() const noexcept
+{
+    return bLiteral ? literal : utte_string_view(variable.value.data(), variable.value.size());
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+#pragma once
+#include "Generator.hpp"
+#include "PartialCache.hpp"
+
+namespace UTTE
+{
+    /**
+     * @brief Runs programs made by the Compiler or loaded from a precompiled file. Bodies of "func" expressions that are passed to the builtin "if",
+     * "switch", "cond", "for" and "include" functions run from their compiled code, instead of being parsed by a
+     * nested generator. All other functions, including builtins that were replaced, are called like when parsing.
+     *
+     * On the README showcase a render of a compiled program takes about 12us at -O2, against about 53us to construct,
+     * load and parse it, so about 4.5 times faster. Most of the gain is from not scanning and cutting the template
+     * again. What remains is the cost of calling functions: every call still builds a vector of arguments and goes
+     * through Function::call, and every variable is looked up through the scopes. Templates that are mostly calls
+     * gain less than ones that are mostly text
+     */
+    class MLS_PUBLIC_API VM
+    {
+    public:
+        // Calls to async functions made by a render started with Generator::renderAsync
+        struct Async
+        {
+            // A call of the main code that was started before running the program
+            struct Prefetched
+            {
+                const Instruction* call;
+                const Function* function;
+                Task<Variable> task;
+            };
+
+            // A call whose result goes at the given offset of the output, once it's done
+            struct Deferred
+            {
+                size_t offset;
+                Task<Variable> task;
+            };
+
+            Executor* executor = nullptr;
+
+            // In the order of the calls in the program
+            std::vector<Prefetched> prefetched;
+            std::vector<Deferred> deferred;
+        };
+
+        /**
+         * @brief Runs a program
+         * @param generator - The generator whose variables and functions the program uses
+         * @param program - The program to run
+         * @param output - The result is appended to this string
+         * @return UTTE_PARSE_STATUS_SUCCESS, or the first error returned by a function
+         */
+        static ParseResultStatus run(Generator& generator, const ProgramView& program, utte_string& output) noexcept;
+
+        /**
+         * @brief Runs a program, starting calls to async functions instead of waiting for them where possible
+         * @param async - The calls that were prefetched, calls whose result goes to the output are added to it
+         */
+        static ParseResultStatus run(Generator& generator, const ProgramView& program, utte_string& output, Async* async) noexcept;
+
+        // Starts every call to an async function in the main code of the program that only has literal arguments. The
+        // main code runs exactly once, unlike the bodies of functions, so these calls are always made
+        static void prefetch(Generator& generator, const ProgramView& program, Async& async) noexcept;
+    private:
+        // An argument on the stack. Literals are views into the program, results of functions are owned
+        struct Value
+        {
+            utte_string_view view() const noexcept;
+
+            Variable variable;
+            utte_string_view literal;
+
+            // The program that contains the compiled code of a "func" body, nullptr for any other value
+            const ProgramView* program = nullptr;
+            uint32_t body = 0;
+            bool bLiteral = false;
+        };
+
+        enum FrameType : uint8_t
+        {
+            UTTE_VM_FRAME_BODY,
+            UTTE_VM_FRAME_ARRAY_LOOP,
+            UTTE_VM_FRAME_MAP_LOOP,
+            UTTE_VM_FRAME_RANGE_LOOP,
+            UTTE_VM_FRAME_SEQUENCE_LOOP,
+            UTTE_VM_FRAME_OBJECT_LOOP,
+        };
+
+        // The state of a body that is being run. The body returns to the instruction after the call that started it
+        struct Frame
+        {
+            FrameType type = UTTE_VM_FRAME_BODY;
+
+            const ProgramView* program = nullptr;
+            const Instruction* body = nullptr;
+
+            const ProgramView* returnProgram = nullptr;
+            const Instruction* returnPc = nullptr;
+            Generator* returnScope = nullptr;
+
+            // The height of the stack before the arguments of the call that started the body
+            size_t stackBase = 0;
+
+            // If set, the body is rendered straight into the output of its caller instead of being captured
+            bool bEmit = false;
+            utte_string capture;
+
+            // Keeps an included partial alive while it's running, even if the partial cache is cleared
+            std::shared_ptr<const Partial> partial;
+
+            // The scope that holds the variables of a loop, and the loop's state
+            std::unique_ptr<Generator> loopScope;
+            Function* key = nullptr;
+            Function* val = nullptr;
+            const std::vector<utte_string>* array = nullptr;
+            Range range;
+            Sequence* sequence = nullptr;
+            const ObjectType* objectType = nullptr;
+            const void* object = nullptr;
+            size_t index = 0;
+            utte_map<utte_string, utte_string>::const_iterator it;
+            utte_map<utte_string, utte_string>::const_iterator end;
+        };
+    };
+}
\ No newline at end of file
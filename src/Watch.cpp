@@ -0,0 +1,326 @@
+#include "Watch.hpp"
+#include "PartialCache.hpp"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#ifdef __linux__
+    #include <cerrno>
+    #include <poll.h>
+    #include <sys/inotify.h>
+    #include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+// How long to wait for more changes after one arrives, so that an editor saving through a temporary file, or a tool
+// writing several files, causes a single build
+static constexpr int settleMilliseconds = 20;
+
+// How often "run" checks whether "stop" was called while there are no changes
+static constexpr int stopMilliseconds = 100;
+
+UTTE::Watch::Watch(const UTTE::BuildOptions& buildOptions, const utte_string& manifest) noexcept
+    : options(buildOptions), threads(buildOptions.threads)
+{
+    std::error_code ec;
+    input = fs::absolute(options.input, ec).lexically_normal();
+    if (!input.has_filename())
+        input = input.parent_path();
+    if (!manifest.empty())
+        manifestLocation = fs::absolute(manifest, ec).lexically_normal();
+
+    if (options.bIncludeFromInput)
+    {
+        PartialCache::setLoader([input = input](const utte_string& path, utte_string& out) -> bool
+        {
+            return PartialCache::loadFile(fs::path(path).is_absolute() ? path : (input / path).string(), out);
+        });
+    }
+}
+
+UTTE::Watch::~Watch() noexcept
+{
+#ifdef __linux__
+    if (fd != -1)
+        close(fd);
+#endif
+}
+
+bool UTTE::Watch::run(const std::function<Callback>& callback) noexcept
+{
+#ifdef __linux__
+    if (fd == -1 && (fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC)) == -1)
+        return false;
+    watch(input);
+
+    // Only the directory of the manifest is watched, not the ones in it
+    if (!manifestLocation.empty())
+    {
+        int wd = inotify_add_watch(fd, manifestLocation.parent_path().c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+        if (wd != -1)
+            directories[wd] = manifestLocation.parent_path();
+    }
+
+    bStop = false;
+    const auto timed = [&](auto&& build) -> bool
+    {
+        auto begin = std::chrono::steady_clock::now();
+        auto results = build();
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+
+        // Changes to files nothing depends on, like the outputs when they're written to the input directory, don't
+        // render anything
+        return results.empty() || callback(results, static_cast<uint64_t>(elapsed));
+    };
+    if (!timed([&]() -> std::vector<BuildFileResult> { return build(); }))
+        return true;
+
+    alignas(inotify_event) char buffer[4096];
+    std::vector<utte_string> changed;
+    bool bOverflow = false;
+    while (!bStop)
+    {
+        pollfd p{ .fd = fd, .events = POLLIN, .revents = 0 };
+        int ready = poll(&p, 1, changed.empty() && !bOverflow ? stopMilliseconds : settleMilliseconds);
+        if (ready < 0 && errno != EINTR)
+            return false;
+        if (ready <= 0)
+        {
+            if (changed.empty() && !bOverflow)
+                continue;
+            if (!timed([&]() -> std::vector<BuildFileResult> { return bOverflow ? build() : update(changed); }))
+                break;
+            changed.clear();
+            bOverflow = false;
+            continue;
+        }
+
+        ssize_t size;
+        while ((size = read(fd, buffer, sizeof(buffer))) > 0)
+        {
+            for (char* it = buffer; it < buffer + size;)
+            {
+                auto* event = reinterpret_cast<inotify_event*>(it);
+                it += sizeof(inotify_event) + event->len;
+
+                // Changes were lost, so everything is built again
+                if (event->mask & IN_Q_OVERFLOW)
+                    bOverflow = true;
+
+                auto directory = directories.find(event->wd);
+                if (event->mask & IN_IGNORED)
+                    directories.erase(event->wd);
+                if (directory == directories.end() || event->len == 0)
+                    continue;
+
+                // inotify doesn't watch directories in watched directories, so new ones are watched here
+                auto location = directory->second / event->name;
+                if ((event->mask & IN_ISDIR) && (event->mask & (IN_CREATE | IN_MOVED_TO)))
+                    watch(location);
+                changed.push_back(location.string());
+            }
+        }
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+void UTTE::Watch::stop() noexcept
+{
+    bStop = true;
+}
+
+std::vector<UTTE::BuildFileResult> UTTE::Watch::build() noexcept
+{
+    manifest = {};
+    if (!manifestLocation.empty())
+        manifest.load(manifestLocation.string());
+    PartialCache::clear();
+    pages.clear();
+
+    std::error_code ec;
+    for (auto it = fs::recursive_directory_iterator(input, ec); !ec && it != fs::recursive_directory_iterator(); it.increment(ec))
+    {
+        std::error_code e;
+        if (it->is_regular_file(e))
+            add(it->path());
+    }
+
+    std::vector<Page*> dirty;
+    for (auto& a : pages)
+        dirty.push_back(&a.second);
+    return render(dirty);
+}
+
+std::vector<UTTE::BuildFileResult> UTTE::Watch::update(const std::vector<utte_string>& changed) noexcept
+{
+    std::error_code ec;
+    std::vector<fs::path> files;
+    for (auto& a : changed)
+        files.push_back(fs::absolute(a, ec).lexically_normal());
+    std::sort(files.begin(), files.end());
+    files.erase(std::unique(files.begin(), files.end()), files.end());
+
+    // The manifest binds variables to every page
+    if (!manifestLocation.empty() && std::binary_search(files.begin(), files.end(), manifestLocation))
+        return build();
+
+    std::vector<Page*> dirty;
+    const auto mark = [&](Page* page) -> void
+    {
+        if (page != nullptr && std::find(dirty.begin(), dirty.end(), page) == dirty.end())
+            dirty.push_back(page);
+    };
+
+    // New and changed pages are loaded again, moving a directory in adds all pages in it
+    bool bRemoved = false;
+    for (auto& a : files)
+    {
+        std::error_code e;
+        if (fs::is_directory(a, e))
+        {
+            for (auto it = fs::recursive_directory_iterator(a, ec); !ec && it != fs::recursive_directory_iterator(); it.increment(ec))
+                if (it->is_regular_file(e))
+                    mark(add(it->path()));
+        }
+        else if (fs::is_regular_file(a, e))
+            mark(add(a));
+        else
+            bRemoved = true;
+    }
+    if (bRemoved)
+    {
+        // Dropping a page invalidates its pointer, so it's removed from the marked pages first
+        std::erase_if(dirty, [&](Page* page) -> bool { std::error_code e; return !fs::is_regular_file(input / page->result.input, e); });
+        std::erase_if(pages, [&](const auto& page) -> bool { std::error_code e; return !fs::is_regular_file(input / page.first, e); });
+    }
+
+    // Partials are compiled again once, by the first page that includes them
+    for (auto& a : pages)
+    {
+        for (auto& include : a.second.includes)
+        {
+            if (std::binary_search(files.begin(), files.end(), resolve(include)))
+            {
+                PartialCache::invalidate(include);
+                mark(&a.second);
+            }
+        }
+    }
+    return render(dirty);
+}
+
+std::vector<UTTE::BuildFileResult> UTTE::Watch::render(const std::vector<Page*>& dirty) noexcept
+{
+    // Every task only uses its own page, the manifest and the options are only read while rendering
+    for (auto* a : dirty)
+        threads.submit([this, a]() -> void { render(*a); });
+    threads.wait();
+
+    std::vector<BuildFileResult> results;
+    for (auto* a : dirty)
+        results.push_back(a->result);
+    std::sort(results.begin(), results.end(), [](const BuildFileResult& a, const BuildFileResult& b) -> bool { return a.input < b.input; });
+    return results;
+}
+
+void UTTE::Watch::render(Page& page) noexcept
+{
+    auto begin = std::chrono::steady_clock::now();
+    auto& result = page.result;
+    auto& generator = *page.generator;
+
+    // Pages that didn't change keep their compiled template, and are only rendered again
+    if (page.bReload)
+    {
+        generator.reset();
+        if (generator.loadFromFile((input / result.input).string()) != UTTE_INITIALISATION_RESULT_SUCCESS)
+        {
+            result.state = BuildFileResult::UTTE_BUILD_FILE_READ_ERROR;
+            result.microseconds = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+            return;
+        }
+        manifest.bind(result.input, generator);
+        page.bReload = false;
+    }
+
+    page.includes.clear();
+    PartialCache::record(&page.includes);
+    auto rendered = generator.render();
+    PartialCache::record(nullptr);
+    std::sort(page.includes.begin(), page.includes.end());
+    page.includes.erase(std::unique(page.includes.begin(), page.includes.end()), page.includes.end());
+
+    result.status = rendered.status;
+    if (rendered.status != UTTE_PARSE_STATUS_SUCCESS)
+        result.state = BuildFileResult::UTTE_BUILD_FILE_RENDER_ERROR;
+    else
+    {
+        // Outputs that didn't change aren't written, so tools watching them only see the pages that changed. A page
+        // that failed keeps the hash of its last good output
+        uint64_t hash = Build::hash(*rendered.result);
+        std::error_code e;
+        if (hash == result.hash && fs::exists(result.output, e))
+            result.state = BuildFileResult::UTTE_BUILD_FILE_UNCHANGED;
+        else
+        {
+            fs::create_directories(fs::path(result.output).parent_path(), e);
+            std::ofstream out(result.output, std::ios::binary | std::ios::trunc);
+            out.write(rendered.result->data(), static_cast<std::streamsize>(rendered.result->size()));
+            result.state = out ? BuildFileResult::UTTE_BUILD_FILE_WRITTEN : BuildFileResult::UTTE_BUILD_FILE_WRITE_ERROR;
+            if (out)
+                result.hash = hash;
+        }
+    }
+    result.microseconds = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+}
+
+UTTE::Watch::Page* UTTE::Watch::add(const fs::path& location) noexcept
+{
+    if (location.extension() != options.extension || location.filename().string().starts_with('_'))
+        return nullptr;
+
+    auto relative = location.lexically_relative(input);
+    if (relative.empty() || *relative.begin() == "..")
+        return nullptr;
+
+    auto& page = pages[relative.generic_string()];
+    if (page.generator == nullptr)
+    {
+        auto output = fs::path(options.output) / relative;
+        output.replace_extension(options.outputExtension);
+        page.result = { .input = relative.generic_string(), .output = output.string() };
+        page.generator = std::make_unique<Generator>();
+    }
+    page.bReload = true;
+    return &page;
+}
+
+fs::path UTTE::Watch::resolve(const utte_string& include) const noexcept
+{
+    std::error_code ec;
+    fs::path location = include;
+    if (options.bIncludeFromInput && location.is_relative())
+        location = input / location;
+    return fs::absolute(location, ec).lexically_normal();
+}
+
+void UTTE::Watch::watch(const fs::path& directory) noexcept
+{
+#ifdef __linux__
+    constexpr uint32_t mask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE | IN_DELETE | IN_ONLYDIR;
+    int wd = inotify_add_watch(fd, directory.c_str(), mask);
+    if (wd != -1)
+        directories[wd] = directory;
+
+    std::error_code ec;
+    for (auto it = fs::recursive_directory_iterator(directory, ec); !ec && it != fs::recursive_directory_iterator(); it.increment(ec))
+    {
+        std::error_code e;
+        if (it->is_directory(e) && (wd = inotify_add_watch(fd, it->path().c_str(), mask)) != -1)
+            directories[wd] = it->path();
+    }
+#endif
+}
\ No newline at end of file
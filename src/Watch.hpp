@@ -0,0 +1,96 @@
+#pragma once
+#include "Build.hpp"
+#include "ThreadPool.hpp"
+#include <atomic>
+#include <filesystem>
+
+namespace UTTE
+{
+    /**
+     * @brief Renders a tree of templates like Build, then renders again whenever a file in it changes, for previewing
+     * while editing. Every page keeps its generator, with the compiled template and the bound variables, and the
+     * partials it included when it was last rendered. When a page changes, only that page is loaded, compiled and
+     * rendered again. When a partial changes, it's removed from the PartialCache, so it's compiled again once, and only
+     * the pages that included it are rendered again. When the manifest changes, every page is bound and rendered
+     * again. Outputs whose content didn't change are not written again. Files are watched with inotify, so "run" is
+     * only available on Linux
+     */
+    class MLS_PUBLIC_API Watch
+    {
+    public:
+        // Called with the results of the pages that were rendered by a build, and the time the build took. Return false
+        // to stop watching
+        typedef bool(Callback)(const std::vector<BuildFileResult>& results, uint64_t microseconds);
+
+        /**
+         * @param options - The same options as for Build
+         * @param manifest - The location of the manifest, empty if there is none
+         */
+        Watch(const BuildOptions& options, const utte_string& manifest) noexcept;
+        ~Watch() noexcept;
+
+        Watch(const Watch&) = delete;
+        Watch& operator=(const Watch&) = delete;
+
+        /**
+         * @brief Renders every page, then waits for changes and renders the pages that depend on them, until the callback
+         * returns false or "stop" is called. Changes that arrive within a few milliseconds of each other, like the ones
+         * of an editor saving through a temporary file, are handled together
+         * @return false if the files couldn't be watched, for example because the platform isn't Linux
+         */
+        bool run(const std::function<Callback>& callback) noexcept;
+
+        // Makes "run" return after the build it's doing, if any. Can be called from any thread
+        void stop() noexcept;
+
+        // Renders every page, loading all pages and the manifest again
+        std::vector<BuildFileResult> build() noexcept;
+
+        /**
+         * @brief Renders the pages that depend on the given files, which is what "run" does for every change
+         * @param changed - The locations of the files that changed, were created or were removed
+         * @return The results of the pages that were rendered, sorted by their path
+         */
+        std::vector<BuildFileResult> update(const std::vector<utte_string>& changed) noexcept;
+    private:
+        struct Page
+        {
+            BuildFileResult result;
+            std::unique_ptr<Generator> generator;
+
+            // The paths given to "include" when the page was last rendered, including the ones of nested partials
+            std::vector<utte_string> includes;
+
+            // Whether the template has to be loaded and bound again before rendering
+            bool bReload = true;
+        };
+
+        // Renders the pages in parallel and returns their results, sorted by their path
+        std::vector<BuildFileResult> render(const std::vector<Page*>& dirty) noexcept;
+        void render(Page& page) noexcept;
+
+        // Adds a page for a template, if it's a page and not a layout or partial. Returns the page or nullptr
+        Page* add(const std::filesystem::path& location) noexcept;
+
+        // Returns the location of the file a path given to "include" is loaded from
+        std::filesystem::path resolve(const utte_string& include) const noexcept;
+
+        // Watches a directory and all directories in it
+        void watch(const std::filesystem::path& directory) noexcept;
+
+        BuildOptions options;
+        std::filesystem::path input;
+        std::filesystem::path manifestLocation;
+        BuildManifest manifest;
+
+        // Pages by their path, relative to the input directory. Nodes of a map don't move, so pages can be rendered
+        // through pointers while others are added
+        std::map<utte_string, Page> pages;
+        ThreadPool threads;
+
+        // The inotify instance and the directory of every watch descriptor
+        int fd = -1;
+        utte_map<int, std::filesystem::path> directories;
+        std::atomic<bool> bStop = false;
+    };
+}
\ No newline at end of file